@@ -14,9 +14,16 @@
  ** [[ Add lengthier description here ]]
  **/
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <chrono>
+#include <condition_variable>
+#include <list>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <set>
 #include <string>
@@ -24,19 +31,24 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <fcntl.h>
+#include "AbsoluteValueConstraint.h"
 #include "AcasParser.h"
+#include "DisjunctionConstraint.h"
 #include "DnCManager.h"
 #include "Engine.h"
 #include "FloatUtils.h"
 #include "InputQuery.h"
+#include "LeakyReluConstraint.h"
 #include "MarabouError.h"
 #include "MString.h"
 #include "MaxConstraint.h"
+#include "NetworkLevelReasoner.h"
 #include "PiecewiseLinearConstraint.h"
 #include "PropertyParser.h"
 #include "QueryLoader.h"
 #include "ReluConstraint.h"
 #include "Set.h"
+#include "SignConstraint.h"
 
 #ifdef _WIN32
 #define STDOUT_FILENO 1
@@ -88,6 +100,41 @@ void addReluConstraint(InputQuery& ipq, unsigned var1, unsigned var2){
     ipq.addPiecewiseLinearConstraint(r);
 }
 
+void addLeakyReluConstraint(InputQuery& ipq, unsigned var1, unsigned var2, double slope){
+    PiecewiseLinearConstraint* r = new LeakyReluConstraint(var1, var2, slope);
+    ipq.addPiecewiseLinearConstraint(r);
+}
+
+void addAbsConstraint(InputQuery& ipq, unsigned var1, unsigned var2){
+    PiecewiseLinearConstraint* a = new AbsoluteValueConstraint(var1, var2);
+    ipq.addPiecewiseLinearConstraint(a);
+}
+
+void addSignConstraint(InputQuery& ipq, unsigned var1, unsigned var2){
+    PiecewiseLinearConstraint* s = new SignConstraint(var1, var2);
+    ipq.addPiecewiseLinearConstraint(s);
+}
+
+void addDisjunctionConstraint(InputQuery& ipq, const std::list<std::list<Equation>> &disjuncts){
+    // Equations over a single variable with coefficient 1 become bounds
+    List<PiecewiseLinearCaseSplit> disjunctList;
+    for(const auto &disjunct: disjuncts){
+        PiecewiseLinearCaseSplit split;
+        for(const auto &equation: disjunct){
+            if(equation._addends.size() == 1 && equation._addends.front()._coefficient == 1 &&
+               equation._type != Equation::EQ){
+                unsigned var = equation._addends.front()._variable;
+                Tightening::BoundType type = (equation._type == Equation::GE) ? Tightening::LB : Tightening::UB;
+                split.storeBoundTightening(Tightening(var, equation._scalar, type));
+            }
+            else
+                split.addEquation(equation);
+        }
+        disjunctList.append(split);
+    }
+    ipq.addPiecewiseLinearConstraint(new DisjunctionConstraint(disjunctList));
+}
+
 void addMaxConstraint(InputQuery& ipq, std::set<unsigned> elements, unsigned v){
     Set<unsigned> e;
     for(unsigned var: elements)
@@ -96,6 +143,188 @@ void addMaxConstraint(InputQuery& ipq, std::set<unsigned> elements, unsigned v){
     ipq.addPiecewiseLinearConstraint(m);
 }
 
+/*
+  Bulk query construction from NumPy arrays. The arrays are accessed
+  in place through the buffer protocol: no copy is made as long as they
+  are C-contiguous and already have the expected dtype (int64 for
+  variable indices, float64 for values), which is what NumPy produces
+  by default. Indices are validated against the number of variables
+  in the query.
+*/
+typedef py::array_t<int64_t, py::array::c_style | py::array::forcecast> IndexArray;
+typedef py::array_t<double, py::array::c_style | py::array::forcecast> ValueArray;
+
+unsigned getNumberOfEquations(const InputQuery &ipq){
+    return ipq.getEquations().size();
+}
+
+unsigned getNumberOfPiecewiseLinearConstraints(const InputQuery &ipq){
+    return ipq.getPiecewiseLinearConstraints().size();
+}
+
+unsigned checkedVariable(const InputQuery &ipq, int64_t variable){
+    if ( variable < 0 || (uint64_t)variable >= ipq.getNumberOfVariables() )
+        throw py::value_error( "Variable index " + std::to_string( variable ) + " is out of range" );
+    return (unsigned)variable;
+}
+
+void setBounds(InputQuery &ipq, const IndexArray &variables, const ValueArray &bounds, bool lower){
+    if ( variables.ndim() != 1 || bounds.ndim() != 1 || variables.shape(0) != bounds.shape(0) )
+        throw py::value_error( "Expected one-dimensional variable and bound arrays of equal length" );
+
+    auto vars = variables.unchecked<1>();
+    auto values = bounds.unchecked<1>();
+
+    // Validate all indices first, so that a bad index leaves the query unchanged
+    for ( py::ssize_t i = 0; i < vars.shape(0); ++i )
+        checkedVariable( ipq, vars(i) );
+
+    for ( py::ssize_t i = 0; i < vars.shape(0); ++i )
+    {
+        unsigned variable = (unsigned)vars(i);
+        if ( lower )
+            ipq.setLowerBound( variable, values(i) );
+        else
+            ipq.setUpperBound( variable, values(i) );
+    }
+}
+
+void setLowerBounds(InputQuery &ipq, IndexArray variables, ValueArray bounds){
+    setBounds( ipq, variables, bounds, true );
+}
+
+void setUpperBounds(InputQuery &ipq, IndexArray variables, ValueArray bounds){
+    setBounds( ipq, variables, bounds, false );
+}
+
+/*
+  Add the equations given in CSR form: row i consists of the addends
+  coefficients[rowStarts[i]:rowStarts[i+1]] over the variables
+  variables[rowStarts[i]:rowStarts[i+1]], with scalar scalars[i] and
+  type types[i] (an Equation.EquationType value).
+*/
+void addEquations(InputQuery &ipq, IndexArray rowStarts, IndexArray variables,
+                  ValueArray coefficients, ValueArray scalars, IndexArray types){
+    if ( rowStarts.ndim() != 1 || variables.ndim() != 1 || coefficients.ndim() != 1 ||
+         scalars.ndim() != 1 || types.ndim() != 1 )
+        throw py::value_error( "Expected one-dimensional arrays" );
+
+    py::ssize_t numEquations = scalars.shape(0);
+    if ( rowStarts.shape(0) != numEquations + 1 || types.shape(0) != numEquations ||
+         variables.shape(0) != coefficients.shape(0) )
+        throw py::value_error( "Inconsistent CSR array lengths" );
+
+    auto starts = rowStarts.unchecked<1>();
+    auto vars = variables.unchecked<1>();
+    auto coeffs = coefficients.unchecked<1>();
+    auto rhs = scalars.unchecked<1>();
+    auto eqTypes = types.unchecked<1>();
+
+    if ( starts(0) != 0 || starts(numEquations) != vars.shape(0) )
+        throw py::value_error( "Row starts do not match the number of addends" );
+
+    // Validate everything first, so that a bad row leaves the query unchanged
+    for ( py::ssize_t i = 0; i < numEquations; ++i )
+    {
+        if ( starts(i) > starts(i + 1) )
+            throw py::value_error( "Row starts must be non-decreasing" );
+
+        int64_t type = eqTypes(i);
+        if ( type != Equation::EQ && type != Equation::GE && type != Equation::LE )
+            throw py::value_error( "Invalid equation type " + std::to_string( type ) );
+    }
+
+    for ( py::ssize_t j = 0; j < vars.shape(0); ++j )
+        checkedVariable( ipq, vars(j) );
+
+    for ( py::ssize_t i = 0; i < numEquations; ++i )
+    {
+        Equation equation( (Equation::EquationType)eqTypes(i) );
+        for ( int64_t j = starts(i); j < starts(i + 1); ++j )
+            equation.addAddend( coeffs(j), (unsigned)vars(j) );
+        equation.setScalar( rhs(i) );
+        ipq.addEquation( equation );
+    }
+}
+
+/*
+  Add a ReLU constraint for every (b, f) row of an n-by-2 array.
+*/
+void addReluConstraints(InputQuery &ipq, IndexArray pairs){
+    if ( pairs.ndim() != 2 || pairs.shape(1) != 2 )
+        throw py::value_error( "Expected an n-by-2 array of (b, f) pairs" );
+
+    auto bf = pairs.unchecked<2>();
+
+    // Validate all pairs first, so that a bad pair leaves the query unchanged
+    for ( py::ssize_t i = 0; i < bf.shape(0); ++i )
+    {
+        checkedVariable( ipq, bf(i, 0) );
+        checkedVariable( ipq, bf(i, 1) );
+    }
+
+    for ( py::ssize_t i = 0; i < bf.shape(0); ++i )
+        addReluConstraint( ipq, (unsigned)bf(i, 0), (unsigned)bf(i, 1) );
+}
+
+/*
+  Bulk population of a NetworkLevelReasoner: the weights between a
+  source layer and the next layer, as (source, target, weight) triples,
+  and the per-neuron data of a layer. Variable index -1 means that the
+  neuron has no corresponding variable.
+*/
+void setNetworkLevelReasonerWeights(NetworkLevelReasoner &nlr, unsigned sourceLayer, IndexArray sources,
+                                    IndexArray targets, ValueArray weights){
+    if ( sourceLayer + 1 >= nlr.getNumberOfLayers() )
+        throw py::value_error( "Invalid source layer" );
+    if ( sources.ndim() != 1 || targets.ndim() != 1 || weights.ndim() != 1 ||
+         sources.shape(0) != weights.shape(0) || targets.shape(0) != weights.shape(0) )
+        throw py::value_error( "Expected one-dimensional arrays of equal length" );
+
+    auto s = sources.unchecked<1>();
+    auto t = targets.unchecked<1>();
+    auto w = weights.unchecked<1>();
+    int64_t sourceLayerSize = nlr.getLayerSize( sourceLayer );
+    int64_t targetLayerSize = nlr.getLayerSize( sourceLayer + 1 );
+    for ( py::ssize_t i = 0; i < w.shape(0); ++i )
+    {
+        if ( s(i) < 0 || s(i) >= sourceLayerSize || t(i) < 0 || t(i) >= targetLayerSize )
+            throw py::value_error( "Neuron index out of range" );
+        nlr.setWeight( sourceLayer, (unsigned)s(i), (unsigned)t(i), w(i) );
+    }
+}
+
+void setNetworkLevelReasonerNeurons(NetworkLevelReasoner &nlr, unsigned layer, ValueArray biases,
+                                    IndexArray activationFunctions, IndexArray weightedSumVariables,
+                                    IndexArray activationResultVariables){
+    if ( layer >= nlr.getNumberOfLayers() )
+        throw py::value_error( "Invalid layer" );
+
+    py::ssize_t layerSize = nlr.getLayerSize( layer );
+    if ( biases.ndim() != 1 || activationFunctions.ndim() != 1 || weightedSumVariables.ndim() != 1 ||
+         activationResultVariables.ndim() != 1 || biases.shape(0) != layerSize ||
+         activationFunctions.shape(0) != layerSize || weightedSumVariables.shape(0) != layerSize ||
+         activationResultVariables.shape(0) != layerSize )
+        throw py::value_error( "Expected one-dimensional arrays of the layer's size" );
+
+    auto bias = biases.unchecked<1>();
+    auto activation = activationFunctions.unchecked<1>();
+    auto b = weightedSumVariables.unchecked<1>();
+    auto f = activationResultVariables.unchecked<1>();
+    for ( unsigned i = 0; i < (unsigned)layerSize; ++i )
+    {
+        if ( activation(i) != NetworkLevelReasoner::ReLU && activation(i) != NetworkLevelReasoner::Identity )
+            throw py::value_error( "Invalid activation function " + std::to_string( activation(i) ) );
+
+        nlr.setBias( layer, i, bias(i) );
+        nlr.setNeuronActivationFunction( layer, i, (NetworkLevelReasoner::ActivationFunction)activation(i) );
+        if ( b(i) >= 0 )
+            nlr.setWeightedSumVariable( layer, i, (unsigned)b(i) );
+        if ( f(i) >= 0 )
+            nlr.setActivationResultVariable( layer, i, (unsigned)f(i) );
+    }
+}
+
 void createInputQuery(InputQuery &inputQuery, std::string networkFilePath, std::string propertyFilePath){
   AcasParser* acasParser = new AcasParser( String(networkFilePath) );
   acasParser->generateQuery( inputQuery );
@@ -202,6 +431,206 @@ std::pair<std::map<int, double>, Statistics> solve(InputQuery &inputQuery, Marab
     return std::make_pair(ret, retStats);
 }
 
+/*
+  A solve running on a background thread. The handle owns a copy of the
+  input query, so the caller may keep modifying (or discard) its own
+  query. The solving thread never touches Python objects, and all
+  blocking calls release the GIL, so several handles can run
+  concurrently with other Python threads. Output is not redirected,
+  since dup2 would affect the whole process; use the verbosity option
+  instead.
+*/
+class SolveHandle {
+public:
+    SolveHandle(const InputQuery &inputQuery, const MarabouOptions &options)
+        : _inputQuery( inputQuery )
+        , _options( options )
+        , _engine( new Engine() )
+        , _result( "UNKNOWN" )
+        , _cancelled( false )
+        , _done( false )
+    {
+        _engine->setVerbosity( options._verbosity );
+        _thread = std::thread( &SolveHandle::run, this );
+    }
+
+    ~SolveHandle(){
+        cancel();
+        py::gil_scoped_release release;
+        if ( _thread.joinable() )
+            _thread.join();
+    }
+
+    /*
+      Ask the solver to stop. The request is picked up by the engines'
+      main loops; preprocessing is not interrupted.
+    */
+    void cancel(){
+        std::lock_guard<std::mutex> lock( _mutex );
+        _cancelled = true;
+        _engine->quitSignal();
+        if ( _dncManager )
+            _dncManager->quitSignal();
+    }
+
+    /*
+      Wait for the solve to finish, for at most the given number of
+      seconds (0 means no limit). Returns whether it has finished.
+    */
+    bool wait(double timeoutInSeconds){
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock( _mutex );
+        if ( timeoutInSeconds <= 0 )
+            _doneCondition.wait( lock, [this]{ return _done; } );
+        else
+            _doneCondition.wait_for( lock, std::chrono::duration<double>( timeoutInSeconds ),
+                                     [this]{ return _done; } );
+        return _done;
+    }
+
+    bool done(){
+        std::lock_guard<std::mutex> lock( _mutex );
+        return _done;
+    }
+
+    /*
+      One of SAT, UNSAT, TIMEOUT, QUIT_REQUESTED, ERROR, or UNKNOWN
+      while the solve is still running.
+    */
+    std::string getResult(){
+        std::lock_guard<std::mutex> lock( _mutex );
+        return _result;
+    }
+
+    /*
+      The statistics of the solve so far. While the solve is running,
+      this is the engine's latest statistics snapshot, or, for a
+      divide-and-conquer solve, the aggregate of its workers'
+      snapshots. Once the solve has finished, these are the final
+      statistics.
+    */
+    Statistics getStatistics(){
+        std::lock_guard<std::mutex> lock( _mutex );
+        if ( _options._dnc )
+            return _dncManager ? _dncManager->getStatisticsSnapshot() : Statistics();
+        if ( _done )
+            return *( _engine->getStatistics() );
+        return _engine->getStatisticsSnapshot();
+    }
+
+    /*
+      The satisfying assignment, indexed by variable, or an empty array
+      if the solve has not finished with SAT.
+    */
+    py::array_t<double> getSolution(){
+        std::lock_guard<std::mutex> lock( _mutex );
+        py::array_t<double> solution( _solution.size() );
+        std::copy( _solution.begin(), _solution.end(), solution.mutable_data() );
+        return solution;
+    }
+
+private:
+    void run(){
+        std::string result = "ERROR";
+        std::vector<double> solution;
+
+        try{
+            if ( !_engine->processInputQuery( _inputQuery ) )
+                result = "UNSAT";
+            else if ( _options._dnc )
+                result = runDnC( solution );
+            else
+                result = runEngine( solution );
+        }
+        catch(const MarabouError &e){
+            printf( "Caught a MarabouError. Code: %u. Message: %s\n", e.getCode(), e.getUserMessage() );
+        }
+
+        std::lock_guard<std::mutex> lock( _mutex );
+        _result = result;
+        _solution.swap( solution );
+        _done = true;
+        _doneCondition.notify_all();
+    }
+
+    std::string runEngine(std::vector<double> &solution){
+        _engine->solve( _options._timeoutInSeconds );
+
+        switch ( _engine->getExitCode() )
+        {
+        case Engine::SAT:
+            _engine->extractSolution( _inputQuery );
+            solution.resize( _inputQuery.getNumberOfVariables() );
+            for ( unsigned i = 0; i < _inputQuery.getNumberOfVariables(); ++i )
+                solution[i] = _inputQuery.getSolutionValue( i );
+            return "SAT";
+        case Engine::UNSAT:
+            return "UNSAT";
+        case Engine::TIMEOUT:
+            return "TIMEOUT";
+        case Engine::QUIT_REQUESTED:
+            return "QUIT_REQUESTED";
+        default:
+            return "ERROR";
+        }
+    }
+
+    std::string runDnC(std::vector<double> &solution){
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            if ( _cancelled )
+                return "QUIT_REQUESTED";
+
+            _dncManager = std::unique_ptr<DnCManager>
+                ( new DnCManager( _options._numWorkers, _options._initialDivides,
+                                  _options._initialTimeout, _options._onlineDivides,
+                                  _options._timeoutFactor, DivideStrategy::LargestInterval,
+                                  &_inputQuery, _options._verbosity ) );
+        }
+
+        _dncManager->solve( _options._timeoutInSeconds );
+
+        switch ( _dncManager->getExitCode() )
+        {
+        case DnCManager::SAT:
+        {
+            std::map<int, double> assignment;
+            _dncManager->getSolution( assignment );
+            solution.resize( assignment.size() );
+            for ( const auto &entry : assignment )
+                solution[entry.first] = entry.second;
+            return "SAT";
+        }
+        case DnCManager::UNSAT:
+            return "UNSAT";
+        case DnCManager::TIMEOUT:
+            return "TIMEOUT";
+        case DnCManager::QUIT_REQUESTED:
+            return "QUIT_REQUESTED";
+        default:
+            return "ERROR";
+        }
+    }
+
+    InputQuery _inputQuery;
+    MarabouOptions _options;
+    std::unique_ptr<Engine> _engine;
+    std::unique_ptr<DnCManager> _dncManager;
+
+    std::string _result;
+    std::vector<double> _solution;
+    bool _cancelled;
+    bool _done;
+
+    std::mutex _mutex;
+    std::condition_variable _doneCondition;
+    std::thread _thread;
+};
+
+std::unique_ptr<SolveHandle> solveAsync(InputQuery &inputQuery, MarabouOptions &options){
+    return std::unique_ptr<SolveHandle>( new SolveHandle( inputQuery, options ) );
+}
+
 void saveQuery(InputQuery& inputQuery, std::string filename){
     inputQuery.saveQuery(String(filename));
 }
@@ -215,11 +644,35 @@ InputQuery loadQuery(std::string filename){
 PYBIND11_MODULE(MarabouCore, m) {
     m.doc() = "Marabou API Library";
     m.def("createInputQuery", &createInputQuery, "Create input query from network and property file");
-    m.def("solve", &solve, "Takes in a description of the InputQuery and returns the solution", py::arg("inputQuery"), py::arg("options"), py::arg("redirect") = "");
+    m.def("solve", &solve, "Takes in a description of the InputQuery and returns the solution", py::arg("inputQuery"), py::arg("options"), py::arg("redirect") = "",
+          py::call_guard<py::gil_scoped_release>());
+    m.def("solveAsync", &solveAsync, "Start solving a copy of the InputQuery on a background thread and return a SolveHandle",
+          py::arg("inputQuery"), py::arg("options"));
+    py::class_<SolveHandle>(m, "SolveHandle")
+        .def("cancel", &SolveHandle::cancel, "Ask the solver to stop")
+        .def("wait", &SolveHandle::wait, "Wait for the solve to finish; returns whether it finished", py::arg("timeout") = 0.0)
+        .def("done", &SolveHandle::done)
+        .def("getResult", &SolveHandle::getResult)
+        .def("getStatistics", &SolveHandle::getStatistics)
+        .def("getSolution", &SolveHandle::getSolution);
     m.def("saveQuery", &saveQuery, "Serializes the inputQuery in the given filename");
     m.def("loadQuery", &loadQuery, "Loads and returns a serialized inputQuery from the given filename");
     m.def("addReluConstraint", &addReluConstraint, "Add a Relu constraint to the InputQuery");
     m.def("addMaxConstraint", &addMaxConstraint, "Add a Max constraint to the InputQuery");
+    m.def("addLeakyReluConstraint", &addLeakyReluConstraint, "Add a leaky Relu constraint with the given slope to the InputQuery");
+    m.def("addAbsConstraint", &addAbsConstraint, "Add an absolute value constraint to the InputQuery");
+    m.def("addSignConstraint", &addSignConstraint, "Add a sign constraint to the InputQuery");
+    m.def("addDisjunctionConstraint", &addDisjunctionConstraint, "Add a disjunction of conjunctions of equations to the InputQuery",
+          py::arg("inputQuery"), py::arg("disjuncts"));
+    m.def("setLowerBounds", &setLowerBounds, "Set the lower bounds of an array of variables",
+          py::arg("inputQuery"), py::arg("variables"), py::arg("bounds"));
+    m.def("setUpperBounds", &setUpperBounds, "Set the upper bounds of an array of variables",
+          py::arg("inputQuery"), py::arg("variables"), py::arg("bounds"));
+    m.def("addEquations", &addEquations, "Add equations given as a CSR matrix with scalars and types",
+          py::arg("inputQuery"), py::arg("rowStarts"), py::arg("variables"),
+          py::arg("coefficients"), py::arg("scalars"), py::arg("types"));
+    m.def("addReluConstraints", &addReluConstraints, "Add a Relu constraint for every (b, f) row of an n-by-2 array",
+          py::arg("inputQuery"), py::arg("pairs"));
     py::class_<InputQuery>(m, "InputQuery")
         .def(py::init())
         .def("setUpperBound", &InputQuery::setUpperBound)
@@ -231,13 +684,45 @@ PYBIND11_MODULE(MarabouCore, m) {
         .def("addEquation", &InputQuery::addEquation)
         .def("getSolutionValue", &InputQuery::getSolutionValue)
         .def("getNumberOfVariables", &InputQuery::getNumberOfVariables)
+        .def("getNumberOfEquations", &getNumberOfEquations)
+        .def("getNumberOfPiecewiseLinearConstraints", &getNumberOfPiecewiseLinearConstraints)
         .def("getNumInputVariables", &InputQuery::getNumInputVariables)
         .def("getNumOutputVariables", &InputQuery::getNumOutputVariables)
         .def("inputVariableByIndex", &InputQuery::inputVariableByIndex)
         .def("markInputVariable", &InputQuery::markInputVariable)
         .def("markOutputVariable", &InputQuery::markOutputVariable)
         .def("outputVariableByIndex", &InputQuery::outputVariableByIndex)
-        .def("setSymbolicBoundTightener", &InputQuery::setSymbolicBoundTightener);
+        .def("setSymbolicBoundTightener", &InputQuery::setSymbolicBoundTightener)
+        .def("setNetworkLevelReasoner", &InputQuery::setNetworkLevelReasoner);
+    m.def("setNetworkLevelReasonerWeights", &setNetworkLevelReasonerWeights,
+          "Set the weights leaving a layer, given as arrays of source neurons, target neurons and weights",
+          py::arg("nlr"), py::arg("sourceLayer"), py::arg("sources"), py::arg("targets"), py::arg("weights"));
+    m.def("setNetworkLevelReasonerNeurons", &setNetworkLevelReasonerNeurons,
+          "Set the biases, activation functions and variables (-1 for none) of a layer's neurons",
+          py::arg("nlr"), py::arg("layer"), py::arg("biases"), py::arg("activationFunctions"),
+          py::arg("weightedSumVariables"), py::arg("activationResultVariables"));
+    // The reasoner is owned by the InputQuery it is attached to
+    py::class_<NetworkLevelReasoner, std::unique_ptr<NetworkLevelReasoner,py::nodelete>> nlr(m, "NetworkLevelReasoner");
+    nlr.def(py::init());
+    nlr.def("setNumberOfLayers", &NetworkLevelReasoner::setNumberOfLayers);
+    nlr.def("getNumberOfLayers", &NetworkLevelReasoner::getNumberOfLayers);
+    nlr.def("setLayerSize", &NetworkLevelReasoner::setLayerSize);
+    nlr.def("getLayerSize", &NetworkLevelReasoner::getLayerSize);
+    nlr.def("setWeightStorage", &NetworkLevelReasoner::setWeightStorage);
+    nlr.def("allocateWeightMatrices", &NetworkLevelReasoner::allocateWeightMatrices);
+    nlr.def("setNeuronActivationFunction", &NetworkLevelReasoner::setNeuronActivationFunction);
+    nlr.def("setWeight", &NetworkLevelReasoner::setWeight);
+    nlr.def("setBias", &NetworkLevelReasoner::setBias);
+    nlr.def("setWeightedSumVariable", &NetworkLevelReasoner::setWeightedSumVariable);
+    nlr.def("setActivationResultVariable", &NetworkLevelReasoner::setActivationResultVariable);
+    py::enum_<NetworkLevelReasoner::ActivationFunction>(nlr, "ActivationFunction")
+        .value("ReLU", NetworkLevelReasoner::ActivationFunction::ReLU)
+        .value("Identity", NetworkLevelReasoner::ActivationFunction::Identity)
+        .export_values();
+    py::enum_<NetworkLevelReasoner::WeightStorage>(nlr, "WeightStorage")
+        .value("DENSE", NetworkLevelReasoner::WeightStorage::DENSE)
+        .value("SPARSE", NetworkLevelReasoner::WeightStorage::SPARSE)
+        .export_values();
     py::class_<MarabouOptions>(m, "Options")
         .def(py::init())
         .def_readwrite("_numWorkers", &MarabouOptions::_numWorkers)
@@ -258,7 +743,15 @@ PYBIND11_MODULE(MarabouCore, m) {
         .def("setInputLowerBound", &SymbolicBoundTightener::setInputLowerBound)
         .def("setInputUpperBound", &SymbolicBoundTightener::setInputUpperBound)
         .def("setReluBVariable", &SymbolicBoundTightener::setReluBVariable)
-        .def("setReluFVariable", &SymbolicBoundTightener::setReluFVariable);
+        .def("setReluFVariable", &SymbolicBoundTightener::setReluFVariable)
+        .def("setActivationFunction", &SymbolicBoundTightener::setActivationFunction,
+             py::arg("layer"), py::arg("neuron"), py::arg("activation"), py::arg("slope") = 0);
+    py::enum_<SymbolicBoundTightener::ActivationFunction>(m, "ActivationFunction")
+        .value("RELU", SymbolicBoundTightener::ActivationFunction::RELU)
+        .value("LEAKY_RELU", SymbolicBoundTightener::ActivationFunction::LEAKY_RELU)
+        .value("ABSOLUTE_VALUE", SymbolicBoundTightener::ActivationFunction::ABSOLUTE_VALUE)
+        .value("SIGN", SymbolicBoundTightener::ActivationFunction::SIGN)
+        .export_values();
     py::class_<Equation> eq(m, "Equation");
     eq.def(py::init());
     eq.def(py::init<Equation::EquationType>());
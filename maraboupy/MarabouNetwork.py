@@ -38,6 +38,10 @@ class MarabouNetwork:
         self.equList = []
         self.reluList = []
         self.maxList = []
+        self.leakyReluList = []
+        self.absList = []
+        self.signList = []
+        self.disjunctionList = []
         self.varsParticipatingInConstraints = set()
         self.lowerBounds = dict()
         self.upperBounds = dict()
@@ -103,6 +107,55 @@ class MarabouNetwork:
         for i in elements:
             self.varsParticipatingInConstraints.add(i)
 
+    def addLeakyReluConstraint(self, v1, v2, slope):
+        """
+        Function to add a new leaky Relu constraint
+        Arguments:
+            v1: (int) variable representing input of leaky Relu
+            v2: (int) variable representing output of leaky Relu
+            slope: (float) slope of the negative part, strictly between 0 and 1
+        """
+        self.leakyReluList += [(v1, v2, slope)]
+        self.varsParticipatingInConstraints.add(v1)
+        self.varsParticipatingInConstraints.add(v2)
+
+    def addAbsConstraint(self, b, f):
+        """
+        Function to add a new absolute value constraint, f = |b|
+        Arguments:
+            b: (int) variable representing input of the absolute value
+            f: (int) variable representing output of the absolute value
+        """
+        self.absList += [(b, f)]
+        self.varsParticipatingInConstraints.add(b)
+        self.varsParticipatingInConstraints.add(f)
+
+    def addSignConstraint(self, b, f):
+        """
+        Function to add a new sign constraint: f is 1 if b is positive
+        and -1 if b is negative
+        Arguments:
+            b: (int) variable representing input of the sign
+            f: (int) variable representing output of the sign
+        """
+        self.signList += [(b, f)]
+        self.varsParticipatingInConstraints.add(b)
+        self.varsParticipatingInConstraints.add(f)
+
+    def addDisjunctionConstraint(self, disjuncts):
+        """
+        Function to add a new disjunction constraint
+        Arguments:
+            disjuncts: (list of list of MarabouUtils.Equation) each disjunct
+                is a conjunction of equations. Inequalities over a single
+                variable with coefficient 1 are treated as bounds
+        """
+        self.disjunctionList += [disjuncts]
+        for disjunct in disjuncts:
+            for e in disjunct:
+                for (c, v) in e.addendList:
+                    self.varsParticipatingInConstraints.add(v)
+
     def lowerBoundExists(self, x):
         """
         Function to check whether lower bound for a variable is known
@@ -148,17 +201,19 @@ class MarabouNetwork:
             ipq.markOutputVariable(outputVar, i)
             i+=1
 
-        for e in self.equList:
-            eq = MarabouCore.Equation(e.EquationType)
-            for (c, v) in e.addendList:
-                assert v < self.numVars
-                eq.addAddend(c, v)
-            eq.setScalar(e.scalar)
-            ipq.addEquation(eq)
+        # Equations, ReLUs and bounds are handed over in bulk, as NumPy
+        # arrays, and range-checked on the C++ side
+        rowStarts = np.zeros(len(self.equList) + 1, dtype=np.int64)
+        rowStarts[1:] = np.cumsum([len(e.addendList) for e in self.equList], dtype=np.int64)
+        variables = np.fromiter((v for e in self.equList for (c, v) in e.addendList),
+                                dtype=np.int64, count=rowStarts[-1])
+        coefficients = np.fromiter((c for e in self.equList for (c, v) in e.addendList),
+                                   dtype=np.float64, count=rowStarts[-1])
+        scalars = np.fromiter((e.scalar for e in self.equList), dtype=np.float64, count=len(self.equList))
+        types = np.fromiter((int(e.EquationType) for e in self.equList), dtype=np.int64, count=len(self.equList))
+        MarabouCore.addEquations(ipq, rowStarts, variables, coefficients, scalars, types)
 
-        for r in self.reluList:
-            assert r[1] < self.numVars and r[0] < self.numVars
-            MarabouCore.addReluConstraint(ipq, r[0], r[1])
+        MarabouCore.addReluConstraints(ipq, np.array(self.reluList, dtype=np.int64).reshape(-1, 2))
 
         for m in self.maxList:
             assert m[1] < self.numVars
@@ -166,16 +221,155 @@ class MarabouNetwork:
                 assert e < self.numVars
             MarabouCore.addMaxConstraint(ipq, m[0], m[1])
 
-        for l in self.lowerBounds:
-            assert l < self.numVars
-            ipq.setLowerBound(l, self.lowerBounds[l])
+        for r in self.leakyReluList:
+            assert r[1] < self.numVars and r[0] < self.numVars
+            MarabouCore.addLeakyReluConstraint(ipq, r[0], r[1], r[2])
+
+        for a in self.absList:
+            assert a[1] < self.numVars and a[0] < self.numVars
+            MarabouCore.addAbsConstraint(ipq, a[0], a[1])
+
+        for s in self.signList:
+            assert s[1] < self.numVars and s[0] < self.numVars
+            MarabouCore.addSignConstraint(ipq, s[0], s[1])
+
+        for disjuncts in self.disjunctionList:
+            converted = []
+            for disjunct in disjuncts:
+                equations = []
+                for e in disjunct:
+                    eq = MarabouCore.Equation(e.EquationType)
+                    for (c, v) in e.addendList:
+                        assert v < self.numVars
+                        eq.addAddend(c, v)
+                    eq.setScalar(e.scalar)
+                    equations.append(eq)
+                converted.append(equations)
+            MarabouCore.addDisjunctionConstraint(ipq, converted)
+
+        MarabouCore.setLowerBounds(ipq, np.fromiter(self.lowerBounds.keys(), dtype=np.int64),
+                                   np.fromiter(self.lowerBounds.values(), dtype=np.float64))
+        MarabouCore.setUpperBounds(ipq, np.fromiter(self.upperBounds.keys(), dtype=np.int64),
+                                   np.fromiter(self.upperBounds.values(), dtype=np.float64))
+
+        # The reasoner only evaluates ReLU activations, so networks with
+        # other activations are solved without it
+        if not (self.leakyReluList or self.absList or self.signList):
+            nlr = self.createNetworkLevelReasoner()
+            if nlr is not None:
+                ipq.setNetworkLevelReasoner(nlr)
 
-        for u in self.upperBounds:
-            assert u < self.numVars
-            ipq.setUpperBound(u, self.upperBounds[u])
-            
         return ipq
 
+    def createNetworkLevelReasoner(self):
+        """
+        Function to recover the layered structure of the network from its
+        equations and ReLU constraints, for Marabou's network-level reasoner.
+        A neuron is an equation that defines one new variable (its weighted
+        sum) in terms of the activation results of the previous layer; the
+        activation result is the ReLU output, or the weighted sum itself if
+        there is no ReLU. Equations that define nothing new are ignored.
+        Returns:
+            nlr: (MarabouCore.NetworkLevelReasoner) representing the network,
+                 or None if the network is not strictly layered, or its last
+                 layer does not match the output variables
+        Raises:
+            RuntimeError: if the network has leaky ReLU, absolute value or
+                          sign constraints, which the reasoner does not support
+        """
+        inputs = [int(v) for inputVarArray in self.inputVars for v in inputVarArray.flatten()]
+        outputs = [int(v) for v in self.outputVars.flatten()]
+        if len(inputs) == 0 or len(outputs) == 0:
+            return None
+
+        # The reasoner only evaluates ReLU activations
+        if self.leakyReluList or self.absList or self.signList:
+            raise RuntimeError("Unsupported activation for the network-level reasoner: "
+                               "leaky ReLU, absolute value and sign constraints are not supported")
+
+        reluOf = dict((int(b), int(f)) for (b, f) in self.reluList)
+        reluResults = set(reluOf.values())
+
+        # Layer of every defined variable; a neuron is a tuple
+        # (weighted sum variable, activation result variable, bias,
+        # [(source activation result variable, weight)])
+        layerOf = dict((v, 0) for v in inputs)
+        layers = [[(v, v, 0.0, []) for v in inputs]]
+
+        pending = [e for e in self.equList if e.EquationType == MarabouCore.Equation.EQ]
+        progress = True
+        while progress:
+            progress = False
+            remaining = []
+            for e in pending:
+                undefined = [(c, v) for (c, v) in e.addendList if v not in layerOf]
+                if len(undefined) != 1 or undefined[0][0] == 0 or len(e.addendList) < 2:
+                    if len(undefined) > 0:
+                        remaining.append(e)
+                    continue
+
+                (outputCoefficient, b) = undefined[0]
+                sources = [(c, v) for (c, v) in e.addendList if v != b]
+                sourceLayers = set(layerOf[v] for (c, v) in sources)
+                if len(sourceLayers) != 1 or b in reluResults or any(v in reluOf for (c, v) in sources):
+                    # Not a strictly layered network, or a neuron that
+                    # reads a pre-activation value
+                    return None
+
+                layer = sourceLayers.pop() + 1
+                f = reluOf.get(b, b)
+                if f in layerOf:
+                    return None
+                layerOf[b] = layer
+                layerOf[f] = layer
+
+                if layer == len(layers):
+                    layers.append([])
+                weights = [(v, -c / outputCoefficient) for (c, v) in sources]
+                layers[layer].append((b, f, e.scalar / outputCoefficient, weights))
+                progress = True
+            pending = remaining
+
+        if len(layers) < 2:
+            return None
+
+        # The last layer has to consist of the output variables, in order
+        lastLayer = dict((neuron[1], neuron) for neuron in layers[-1])
+        if len(lastLayer) != len(outputs) or set(lastLayer.keys()) != set(outputs):
+            return None
+        layers[-1] = [lastLayer[v] for v in outputs]
+
+        nlr = MarabouCore.NetworkLevelReasoner()
+        nlr.setNumberOfLayers(len(layers))
+        for i in range(len(layers)):
+            nlr.setLayerSize(i, len(layers[i]))
+
+        # Use sparse storage for weight matrices that are mostly empty
+        for i in range(len(layers) - 1):
+            numWeights = sum(len(neuron[3]) for neuron in layers[i + 1])
+            if 4 * numWeights < len(layers[i]) * len(layers[i + 1]):
+                nlr.setWeightStorage(i, MarabouCore.NetworkLevelReasoner.SPARSE)
+        nlr.allocateWeightMatrices()
+
+        relu = int(MarabouCore.NetworkLevelReasoner.ReLU)
+        identity = int(MarabouCore.NetworkLevelReasoner.Identity)
+        for i in range(len(layers)):
+            if i > 0:
+                previousPosition = dict((neuron[1], j) for (j, neuron) in enumerate(layers[i - 1]))
+                sources = np.array([previousPosition[v] for neuron in layers[i] for (v, w) in neuron[3]], dtype=np.int64)
+                targets = np.array([j for (j, neuron) in enumerate(layers[i]) for (v, w) in neuron[3]], dtype=np.int64)
+                weights = np.array([w for neuron in layers[i] for (v, w) in neuron[3]], dtype=np.float64)
+                MarabouCore.setNetworkLevelReasonerWeights(nlr, i - 1, sources, targets, weights)
+
+            MarabouCore.setNetworkLevelReasonerNeurons(
+                nlr, i,
+                np.array([neuron[2] for neuron in layers[i]], dtype=np.float64),
+                np.array([relu if neuron[0] != neuron[1] else identity for neuron in layers[i]], dtype=np.int64),
+                np.array([neuron[0] if (i > 0 and neuron[0] != neuron[1]) else -1 for neuron in layers[i]], dtype=np.int64),
+                np.array([neuron[1] if i > 0 else -1 for neuron in layers[i]], dtype=np.int64))
+
+        return nlr
+
     def solve(self, filename="", verbose=True, options=None):
         """
         Function to solve query represented by this network
@@ -213,6 +407,27 @@ class MarabouNetwork:
 
         return [vals, stats]
 
+    def solveAsync(self, options=None):
+        """
+        Function to start solving the query represented by this network
+        on a background thread, without holding the GIL
+        Arguments:
+            options: (MarabouCore.Options) solver options; output is not
+                    redirected, use the verbosity option instead
+        Returns:
+            handle: (MarabouCore.SolveHandle) supports wait(timeout), done(),
+                    cancel(), getResult(), getStatistics() and getSolution(),
+                    which returns the satisfying assignment as a NumPy array
+                    indexed by variable (empty unless the result is SAT).
+                    While the solve is running, getStatistics() returns
+                    the latest snapshot of the solver's statistics (the
+                    aggregate over the workers in divide-and-conquer mode)
+        """
+        ipq = self.getMarabouQuery()
+        if options == None:
+            options = MarabouCore.Options()
+        return MarabouCore.solveAsync(ipq, options)
+
     def saveQuery(self, filename=""):
         """
         Serializes the inputQuery in the given filename
@@ -1,5 +1,10 @@
 from maraboupy import MarabouCore
 from maraboupy.Marabou import createOptions
+from maraboupy.MarabouNetworkNNet import MarabouNetworkNNet
+import numpy as np
+import os
+
+RESOURCES = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "resources")
 
 large = 100
 def define_network():
@@ -45,7 +50,210 @@ def test_dump_query():
     MarabouCore.solve(network, options, "")
     network.dump()
 
+def test_add_equations():
+    network = MarabouCore.InputQuery()
+    network.setNumberOfVariables(3)
+
+    # x0 + 2x1 = 1, x1 - x2 <= 0
+    MarabouCore.addEquations(network, np.array([0, 2, 4]), np.array([0, 1, 1, 2]),
+                             np.array([1.0, 2.0, 1.0, -1.0]), np.array([1.0, 0.0]),
+                             np.array([int(MarabouCore.Equation.EQ), int(MarabouCore.Equation.LE)]))
+    assert network.getNumberOfEquations() == 2
+
+def test_bulk_query_matches_element_wise():
+    # The query of define_network(), built through the bulk APIs
+    network = MarabouCore.InputQuery()
+    network.setNumberOfVariables(3)
+    MarabouCore.setLowerBounds(network, np.array([0, 1, 2]), np.array([-1.0, 1.0, -large]))
+    MarabouCore.setUpperBounds(network, np.array([0, 1, 2]), np.array([1.0, 2.0, large]))
+    MarabouCore.addReluConstraints(network, np.array([[0, 1]]))
+    MarabouCore.addEquations(network, np.array([0, 2]), np.array([2, 1]), np.array([1.0, -1.0]),
+                             np.array([0.0]), np.array([int(MarabouCore.Equation.EQ)]))
+
+    options = createOptions(verbosity=0)
+    bulkSolution, _ = MarabouCore.solve(network, options, "")
+    solution, _ = MarabouCore.solve(define_network(), options, "")
+    assert (len(bulkSolution) > 0) == (len(solution) > 0)
+
+def expect_value_error(function, *args):
+    try:
+        function(*args)
+    except ValueError:
+        return
+    assert False, "Expected a ValueError"
+
+def test_add_equations_rejects_bad_rows():
+    network = MarabouCore.InputQuery()
+    network.setNumberOfVariables(3)
+    eq = int(MarabouCore.Equation.EQ)
+    coefficients = np.array([1.0, 2.0, 1.0, -1.0])
+    scalars = np.array([1.0, 0.0])
+
+    # A variable out of range in the second row
+    expect_value_error(MarabouCore.addEquations, network, np.array([0, 2, 4]), np.array([0, 1, 1, 3]),
+                       coefficients, scalars, np.array([eq, eq]))
+    # Row starts going backwards after a valid first row
+    expect_value_error(MarabouCore.addEquations, network, np.array([0, 3, 2, 4]), np.array([0, 1, 1, 2]),
+                       coefficients, np.array([1.0, 0.0, 0.0]), np.array([eq, eq, eq]))
+    # An invalid equation type in the second row
+    expect_value_error(MarabouCore.addEquations, network, np.array([0, 2, 4]), np.array([0, 1, 1, 2]),
+                       coefficients, scalars, np.array([eq, 7]))
+    # Inconsistent array lengths
+    expect_value_error(MarabouCore.addEquations, network, np.array([0, 2]), np.array([0, 1, 1, 2]),
+                       coefficients, scalars, np.array([eq, eq]))
+
+    # None of the equations before the bad rows were added
+    assert network.getNumberOfEquations() == 0
+
+def test_add_relu_constraints_rejects_bad_pairs():
+    network = MarabouCore.InputQuery()
+    network.setNumberOfVariables(4)
+
+    expect_value_error(MarabouCore.addReluConstraints, network, np.array([[0, 1], [2, 4]]))
+    expect_value_error(MarabouCore.addReluConstraints, network, np.array([[0, 1], [-1, 3]]))
+    expect_value_error(MarabouCore.addReluConstraints, network, np.array([0, 1, 2, 3]))
+    assert network.getNumberOfPiecewiseLinearConstraints() == 0
+
+    MarabouCore.addReluConstraints(network, np.array([[0, 1], [2, 3]]))
+    assert network.getNumberOfPiecewiseLinearConstraints() == 2
+
+def test_set_bounds_rejects_bad_variables():
+    network = MarabouCore.InputQuery()
+    network.setNumberOfVariables(2)
+
+    expect_value_error(MarabouCore.setLowerBounds, network, np.array([0, 2]), np.array([1.0, 2.0]))
+    expect_value_error(MarabouCore.setUpperBounds, network, np.array([0, 1]), np.array([1.0]))
+    assert network.getLowerBound(0) < -1e300
+
+    MarabouCore.setLowerBounds(network, np.array([0, 1]), np.array([1.0, 2.0]))
+    MarabouCore.setUpperBounds(network, np.array([0, 1]), np.array([3.0, 4.0]))
+    assert network.getLowerBound(1) == 2.0
+    assert network.getUpperBound(0) == 3.0
+
+def test_solve_async_statistics():
+    network = define_network()
+    handle = MarabouCore.solveAsync(network, createOptions(verbosity=0))
+    assert handle.wait(0)
+    assert handle.getResult() in ("SAT", "UNSAT")
+    handle.getStatistics()
+
+    handle = MarabouCore.solveAsync(network, createOptions(verbosity=0, dnc=True))
+    assert handle.wait(0)
+    handle.getStatistics()
+
+def long_running_query():
+    # An ACAS Xu query that takes far longer to solve than the tests wait for
+    network = MarabouCore.InputQuery()
+    MarabouCore.createInputQuery(network,
+                                 os.path.join(RESOURCES, "nnet", "acasxu", "ACASXU_experimental_v2a_1_6.nnet"),
+                                 os.path.join(RESOURCES, "properties", "acas_property_3.txt"))
+    return network
+
+def test_solve_async_matches_solve():
+    network = define_network()
+    solution, _ = MarabouCore.solve(network, createOptions(verbosity=0), "")
+
+    handle = MarabouCore.solveAsync(network, createOptions(verbosity=0))
+    assert handle.wait(0)
+    assert handle.done()
+    assert handle.getResult() == ("SAT" if len(solution) > 0 else "UNSAT")
+    assignment = handle.getSolution()
+    if handle.getResult() == "SAT":
+        assert len(assignment) == network.getNumberOfVariables()
+        for (variable, value) in solution.items():
+            assert abs(assignment[variable] - value) < 1e-6
+    else:
+        assert len(assignment) == 0
+
+def test_solve_async_cancel():
+    network = long_running_query()
+    for dnc in [False, True]:
+        handle = MarabouCore.solveAsync(network, createOptions(verbosity=0, dnc=dnc))
+        assert not handle.wait(1)
+        assert handle.getResult() == "UNKNOWN"
+        handle.cancel()
+        assert handle.wait(0)
+        assert handle.getResult() == "QUIT_REQUESTED"
+        assert len(handle.getSolution()) == 0
+
+def test_solve_async_statistics_while_running():
+    network = long_running_query()
+
+    for dnc in [False, True]:
+        handle = MarabouCore.solveAsync(network, createOptions(verbosity=0, dnc=dnc))
+        pivots = []
+        while len(pivots) < 20 and not handle.wait(0.2):
+            pivots.append(handle.getStatistics().getNumTableauPivots())
+        handle.cancel()
+        handle.wait(0)
+
+        # The statistics advance while the solve is running
+        assert len(pivots) == 20
+        assert pivots == sorted(pivots)
+        assert pivots[-1] > pivots[0]
+
+def test_network_level_reasoner_bulk_setters():
+    nlr = MarabouCore.NetworkLevelReasoner()
+    nlr.setNumberOfLayers(2)
+    nlr.setLayerSize(0, 2)
+    nlr.setLayerSize(1, 1)
+    nlr.setWeightStorage(0, MarabouCore.NetworkLevelReasoner.SPARSE)
+    nlr.allocateWeightMatrices()
+    assert nlr.getNumberOfLayers() == 2
+    assert nlr.getLayerSize(0) == 2
+
+    relu = int(MarabouCore.NetworkLevelReasoner.ReLU)
+    identity = int(MarabouCore.NetworkLevelReasoner.Identity)
+
+    # No layer after the last one, a neuron out of range, mismatched lengths
+    expect_value_error(MarabouCore.setNetworkLevelReasonerWeights, nlr, 1, np.array([0]), np.array([0]),
+                       np.array([1.0]))
+    expect_value_error(MarabouCore.setNetworkLevelReasonerWeights, nlr, 0, np.array([2]), np.array([0]),
+                       np.array([1.0]))
+    expect_value_error(MarabouCore.setNetworkLevelReasonerWeights, nlr, 0, np.array([0, 1]), np.array([0]),
+                       np.array([1.0, 2.0]))
+    MarabouCore.setNetworkLevelReasonerWeights(nlr, 0, np.array([0, 1]), np.array([0, 0]), np.array([1.0, -1.0]))
+
+    # An unknown activation function, arrays not of the layer's size
+    expect_value_error(MarabouCore.setNetworkLevelReasonerNeurons, nlr, 1, np.array([0.0]), np.array([5]),
+                       np.array([2]), np.array([3]))
+    expect_value_error(MarabouCore.setNetworkLevelReasonerNeurons, nlr, 0, np.array([0.0]), np.array([identity]),
+                       np.array([0]), np.array([0]))
+    MarabouCore.setNetworkLevelReasonerNeurons(nlr, 0, np.array([0.0, 0.0]), np.array([identity, identity]),
+                                               np.array([-1, -1]), np.array([0, 1]))
+    MarabouCore.setNetworkLevelReasonerNeurons(nlr, 1, np.array([0.5]), np.array([relu]),
+                                               np.array([2]), np.array([3]))
+
+    network = MarabouCore.InputQuery()
+    network.setNumberOfVariables(4)
+    network.setNetworkLevelReasoner(nlr)
+
+def test_create_network_level_reasoner():
+    network = MarabouNetworkNNet(os.path.join(RESOURCES, "nnet", "acasxu", "ACASXU_experimental_v2a_1_1.nnet"))
+    nlr = network.createNetworkLevelReasoner()
+
+    # The layers recovered from the equations are those of the file
+    assert nlr is not None
+    assert nlr.getNumberOfLayers() == len(network.layerSizes)
+    for (layer, size) in enumerate(network.layerSizes):
+        assert nlr.getLayerSize(layer) == size
+
+    # A network that is not layered gets no reasoner
+    network.addRelu(network.outputVars[0][0], network.inputVars[0][0])
+    assert network.createNetworkLevelReasoner() is None
+
 
 if __name__ == "__main__":
     test_dump_query()
     test_solve_partial_arguments()
+    test_add_equations()
+    test_bulk_query_matches_element_wise()
+    test_add_equations_rejects_bad_rows()
+    test_add_relu_constraints_rejects_bad_pairs()
+    test_set_bounds_rejects_bad_variables()
+    test_solve_async_matches_solve()
+    test_solve_async_cancel()
+    test_solve_async_statistics()
+    test_solve_async_statistics_while_running()
+    test_network_level_reasoner_bulk_setters()
+    test_create_network_level_reasoner()
@@ -20,6 +20,9 @@
 #include "MString.h"
 #include "SparseUnsortedList.h"
 
+#include <algorithm>
+#include <vector>
+
 CSRMatrix::CSRMatrix()
     : _m( 0 )
     , _n( 0 )
@@ -28,6 +31,7 @@ CSRMatrix::CSRMatrix()
     , _JA( NULL )
     , _nnz( 0 )
     , _estimatedNnz( 0 )
+    , _rowCapacity( 0 )
 {
 }
 
@@ -39,6 +43,7 @@ CSRMatrix::CSRMatrix( const double *M, unsigned m, unsigned n )
     , _JA( NULL )
     , _nnz( 0 )
     , _estimatedNnz( 0 )
+    , _rowCapacity( 0 )
 {
     initialize( M, m, n );
 }
@@ -76,6 +81,65 @@ void CSRMatrix::initialize( const double *M, unsigned m, unsigned n )
     }
 }
 
+void CSRMatrix::initialize( const SparseUnsortedList * const *rows, unsigned m, unsigned n )
+{
+    _m = m;
+    _n = n;
+
+    freeMemoryIfNeeded();
+
+    _nnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+        _nnz += rows[i]->getNnz();
+
+    _estimatedNnz = std::max( 1U, _nnz );
+
+    _A = new double[_estimatedNnz];
+    if ( !_A )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::A" );
+
+    _IA = new unsigned[_m + 1];
+    if ( !_IA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::IA" );
+    _rowCapacity = _m;
+
+    _JA = new unsigned[_estimatedNnz];
+    if ( !_JA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::JA" );
+
+    // The rows are unsorted, whereas the entries of each CSR row are sorted by column
+    std::vector<SparseUnsortedList::Entry> sortedRow;
+
+    _IA[0] = 0;
+    unsigned index = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        sortedRow.clear();
+        for ( const auto &entry : *rows[i] )
+        {
+            if ( !FloatUtils::isZero( entry._value ) )
+                sortedRow.push_back( entry );
+        }
+
+        std::sort( sortedRow.begin(), sortedRow.end(),
+                   []( const SparseUnsortedList::Entry &a, const SparseUnsortedList::Entry &b )
+                   {
+                       return a._index < b._index;
+                   } );
+
+        for ( const auto &entry : sortedRow )
+        {
+            _JA[index] = entry._index;
+            _A[index] = entry._value;
+            ++index;
+        }
+
+        _IA[i + 1] = index;
+    }
+
+    _nnz = index;
+}
+
 void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
 {
     _m = m;
@@ -93,6 +157,7 @@ void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
     _IA = new unsigned[_m + 1];
     if ( !_IA )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::IA" );
+    _rowCapacity = _m;
 
     _JA = new unsigned[_estimatedNnz];
     if ( !_JA )
@@ -138,11 +203,20 @@ double CSRMatrix::get( unsigned row, unsigned column ) const
 
 void CSRMatrix::addLastRow( const double *row )
 {
-    // Array _IA needs to increase by one
-    unsigned *newIA = new unsigned[_m + 2];
-    memcpy( newIA, _IA, sizeof(unsigned) * ( _m + 1 ) );
-    delete[] _IA;
-    _IA = newIA;
+    // Array _IA needs to increase by one. If there is no room, double
+    // its capacity.
+    if ( _m + 1 > _rowCapacity )
+    {
+        unsigned newRowCapacity = std::max( _m + 1, 2 * _rowCapacity );
+        unsigned *newIA = new unsigned[newRowCapacity + 1];
+        if ( !newIA )
+            throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::newIA" );
+
+        memcpy( newIA, _IA, sizeof(unsigned) * ( _m + 1 ) );
+        delete[] _IA;
+        _IA = newIA;
+        _rowCapacity = newRowCapacity;
+    }
 
     // Add the new row
     _IA[_m + 1] = _IA[_m];
@@ -246,22 +320,25 @@ void CSRMatrix::storeIntoOther( SparseMatrix *other ) const
     otherCsr->_m = _m;
     otherCsr->_n = _n;
     otherCsr->_nnz = _nnz;
-    otherCsr->_estimatedNnz = _estimatedNnz;
 
-    otherCsr->_A = new double[_estimatedNnz];
+    // Only the used entries are copied, so stored matrices scale with nnz
+    otherCsr->_estimatedNnz = std::max( 1U, _nnz );
+
+    otherCsr->_A = new double[otherCsr->_estimatedNnz];
     if ( !otherCsr->_A )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::otherCsrA" );
-    memcpy( otherCsr->_A, _A, sizeof(double) * _estimatedNnz );
+    memcpy( otherCsr->_A, _A, sizeof(double) * _nnz );
 
     otherCsr->_IA = new unsigned[_m + 1];
     if ( !otherCsr->_IA )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::otherCsrIA" );
+    otherCsr->_rowCapacity = _m;
     memcpy( otherCsr->_IA, _IA, sizeof(unsigned) * ( _m + 1 ) );
 
-    otherCsr->_JA = new unsigned[_estimatedNnz];
+    otherCsr->_JA = new unsigned[otherCsr->_estimatedNnz];
     if ( !otherCsr->_JA )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::otherCsrJA" );
-    memcpy( otherCsr->_JA, _JA, sizeof(unsigned) * _estimatedNnz );
+    memcpy( otherCsr->_JA, _JA, sizeof(unsigned) * _nnz );
 }
 
 void CSRMatrix::getRow( unsigned row, SparseUnsortedList *result ) const
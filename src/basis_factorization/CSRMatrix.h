@@ -54,6 +54,12 @@ public:
     void initialize( const double *M, unsigned m, unsigned n );
     void initializeToEmpty( unsigned m, unsigned n );
 
+    /*
+      Initialize the matrix from m sparse rows. Exactly enough memory
+      is allocated for the rows' entries.
+    */
+    void initialize( const SparseUnsortedList * const *rows, unsigned m, unsigned n );
+
     /*
       Obtain a single element/row/column of the matrix.
     */
@@ -167,6 +173,12 @@ private:
     */
     unsigned _estimatedNnz;
 
+    /*
+      The number of rows for which _IA is allocated. It is doubled
+      when rows are added beyond it.
+    */
+    unsigned _rowCapacity;
+
     /*
       If too many elements are stored for the current
       arrays' capacity, increase their size.
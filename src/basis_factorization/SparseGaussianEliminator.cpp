@@ -27,30 +27,61 @@
 SparseGaussianEliminator::SparseGaussianEliminator( unsigned m )
     : _m( m )
     , _work( NULL )
-    , _work2( NULL )
     , _statistics( NULL )
-    , _numURowElements( NULL )
-    , _numUColumnElements( NULL )
+    , _numVRowElements( NULL )
+    , _numVColumnElements( NULL )
+    , _rowBucketHead( NULL )
+    , _nextRowInBucket( NULL )
+    , _previousRowInBucket( NULL )
+    , _columnBucketHead( NULL )
+    , _nextColumnInBucket( NULL )
+    , _previousColumnInBucket( NULL )
 {
     _work = new double[_m];
     if ( !_work )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseGaussianEliminator::work" );
 
-    _work2 = new double[_m];
-    if ( !_work2 )
+    _numVRowElements = new unsigned[_m];
+    if ( !_numVRowElements )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::work2" );
+                                       "SparseGaussianEliminator::numVRowElements" );
 
-    _numURowElements = new unsigned[_m];
-    if ( !_numURowElements )
+    _numVColumnElements = new unsigned[_m];
+    if ( !_numVColumnElements )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::numURowElements" );
+                                       "SparseGaussianEliminator::numVColumnElements" );
 
-    _numUColumnElements = new unsigned[_m];
-    if ( !_numUColumnElements )
+    // A row or column has between 0 and m non-zero elements
+    _rowBucketHead = new unsigned[_m + 1];
+    if ( !_rowBucketHead )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::numUColumnElements" );
+                                       "SparseGaussianEliminator::rowBucketHead" );
+
+    _nextRowInBucket = new unsigned[_m];
+    if ( !_nextRowInBucket )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::nextRowInBucket" );
+
+    _previousRowInBucket = new unsigned[_m];
+    if ( !_previousRowInBucket )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::previousRowInBucket" );
+
+    _columnBucketHead = new unsigned[_m + 1];
+    if ( !_columnBucketHead )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::columnBucketHead" );
+
+    _nextColumnInBucket = new unsigned[_m];
+    if ( !_nextColumnInBucket )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::nextColumnInBucket" );
+
+    _previousColumnInBucket = new unsigned[_m];
+    if ( !_previousColumnInBucket )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::previousColumnInBucket" );
 }
 
 SparseGaussianEliminator::~SparseGaussianEliminator()
@@ -61,22 +92,52 @@ SparseGaussianEliminator::~SparseGaussianEliminator()
         _work = NULL;
     }
 
-    if ( _work2 )
+    if ( _numVRowElements )
     {
-        delete[] _work2;
-        _work2 = NULL;
+        delete[] _numVRowElements;
+        _numVRowElements = NULL;
     }
 
-    if ( _numURowElements )
+    if ( _numVColumnElements )
     {
-        delete[] _numURowElements;
-        _numURowElements = NULL;
+        delete[] _numVColumnElements;
+        _numVColumnElements = NULL;
     }
 
-    if ( _numUColumnElements )
+    if ( _rowBucketHead )
     {
-        delete[] _numUColumnElements;
-        _numUColumnElements = NULL;
+        delete[] _rowBucketHead;
+        _rowBucketHead = NULL;
+    }
+
+    if ( _nextRowInBucket )
+    {
+        delete[] _nextRowInBucket;
+        _nextRowInBucket = NULL;
+    }
+
+    if ( _previousRowInBucket )
+    {
+        delete[] _previousRowInBucket;
+        _previousRowInBucket = NULL;
+    }
+
+    if ( _columnBucketHead )
+    {
+        delete[] _columnBucketHead;
+        _columnBucketHead = NULL;
+    }
+
+    if ( _nextColumnInBucket )
+    {
+        delete[] _nextColumnInBucket;
+        _nextColumnInBucket = NULL;
+    }
+
+    if ( _previousColumnInBucket )
+    {
+        delete[] _previousColumnInBucket;
+        _previousColumnInBucket = NULL;
     }
 }
 
@@ -104,13 +165,90 @@ void SparseGaussianEliminator::initializeFactorization( const SparseColumnsOfBas
     _sparseLUFactors->_P.resetToIdentity();
     _sparseLUFactors->_Q.resetToIdentity();
 
-    // Count number of non-zeros in U ( = V )
-    _sparseLUFactors->_V->countElements( _numURowElements, _numUColumnElements );
+    // Count number of non-zeros in V, and bucket the rows and columns accordingly
+    _sparseLUFactors->_V->countElements( _numVRowElements, _numVColumnElements );
+    initializeBuckets();
 
     // Use same matrix P for L and V
     _sparseLUFactors->_usePForF = false;
 }
 
+void SparseGaussianEliminator::initializeBuckets()
+{
+    std::fill_n( _rowBucketHead, _m + 1, _m );
+    std::fill_n( _columnBucketHead, _m + 1, _m );
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        addRowToBucket( i );
+        addColumnToBucket( i );
+    }
+}
+
+void SparseGaussianEliminator::addRowToBucket( unsigned vRow )
+{
+    unsigned count = _numVRowElements[vRow];
+    unsigned head = _rowBucketHead[count];
+
+    _previousRowInBucket[vRow] = _m;
+    _nextRowInBucket[vRow] = head;
+    if ( head != _m )
+        _previousRowInBucket[head] = vRow;
+    _rowBucketHead[count] = vRow;
+}
+
+void SparseGaussianEliminator::removeRowFromBucket( unsigned vRow )
+{
+    unsigned previous = _previousRowInBucket[vRow];
+    unsigned next = _nextRowInBucket[vRow];
+
+    if ( previous != _m )
+        _nextRowInBucket[previous] = next;
+    else
+        _rowBucketHead[_numVRowElements[vRow]] = next;
+
+    if ( next != _m )
+        _previousRowInBucket[next] = previous;
+}
+
+void SparseGaussianEliminator::addColumnToBucket( unsigned vColumn )
+{
+    unsigned count = _numVColumnElements[vColumn];
+    unsigned head = _columnBucketHead[count];
+
+    _previousColumnInBucket[vColumn] = _m;
+    _nextColumnInBucket[vColumn] = head;
+    if ( head != _m )
+        _previousColumnInBucket[head] = vColumn;
+    _columnBucketHead[count] = vColumn;
+}
+
+void SparseGaussianEliminator::removeColumnFromBucket( unsigned vColumn )
+{
+    unsigned previous = _previousColumnInBucket[vColumn];
+    unsigned next = _nextColumnInBucket[vColumn];
+
+    if ( previous != _m )
+        _nextColumnInBucket[previous] = next;
+    else
+        _columnBucketHead[_numVColumnElements[vColumn]] = next;
+
+    if ( next != _m )
+        _previousColumnInBucket[next] = previous;
+}
+
+void SparseGaussianEliminator::adjustColumnCount( unsigned vColumn, bool increase )
+{
+    removeColumnFromBucket( vColumn );
+
+    if ( increase )
+        ++_numVColumnElements[vColumn];
+    else
+        --_numVColumnElements[vColumn];
+
+    addColumnToBucket( vColumn );
+}
+
 void SparseGaussianEliminator::permute()
 {
     /*
@@ -122,15 +260,7 @@ void SparseGaussianEliminator::permute()
     _sparseLUFactors->_P.swapColumns( _uPivotRow, _eliminationStep );
     _sparseLUFactors->_Q.swapRows( _uPivotColumn, _eliminationStep );
 
-    // Adjust the element counters
-    unsigned temp;
-    temp = _numURowElements[_uPivotRow];
-    _numURowElements[_uPivotRow] = _numURowElements[_eliminationStep];
-    _numURowElements[_eliminationStep] = temp;
-
-    temp = _numUColumnElements[_uPivotColumn];
-    _numUColumnElements[_uPivotColumn] = _numUColumnElements[_eliminationStep];
-    _numUColumnElements[_eliminationStep] = temp;
+    // The element counters are indexed by V, and so are unaffected
 }
 
 void SparseGaussianEliminator::run( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors )
@@ -138,7 +268,16 @@ void SparseGaussianEliminator::run( const SparseColumnsOfBasis *A, SparseLUFacto
     // Initialize the LU factors
     initializeFactorization( A, sparseLUFactors );
 
-    // Do the work
+    // Permute out the triangular parts of the matrix
+    _eliminationStep = 0;
+    triangularize();
+
+    unsigned bumpSize = _m - _eliminationStep;
+    log( Stringf( "Triangular pre-pass done. Bump size: %u (out of %u)", bumpSize, _m ) );
+    if ( _statistics )
+        _statistics->addBasisFactorizationBump( _m, bumpSize );
+
+    // Do the work on the remaining bump
     factorize();
 
     // DEBUG({
@@ -172,8 +311,8 @@ void SparseGaussianEliminator::run( const SparseColumnsOfBasis *A, SparseLUFacto
 
 void SparseGaussianEliminator::factorize()
 {
-    // Main factorization loop
-    for ( _eliminationStep = 0; _eliminationStep < _m; ++_eliminationStep )
+    // Main factorization loop, starting after the triangular pre-pass
+    for ( ; _eliminationStep < _m; ++_eliminationStep )
     {
         /*
           Step 1:
@@ -204,6 +343,120 @@ void SparseGaussianEliminator::factorize()
     }
 }
 
+void SparseGaussianEliminator::setPivot( unsigned vRow, unsigned vColumn, double value )
+{
+    _vPivotRow = vRow;
+    _vPivotColumn = vColumn;
+    _uPivotRow = _sparseLUFactors->_P._rowOrdering[vRow];
+    _uPivotColumn = _sparseLUFactors->_Q._columnOrdering[vColumn];
+    _pivotElement = value;
+}
+
+double SparseGaussianEliminator::getMaxInColumn( unsigned vColumn ) const
+{
+    const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+    unsigned nnz = sparseColumn->getNnz();
+
+    double maxInColumn = 0;
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        // Ignore entries that are not in the active submatrix
+        unsigned uRow = _sparseLUFactors->_P._rowOrdering[entry[i]._index];
+        if ( uRow < _eliminationStep )
+            continue;
+
+        double contender = FloatUtils::abs( entry[i]._value );
+        if ( FloatUtils::gt( contender, maxInColumn ) )
+            maxInColumn = contender;
+    }
+
+    return maxInColumn;
+}
+
+void SparseGaussianEliminator::considerPivotCandidate( unsigned vRow,
+                                                       unsigned vColumn,
+                                                       double value,
+                                                       unsigned &minimalCost,
+                                                       double &absPivotElement,
+                                                       bool &found )
+{
+    unsigned cost = ( _numVRowElements[vRow] - 1 ) * ( _numVColumnElements[vColumn] - 1 );
+    double absValue = FloatUtils::abs( value );
+
+    if ( !found ||
+         ( cost < minimalCost ) ||
+         ( ( cost == minimalCost ) && FloatUtils::gt( absValue, absPivotElement ) ) )
+    {
+        minimalCost = cost;
+        absPivotElement = absValue;
+        setPivot( vRow, vColumn, value );
+        found = true;
+    }
+}
+
+bool SparseGaussianEliminator::chooseSingletonRowPivot()
+{
+    if ( _rowBucketHead[1] == _m )
+        return false;
+
+    unsigned vRow = _rowBucketHead[1];
+
+    // Get the singleton element
+    const SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+
+    ASSERT( sparseRow->getNnz() == 1U );
+
+    const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+    setPivot( vRow, entry->_index, entry->_value );
+
+    log( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
+                  _vPivotRow,
+                  _vPivotColumn,
+                  _pivotElement ) );
+    return true;
+}
+
+bool SparseGaussianEliminator::chooseSingletonColumnPivot()
+{
+    if ( _columnBucketHead[1] == _m )
+        return false;
+
+    unsigned vColumn = _columnBucketHead[1];
+
+    // Get the singleton element
+    const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+    unsigned nnz = sparseColumn->getNnz();
+
+    // There may be some elements in higher rows - we need just the one
+    // in the active submatrix.
+
+    DEBUG( bool found = false; );
+
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned vRow = entry[i]._index;
+        unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+
+        if ( uRow >= _eliminationStep )
+        {
+            DEBUG( found = true; );
+
+            setPivot( vRow, vColumn, entry[i]._value );
+            break;
+        }
+    }
+
+    ASSERT( found );
+
+    log( Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
+                  _vPivotRow,
+                  _vPivotColumn,
+                  _pivotElement ) );
+    return true;
+}
+
 void SparseGaussianEliminator::choosePivot()
 {
     log( "Choose pivot invoked" );
@@ -215,6 +468,13 @@ void SparseGaussianEliminator::choosePivot()
       in the q'th column.
 
       We pick a pivot a_ij \neq 0 that minimizes (p_i - 1)(q_i - 1).
+
+      The rows and columns are bucketed by their number of non-zero
+      elements, so singletons are found immediately. Otherwise, we
+      follow Suhl and Suhl and search the sparsest columns and rows
+      first, stopping once no unexamined element can have a lower cost,
+      or once a candidate has been found and enough rows and columns
+      have been examined.
     */
 
     const SparseUnsortedArray *sparseRow;
@@ -222,151 +482,108 @@ void SparseGaussianEliminator::choosePivot()
     const SparseUnsortedArray::Entry *entry;
     unsigned nnz;
 
-    // If there's a singleton row, use it as the pivot row
-    for ( unsigned i = _eliminationStep; i < _m; ++i )
-    {
-        if ( _numURowElements[i] == 1 )
-        {
-            _uPivotRow = i;
-            _vPivotRow = _sparseLUFactors->_P._columnOrdering[i];
-
-            // Get the singleton element
-            sparseRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+    // An empty row or column in the active submatrix means the matrix is singular
+    if ( _columnBucketHead[0] != _m )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero column" );
 
-            ASSERT( sparseRow->getNnz() == 1U );
+    if ( _rowBucketHead[0] != _m )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero row" );
 
-            entry = sparseRow->getArray();
+    // If there's a singleton row, use it as the pivot row
+    if ( chooseSingletonRowPivot() )
+        return;
 
-            _vPivotColumn = entry->_index;
-            _uPivotColumn = _sparseLUFactors->_Q._columnOrdering[_vPivotColumn];
-            _pivotElement = entry->_value;
+    // If there's a singleton column, use it as the pivot column
+    if ( chooseSingletonColumnPivot() )
+        return;
 
-            log( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
-                          _vPivotRow,
-                          _vPivotColumn,
-                          _pivotElement ) );
-            return;
-        }
-    }
+    // No singletons, apply the Markowitz rule. Find the element with acceptable
+    // magnitude that has the smallet Markowitz value.
+    // Fail if no elements exists that are within acceptable magnitude
+    unsigned minimalCost = 0;
+    double absPivotElement = 0.0;
+    bool found = false;
+    unsigned examined = 0;
 
-    // If there's a singleton column, use it as the pivot column
-    for ( unsigned i = _eliminationStep; i < _m; ++i )
+    for ( unsigned count = 2; count <= _m; ++count )
     {
-        if ( _numUColumnElements[i] == 1 )
+        /*
+          Any element that hasn't been examined yet lies in a row and a
+          column with at least count non-zeros.
+        */
+        unsigned lowerBound = ( count - 1 ) * ( count - 1 );
+
+        // Columns with count non-zeros
+        for ( unsigned vColumn = _columnBucketHead[count];
+              vColumn != _m;
+              vColumn = _nextColumnInBucket[vColumn] )
         {
-            _uPivotColumn = i;
-            _vPivotColumn = _sparseLUFactors->_Q._rowOrdering[i];
+            if ( found && ( minimalCost <= lowerBound ) )
+                break;
+
+            double maxInColumn = getMaxInColumn( vColumn );
 
-            // Get the singleton element
-            sparseColumn = _sparseLUFactors->_Vt->getRow( _vPivotColumn );
+            sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
             entry = sparseColumn->getArray();
             nnz = sparseColumn->getNnz();
 
-            // There may be some elements in higher rows - we need just the one
-            // in the active submatrix.
-
-            DEBUG( bool found = false; );
-
             for ( unsigned i = 0; i < nnz; ++i )
             {
+                // Ignore entries that are not in the active submatrix
                 unsigned vRow = entry[i]._index;
-                unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+                if ( _sparseLUFactors->_P._rowOrdering[vRow] < _eliminationStep )
+                    continue;
 
-                if ( uRow >= _eliminationStep )
-                {
-                    DEBUG( found = true; );
-
-                    _vPivotRow = vRow;
-                    _uPivotRow = uRow;
-                    _pivotElement = entry[i]._value;
-
-                    break;
-                }
+                // Only consider large-enough elements
+                if ( FloatUtils::gt( FloatUtils::abs( entry[i]._value ),
+                                     maxInColumn * GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+                    considerPivotCandidate( vRow, vColumn, entry[i]._value, minimalCost, absPivotElement, found );
             }
 
-            ASSERT( found );
-
-            log( Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
-                          _vPivotRow,
-                          _vPivotColumn,
-                          _pivotElement ) );
-            return;
+            ++examined;
+            if ( found && ( examined >= GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) )
+                break;
         }
-    }
 
-    // No singletons, apply the Markowitz rule. Find the element with acceptable
-    // magnitude that has the smallet Markowitz value.
-    // Fail if no elements exists that are within acceptable magnitude
+        if ( found &&
+             ( ( minimalCost <= lowerBound ) ||
+               ( examined >= GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) ) )
+            break;
 
-    // Todo: more clever heuristics to reduce the search space
-    unsigned minimalCost = _m * _m;
-    _pivotElement = 0.0;
-    double absPivotElement = 0.0;
-
-    bool found = false;
-    for ( unsigned uColumn = _eliminationStep; uColumn < _m; ++uColumn )
-    {
-        unsigned vColumn = _sparseLUFactors->_Q._rowOrdering[uColumn];
-        sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
-
-        double maxInColumn = 0;
-        nnz = sparseColumn->getNnz();
-        entry = sparseColumn->getArray();
-
-        for ( unsigned i = 0; i < nnz; ++i )
-        {
-            // Ignore entrying that are not in the active submatrix
-            unsigned vRow = entry[i]._index;
-            unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
-            if ( uRow < _eliminationStep )
-                continue;
-
-            double contender = FloatUtils::abs( entry[i]._value );
-            if ( FloatUtils::gt( contender, maxInColumn ) )
-                maxInColumn = contender;
-        }
-
-        if ( FloatUtils::isZero( maxInColumn ) )
-        {
-            throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
-                                           "Have a zero column" );
-        }
-
-        for ( unsigned i = 0; i < nnz; ++i )
+        // Rows with count non-zeros
+        for ( unsigned vRow = _rowBucketHead[count];
+              vRow != _m;
+              vRow = _nextRowInBucket[vRow] )
         {
-            unsigned vRow = entry[i]._index;
-            unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+            if ( found && ( minimalCost <= lowerBound ) )
+                break;
 
-            // Ignore entrying that are not in the active submatrix
-            if ( uRow < _eliminationStep )
-                continue;
-
-            double contender = entry[i]._value;
-            double absContender = FloatUtils::abs( contender );
+            // All elements of an active row lie in the active submatrix
+            sparseRow = _sparseLUFactors->_V->getRow( vRow );
+            entry = sparseRow->getArray();
+            nnz = sparseRow->getNnz();
 
-            // Only consider large-enough elements
-            if ( FloatUtils::gt( absContender,
-                                 maxInColumn * GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+            for ( unsigned i = 0; i < nnz; ++i )
             {
-                unsigned cost = ( _numURowElements[uRow] - 1 ) * ( _numUColumnElements[uColumn] - 1 );
-
-                ASSERT( ( cost != minimalCost ) || found );
-
-                if ( ( cost < minimalCost ) ||
-                     ( ( cost == minimalCost ) && FloatUtils::gt( absContender, absPivotElement ) ) )
-                {
-                    minimalCost = cost;
-                    _uPivotRow = uRow;
-                    _uPivotColumn = uColumn;
-                    _vPivotRow = vRow;
-                    _vPivotColumn = vColumn;
-                    _pivotElement = contender;
-                    absPivotElement = absContender;
-
-                    found = true;
-                }
+                unsigned vColumn = entry[i]._index;
+
+                // Only consider large-enough elements
+                if ( FloatUtils::gt( FloatUtils::abs( entry[i]._value ),
+                                     getMaxInColumn( vColumn ) * GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+                    considerPivotCandidate( vRow, vColumn, entry[i]._value, minimalCost, absPivotElement, found );
             }
+
+            ++examined;
+            if ( found && ( examined >= GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) )
+                break;
         }
+
+        if ( found &&
+             ( ( minimalCost <= count * count ) ||
+               ( examined >= GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) ) )
+            break;
     }
 
     if ( !found )
@@ -385,20 +602,15 @@ void SparseGaussianEliminator::eliminate()
       We know that V[_vPivotRow, _vPivotColumn] = U[k,k].
     */
 
-    // Get the pivot row in dense format, due to repeated access
-    _sparseLUFactors->_V->getRowDense( _vPivotRow, _work );
+    excludePivotFromActiveSubmatrix();
 
     /*
-      The pivot row is not eliminated per se, but it is excluded
-      from the active submatrix, so we adjust the element counters
+      The pivot row is left untouched by the elimination, so we can
+      iterate over its sparse representation directly.
     */
-    _numURowElements[_eliminationStep] = 0;
-    for ( unsigned uColumn = _eliminationStep; uColumn < _m; ++uColumn )
-    {
-        unsigned vColumn = _sparseLUFactors->_Q._rowOrdering[uColumn];
-        if ( !FloatUtils::isZero( _work[vColumn] ) )
-            --_numUColumnElements[uColumn];
-    }
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+    const SparseUnsortedArray::Entry *pivotRowEntry = pivotRow->getArray();
+    unsigned pivotRowNnz = pivotRow->getNnz();
 
     // Process all rows below the pivot row
     SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( _vPivotColumn );
@@ -424,46 +636,46 @@ void SparseGaussianEliminator::eliminate()
         double rowMultiplier = - entry[index]._value / _pivotElement;
 
         // Get the row being eliminated in dense format
-        _sparseLUFactors->_V->getRowDense( vRow, _work2 );
+        _sparseLUFactors->_V->getRowDense( vRow, _work );
+
+        // The row's count is about to change, so take it out of its bucket
+        removeRowFromBucket( vRow );
 
         // Eliminate the sub-diagonal entry
-        --_numUColumnElements[_eliminationStep];
-        --_numURowElements[uRow];
+        --_numVRowElements[vRow];
         sparseColumn->erase( index );
-        _work2[_vPivotColumn] = 0;
+        _work[_vPivotColumn] = 0;
 
-        // Handle the rest of the row
-        for ( unsigned vColumnIndex = 0; vColumnIndex < _m; ++vColumnIndex )
+        // Handle the rest of the row. Only the columns where the pivot row is non-zero change.
+        for ( unsigned i = 0; i < pivotRowNnz; ++i )
         {
-            unsigned uColumnIndex = _sparseLUFactors->_Q._columnOrdering[vColumnIndex];
+            unsigned vColumnIndex = pivotRowEntry[i]._index;
 
             // Only care about the active submatirx
-            if ( uColumnIndex <= _eliminationStep )
+            if ( vColumnIndex == _vPivotColumn )
                 continue;
 
-            // If the value does not change, skip
-            if ( FloatUtils::isZero( _work[vColumnIndex] ) )
-                continue;
+            ASSERT( _sparseLUFactors->_Q._columnOrdering[vColumnIndex] > _eliminationStep );
 
             // Value will change
-            double oldValue = _work2[vColumnIndex];
+            double oldValue = _work[vColumnIndex];
             bool wasZero = FloatUtils::isZero( oldValue );
-            double newValue = oldValue + ( rowMultiplier * _work[vColumnIndex] );
+            double newValue = oldValue + ( rowMultiplier * pivotRowEntry[i]._value );
             bool isZero = FloatUtils::isZero( newValue );
 
             if ( !wasZero && isZero )
             {
                 newValue = 0;
-                --_numUColumnElements[uColumnIndex];
-                --_numURowElements[uRow];
+                adjustColumnCount( vColumnIndex, false );
+                --_numVRowElements[vRow];
             }
             else if ( wasZero && !isZero )
             {
-                ++_numUColumnElements[uColumnIndex];
-                ++_numURowElements[uRow];
+                adjustColumnCount( vColumnIndex, true );
+                ++_numVRowElements[vRow];
             }
 
-            _work2[vColumnIndex] = newValue;
+            _work[vColumnIndex] = newValue;
 
             // Transposed matrix is updated immediately, regular matrix will
             // be updated when entire row has been processed
@@ -471,7 +683,8 @@ void SparseGaussianEliminator::eliminate()
                 _sparseLUFactors->_Vt->set( vColumnIndex, vRow, newValue );
         }
 
-        _sparseLUFactors->_V->updateSingleRow( vRow, _work2 );
+        _sparseLUFactors->_V->updateSingleRow( vRow, _work );
+        addRowToBucket( vRow );
 
         /*
           Store the row multiplier in matrix F, using F = PLP'.
@@ -485,6 +698,94 @@ void SparseGaussianEliminator::eliminate()
     _sparseLUFactors->_vDiagonalElements[_vPivotRow] = _pivotElement;
 }
 
+void SparseGaussianEliminator::excludePivotFromActiveSubmatrix()
+{
+    removeRowFromBucket( _vPivotRow );
+    removeColumnFromBucket( _vPivotColumn );
+    _numVRowElements[_vPivotRow] = 0;
+    _numVColumnElements[_vPivotColumn] = 0;
+
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+    const SparseUnsortedArray::Entry *entry = pivotRow->getArray();
+    unsigned nnz = pivotRow->getNnz();
+
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned vColumn = entry[i]._index;
+        if ( vColumn != _vPivotColumn )
+            adjustColumnCount( vColumn, false );
+    }
+}
+
+void SparseGaussianEliminator::triangularize()
+{
+    /*
+      Column singletons are preferred, as they require no elimination
+      at all. A singleton row only removes one element from each of the
+      rows below it. Either way, no fill-in occurs, and so any singletons
+      that this creates are picked up in the following iterations.
+    */
+    while ( _eliminationStep < _m )
+    {
+        // An empty row or column is reported by the general pivot search
+        if ( ( _rowBucketHead[0] != _m ) || ( _columnBucketHead[0] != _m ) )
+            return;
+
+        if ( !chooseSingletonColumnPivot() && !chooseSingletonRowPivot() )
+            return;
+
+        permute();
+        eliminateTriangular();
+        ++_eliminationStep;
+    }
+}
+
+void SparseGaussianEliminator::eliminateTriangular()
+{
+    unsigned fColumn = _sparseLUFactors->_P._columnOrdering[_eliminationStep];
+
+    excludePivotFromActiveSubmatrix();
+
+    /*
+      If the pivot is a column singleton, there is nothing below it.
+      Otherwise it is a row singleton, and the rows below only lose
+      their element in the pivot column, which we can erase in place.
+    */
+    SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( _vPivotColumn );
+    unsigned index = 0;
+
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+
+    while ( index < sparseColumn->getNnz() )
+    {
+        unsigned vRow = entry[index]._index;
+        unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+
+        if ( uRow <= _eliminationStep )
+        {
+            ++index;
+            continue;
+        }
+
+        ASSERT( _sparseLUFactors->_V->getRow( _vPivotRow )->getNnz() == 1U );
+
+        double rowMultiplier = - entry[index]._value / _pivotElement;
+
+        removeRowFromBucket( vRow );
+        --_numVRowElements[vRow];
+        addRowToBucket( vRow );
+
+        sparseColumn->erase( index );
+        _sparseLUFactors->_V->set( vRow, _vPivotColumn, 0 );
+
+        _sparseLUFactors->_F->set( vRow, fColumn, -rowMultiplier );
+        _sparseLUFactors->_Ft->set( fColumn, vRow, -rowMultiplier );
+    }
+
+    // Store the pivot element
+    _sparseLUFactors->_vDiagonalElements[_vPivotRow] = _pivotElement;
+}
+
 void SparseGaussianEliminator::log( const String &message )
 {
     if ( GlobalConfiguration::GAUSSIAN_ELIMINATION_LOGGING )
@@ -64,7 +64,6 @@ private:
       Work memory
     */
     double *_work;
-    double *_work2;
 
     /*
       An object for reporting statistics
@@ -72,11 +71,55 @@ private:
     Statistics *_statistics;
 
     /*
-      Information on the number of non-zero elements in
-      every row of the current active submatrix of U
+      Information on the number of non-zero elements in every row and
+      column of the current active submatrix. These are indexed by V's
+      rows and columns, which do not move when P and Q are updated.
     */
-    unsigned *_numURowElements;
-    unsigned *_numUColumnElements;
+    unsigned *_numVRowElements;
+    unsigned *_numVColumnElements;
+
+    /*
+      The rows and columns of the active submatrix, bucketed according
+      to their number of non-zero elements. Each bucket is a doubly
+      linked list threaded through the next/previous arrays, and _m
+      serves as the null index. Buckets are kept up-to-date during
+      elimination, so that the pivot search can examine the sparsest
+      rows and columns first.
+    */
+    unsigned *_rowBucketHead;
+    unsigned *_nextRowInBucket;
+    unsigned *_previousRowInBucket;
+    unsigned *_columnBucketHead;
+    unsigned *_nextColumnInBucket;
+    unsigned *_previousColumnInBucket;
+
+    void initializeBuckets();
+    void addRowToBucket( unsigned vRow );
+    void removeRowFromBucket( unsigned vRow );
+    void addColumnToBucket( unsigned vColumn );
+    void removeColumnFromBucket( unsigned vColumn );
+    void adjustColumnCount( unsigned vColumn, bool increase );
+
+    /*
+      Helpers for the Markowitz search: find the largest element (in
+      absolute value) of a column of the active submatrix, and check
+      whether an element is a better pivot than the best one found so far.
+    */
+    double getMaxInColumn( unsigned vColumn ) const;
+    void considerPivotCandidate( unsigned vRow,
+                                 unsigned vColumn,
+                                 double value,
+                                 unsigned &minimalCost,
+                                 double &absPivotElement,
+                                 bool &found );
+    void setPivot( unsigned vRow, unsigned vColumn, double value );
+
+    /*
+      Pick a singleton column or a singleton row of the active
+      submatrix as the pivot, if one exists.
+    */
+    bool chooseSingletonColumnPivot();
+    bool chooseSingletonRowPivot();
 
     void choosePivot();
     void initializeFactorization( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors );
@@ -84,6 +127,21 @@ private:
     void permute();
     void eliminate();
 
+    /*
+      The triangular pre-pass: repeatedly pivot on singleton columns
+      and rows, which requires no numeric elimination and causes no
+      fill-in. What remains afterwards is the bump, which is handed to
+      the general elimination loop.
+    */
+    void triangularize();
+    void eliminateTriangular();
+
+    /*
+      Remove the pivot row and column from the active submatrix,
+      adjusting the element counters and the buckets.
+    */
+    void excludePivotFromActiveSubmatrix();
+
     void log( const String &message );
 };
 
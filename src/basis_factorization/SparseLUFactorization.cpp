@@ -178,6 +178,11 @@ void SparseLUFactorization::factorizeBasis()
     }
 }
 
+void SparseLUFactorization::setStatistics( Statistics *statistics )
+{
+    _sparseGaussianEliminator.setStatistics( statistics );
+}
+
 void SparseLUFactorization::storeFactorization( IBasisFactorization *other )
 {
     SparseLUFactorization *otherSparseLUFactorization = (SparseLUFactorization *)other;
@@ -113,6 +113,11 @@ public:
     const double *getBasis() const;
     const SparseMatrix *getSparseBasis() const;
 
+    /*
+      Have the Basis Factoriaztion object start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
 public:
     /*
       Functions made public strictly for testing, not part of the interface
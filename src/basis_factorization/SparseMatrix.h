@@ -25,9 +25,11 @@ public:
 
     /*
       Initialize the sparse matrix from a given dense matrix
-      M of dimensions m x n, or an empty matrix
+      M of dimensions m x n, from m sparse rows of dimension n,
+      or an empty matrix
     */
     virtual void initialize( const double *M, unsigned m, unsigned n ) = 0;
+    virtual void initialize( const SparseUnsortedList * const *rows, unsigned m, unsigned n ) = 0;
     virtual void initializeToEmpty( unsigned m, unsigned n ) = 0;
 
     /*
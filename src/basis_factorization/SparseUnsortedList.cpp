@@ -12,35 +12,96 @@
  ** [[ Add lengthier description here ]]
 
  **/
-
 #include "BasisFactorizationError.h"
 #include "Debug.h"
 #include "FloatUtils.h"
 #include "SparseUnsortedList.h"
 
+#include <cstring>
+
 SparseUnsortedList::SparseUnsortedList()
     : _size( 0 )
+    , _array( NULL )
+    , _allocatedSize( 0 )
+    , _nnz( 0 )
 {
 }
 
 SparseUnsortedList::SparseUnsortedList( unsigned size )
     : _size( size )
+    , _array( NULL )
+    , _allocatedSize( 0 )
+    , _nnz( 0 )
 {
 }
 
 SparseUnsortedList::SparseUnsortedList( const double *V, unsigned size )
+    : _size( 0 )
+    , _array( NULL )
+    , _allocatedSize( 0 )
+    , _nnz( 0 )
 {
     initialize( V, size );
 }
 
+SparseUnsortedList::SparseUnsortedList( const SparseUnsortedList &other )
+    : _size( 0 )
+    , _array( NULL )
+    , _allocatedSize( 0 )
+    , _nnz( 0 )
+{
+    other.storeIntoOther( this );
+}
+
 SparseUnsortedList::~SparseUnsortedList()
 {
+    freeMemoryIfNeeded();
+}
+
+void SparseUnsortedList::freeMemoryIfNeeded()
+{
+    if ( _array )
+    {
+        delete[] _array;
+        _array = NULL;
+    }
+
+    _allocatedSize = 0;
+}
+
+void SparseUnsortedList::ensureCapacity( unsigned capacity )
+{
+    if ( capacity <= _allocatedSize )
+        return;
+
+    unsigned newAllocatedSize = ( _allocatedSize == 0 ) ? (unsigned)CHUNK_SIZE : _allocatedSize;
+    while ( newAllocatedSize < capacity )
+        newAllocatedSize *= 2;
+
+    Entry *newArray = new Entry[newAllocatedSize];
+    if ( !newArray )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseUnsortedList::array" );
+
+    if ( _array )
+    {
+        memcpy( newArray, _array, sizeof(Entry) * _nnz );
+        delete[] _array;
+    }
+
+    _array = newArray;
+    _allocatedSize = newAllocatedSize;
+}
+
+void SparseUnsortedList::increaseCapacity()
+{
+    ensureCapacity( _allocatedSize + 1 );
 }
 
 void SparseUnsortedList::initialize( const double *V, unsigned size )
 {
     _size = size;
-    _list.clear();
+    _nnz = 0;
 
     for ( unsigned i = 0; i < _size; ++i )
     {
@@ -48,31 +109,31 @@ void SparseUnsortedList::initialize( const double *V, unsigned size )
         if ( FloatUtils::isZero( V[i] ) )
             continue;
 
-        _list.append( Entry( i, V[i] ) );
+        append( i, V[i] );
     }
 }
 
 void SparseUnsortedList::clear()
 {
-    _list.clear();
+    _nnz = 0;
 }
 
 unsigned SparseUnsortedList::getNnz() const
 {
-    return _list.size();
+    return _nnz;
 }
 
 bool SparseUnsortedList::empty() const
 {
-    return _list.empty();
+    return _nnz == 0;
 }
 
 double SparseUnsortedList::get( unsigned entry ) const
 {
-    for ( const auto &listEntry : _list )
+    for ( unsigned i = 0; i < _nnz; ++i )
     {
-        if ( listEntry._index == entry )
-            return listEntry._value;
+        if ( _array[i]._index == entry )
+            return _array[i]._value;
     }
 
     return 0;
@@ -80,8 +141,8 @@ double SparseUnsortedList::get( unsigned entry ) const
 
 void SparseUnsortedList::dump() const
 {
-    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", _list.size() );
-    for ( const auto &entry : _list )
+    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", _nnz );
+    for ( const auto &entry : *this )
         printf( "\tEntry %u: %6.2lf\n", entry._index, entry._value );
     printf( "\n" );
 }
@@ -101,14 +162,14 @@ void SparseUnsortedList::toDense( double *result ) const
 {
     std::fill_n( result, _size, 0 );
 
-    for ( const auto &entry : _list )
-        result[entry._index] = entry._value;
+    for ( unsigned i = 0; i < _nnz; ++i )
+        result[_array[i]._index] = _array[i]._value;
 }
 
 SparseUnsortedList &SparseUnsortedList::operator=( const SparseUnsortedList &other )
 {
-    _size = other._size;
-    _list = other._list;
+    if ( this != &other )
+        other.storeIntoOther( this );
 
     return *this;
 }
@@ -116,27 +177,32 @@ SparseUnsortedList &SparseUnsortedList::operator=( const SparseUnsortedList &oth
 void SparseUnsortedList::storeIntoOther( SparseUnsortedList *other ) const
 {
     other->_size = _size;
-    other->_list = _list;
+    other->_nnz = 0;
+    other->ensureCapacity( _nnz );
+
+    if ( _nnz > 0 )
+        memcpy( other->_array, _array, sizeof(Entry) * _nnz );
+    other->_nnz = _nnz;
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::begin() const
+SparseUnsortedList::const_iterator SparseUnsortedList::begin() const
 {
-    return _list.begin();
+    return _array;
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::end() const
+SparseUnsortedList::const_iterator SparseUnsortedList::end() const
 {
-    return _list.end();
+    return _array + _nnz;
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::begin()
+SparseUnsortedList::iterator SparseUnsortedList::begin()
 {
-    return _list.begin();
+    return _array;
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::end()
+SparseUnsortedList::iterator SparseUnsortedList::end()
 {
-    return _list.end();
+    return _array + _nnz;
 }
 
 void SparseUnsortedList::set( unsigned index, double value )
@@ -148,7 +214,7 @@ void SparseUnsortedList::set( unsigned index, double value )
         if ( it->_index == index )
         {
             if ( isZero )
-                _list.erase( it );
+                erase( it );
             else
                 it->_value = value;
 
@@ -157,18 +223,22 @@ void SparseUnsortedList::set( unsigned index, double value )
     }
 
     if ( !isZero )
-        _list.append( Entry( index, value ) );
+        append( index, value );
 }
 
 void SparseUnsortedList::append( unsigned index, double value )
 {
-    _list.append( Entry( index, value ) );
+    if ( _nnz == _allocatedSize )
+        increaseCapacity();
+
+    _array[_nnz] = Entry( index, value );
+    ++_nnz;
 }
 
 void SparseUnsortedList::addLastEntry( double entry )
 {
     if ( !FloatUtils::isZero( entry ) )
-        _list.append( Entry( _size, entry ) );
+        append( _size, entry );
 
     ++_size;
 }
@@ -180,49 +250,65 @@ void SparseUnsortedList::incrementSize()
 
 void SparseUnsortedList::mergeEntries( unsigned source, unsigned target )
 {
-    List<Entry>::iterator sourceIt = _list.end();
-    List<Entry>::iterator targetIt = _list.end();
-    List<Entry>::iterator it;
+    // Work with positions, as erasing moves entries around
+    unsigned sourcePosition = _nnz;
+    unsigned targetPosition = _nnz;
 
-    for ( it = _list.begin(); it != _list.end(); ++it )
+    for ( unsigned i = 0; i < _nnz; ++i )
     {
-        if ( it->_index == source )
+        if ( _array[i]._index == source )
         {
-            sourceIt = it;
-            if ( targetIt != _list.end() )
+            sourcePosition = i;
+            if ( targetPosition != _nnz )
                 break;
         }
 
-        if ( it->_index == target )
+        if ( _array[i]._index == target )
         {
-            targetIt = it;
-            if ( sourceIt != _list.end() )
+            targetPosition = i;
+            if ( sourcePosition != _nnz )
                 break;
         }
     }
 
     // If no source entry exists, we are done
-    if ( sourceIt == _list.end() )
+    if ( sourcePosition == _nnz )
         return;
 
     // If no target entry, simply change index on source entry
-    if ( targetIt == _list.end() )
+    if ( targetPosition == _nnz )
     {
-        sourceIt->_index = target;
+        _array[sourcePosition]._index = target;
         return;
     }
 
     // Both source and target entries
-    targetIt->_value += sourceIt->_value;
+    _array[targetPosition]._value += _array[sourcePosition]._value;
+    bool targetIsZero = FloatUtils::isZero( _array[targetPosition]._value );
 
-    _list.erase( sourceIt );
-    if ( FloatUtils::isZero( targetIt->_value ) )
-         _list.erase( targetIt );
+    // Erase the entry at the higher position first, so that the other
+    // entry is not moved
+    if ( targetIsZero && targetPosition > sourcePosition )
+    {
+        erase( _array + targetPosition );
+        erase( _array + sourcePosition );
+    }
+    else
+    {
+        erase( _array + sourcePosition );
+        if ( targetIsZero )
+            erase( _array + targetPosition );
+    }
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::erase( List<SparseUnsortedList::Entry>::iterator it )
+SparseUnsortedList::iterator SparseUnsortedList::erase( SparseUnsortedList::iterator it )
 {
-    return _list.erase( it );
+    ASSERT( ( begin() <= it ) && ( it < end() ) );
+
+    --_nnz;
+    *it = _array[_nnz];
+
+    return it;
 }
 
 unsigned SparseUnsortedList::getSize() const
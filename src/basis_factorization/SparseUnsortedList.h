@@ -24,6 +24,12 @@ class SparseUnsortedList
 public:
     struct Entry
     {
+        Entry()
+            : _index( 0 )
+            , _value( 0 )
+        {
+        }
+
         Entry( unsigned index, double value )
             : _index( index )
             , _value( value )
@@ -44,6 +50,7 @@ public:
     SparseUnsortedList();
     ~SparseUnsortedList();
     SparseUnsortedList( unsigned size );
+    SparseUnsortedList( const SparseUnsortedList &other );
     SparseUnsortedList( const double *V, unsigned size );
     void initialize( const double *V, unsigned size );
     void initializeToEmpty();
@@ -91,17 +98,23 @@ public:
     void storeIntoOther( SparseUnsortedList *other ) const;
 
     /*
-      Retrieve entries
+      Retrieve entries. The entries are stored contiguously, so the
+      iterators are plain pointers.
     */
-    List<Entry>::const_iterator begin() const;
-    List<Entry>::const_iterator end() const;
-    List<Entry>::iterator begin();
-    List<Entry>::iterator end();
+    typedef Entry *iterator;
+    typedef const Entry *const_iterator;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    iterator begin();
+    iterator end();
 
     /*
-      Erasing an element by iterator
+      Erasing an element by iterator. The last entry is moved into the
+      erased entry's place, and the returned iterator points to it (or
+      to end(), if the erased entry was the last).
     */
-    List<Entry>::iterator erase( List<Entry>::iterator it );
+    iterator erase( iterator it );
 
     /*
       Addes the coefficient for entry 'source' to entry 'target'
@@ -122,7 +135,23 @@ public:
 
 private:
     unsigned _size;
-    List<Entry> _list;
+
+    /*
+      The non-zero entries are stored in the first _nnz cells of the
+      array
+    */
+    Entry *_array;
+    unsigned _allocatedSize;
+    unsigned _nnz;
+
+    // The initial capacity. When exceeded, the capacity is doubled.
+    enum {
+        CHUNK_SIZE = 20,
+    };
+
+    void freeMemoryIfNeeded();
+    void ensureCapacity( unsigned capacity );
+    void increaseCapacity();
 };
 
 #endif // __SparseUnsortedList_h__
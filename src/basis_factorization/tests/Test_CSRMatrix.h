@@ -101,6 +101,46 @@ public:
                 TS_ASSERT_EQUALS( csr1.get( i, j ), csr3.get( i, j ) );
     }
 
+    void test_initialize_from_sparse_rows()
+    {
+        double M1[] = {
+            0, 0, 0, 0,
+            5, 8, 0, 0,
+            0, 0, 3, 0,
+            0, 6, 0, 0,
+        };
+
+        // Rows are given with their entries out of order
+        SparseUnsortedList *rows[4];
+        rows[0] = new SparseUnsortedList( 4 );
+        rows[1] = new SparseUnsortedList( 4 );
+        rows[1]->append( 1, 8 );
+        rows[1]->append( 0, 5 );
+        rows[2] = new SparseUnsortedList( 4 );
+        rows[2]->append( 2, 3 );
+        rows[3] = new SparseUnsortedList( 4 );
+        rows[3]->append( 1, 6 );
+
+        CSRMatrix csr1;
+        TS_ASSERT_THROWS_NOTHING( csr1.initialize( rows, 4, 4 ) );
+        TS_ASSERT_EQUALS( csr1.getNnz(), 4U );
+
+        CSRMatrix csr2( M1, 4, 4 );
+        for ( unsigned i = 0; i < 4; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( csr1.get( i, j ), csr2.get( i, j ) );
+
+        // The matrix can still grow
+        double row[] = { 1, 0, 0, 2 };
+        TS_ASSERT_THROWS_NOTHING( csr1.addLastRow( row ) );
+        TS_ASSERT_EQUALS( csr1.get( 4, 0 ), 1.0 );
+        TS_ASSERT_EQUALS( csr1.get( 4, 3 ), 2.0 );
+        TS_ASSERT_EQUALS( csr1.get( 1, 1 ), 8.0 );
+
+        for ( unsigned i = 0; i < 4; ++i )
+            delete rows[i];
+    }
+
     void test_add_last_row()
     {
         double M1[] = {
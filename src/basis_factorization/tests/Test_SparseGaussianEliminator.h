@@ -334,6 +334,150 @@ public:
             TS_ASSERT_THROWS_NOTHING( delete ge );
         }
     }
+
+    void test_triangular_pre_pass()
+    {
+        SparseLUFactors lu4( 4 );
+
+        {
+            // A permuted triangular matrix: the pre-pass handles all of it
+            double A[] =
+            {
+                0, 3, 0, 1,
+                2, 0, 0, 0,
+                1, 0, 0, 5,
+                0, 1, 7, 2,
+            };
+
+            SparseColumnsOfBasis sparseCols( 4 );
+            basisIntoSparseColumns( A, 4, sparseCols );
+
+            Statistics statistics;
+            SparseGaussianEliminator *ge = NULL;
+
+            TS_ASSERT( ge = new SparseGaussianEliminator( 4 ) );
+            ge->setStatistics( &statistics );
+            TS_ASSERT_THROWS_NOTHING( ge->run( &sparseCols, &lu4 ) );
+
+            TS_ASSERT_EQUALS( statistics.getMaxBasisBumpSize(), 0U );
+
+            double result[16];
+            computeMatrixFromFactorization( &lu4, result );
+
+            for ( unsigned i = 0; i < 16; ++i )
+                TS_ASSERT( FloatUtils::areEqual( A[i], result[i] ) );
+
+            double At[16];
+            transposeMatrix( A, At, 4 );
+            computeTransposedMatrixFromFactorization( &lu4, result );
+
+            for ( unsigned i = 0; i < 16; ++i )
+                TS_ASSERT( FloatUtils::areEqual( At[i], result[i] ) );
+
+            TS_ASSERT_THROWS_NOTHING( delete ge );
+        }
+
+        {
+            // A slack column and a singleton row, around a 2x2 bump
+            double A[] =
+            {
+                1, 0, 2, 3,
+                0, 0, 4, -1,
+                0, 5, 0, 0,
+                0, 1, 1, 1,
+            };
+
+            SparseColumnsOfBasis sparseCols( 4 );
+            basisIntoSparseColumns( A, 4, sparseCols );
+
+            Statistics statistics;
+            SparseGaussianEliminator *ge = NULL;
+
+            TS_ASSERT( ge = new SparseGaussianEliminator( 4 ) );
+            ge->setStatistics( &statistics );
+            TS_ASSERT_THROWS_NOTHING( ge->run( &sparseCols, &lu4 ) );
+
+            TS_ASSERT_EQUALS( statistics.getMaxBasisBumpSize(), 2U );
+            TS_ASSERT_EQUALS( statistics.getTotalBasisBumpSize(), 2U );
+
+            double result[16];
+            computeMatrixFromFactorization( &lu4, result );
+
+            for ( unsigned i = 0; i < 16; ++i )
+                TS_ASSERT( FloatUtils::areEqual( A[i], result[i] ) );
+
+            double At[16];
+            transposeMatrix( A, At, 4 );
+            computeTransposedMatrixFromFactorization( &lu4, result );
+
+            for ( unsigned i = 0; i < 16; ++i )
+                TS_ASSERT( FloatUtils::areEqual( At[i], result[i] ) );
+
+            TS_ASSERT_THROWS_NOTHING( delete ge );
+        }
+    }
+
+    void test_larger_sparse_matrices()
+    {
+        /*
+          Permuted, diagonally dominant sparse matrices with a few
+          off-diagonal entries per row. These exercise the bucketed
+          pivot search over many elimination steps, including fill-in.
+        */
+        const unsigned m = 40;
+        SparseLUFactors lu( m );
+
+        srand( 1234 );
+
+        for ( unsigned iteration = 0; iteration < 5; ++iteration )
+        {
+            double A[m * m];
+            std::fill_n( A, m * m, 0.0 );
+
+            unsigned rowPermutation[m];
+            for ( unsigned i = 0; i < m; ++i )
+                rowPermutation[i] = i;
+            for ( unsigned i = m - 1; i > 0; --i )
+            {
+                unsigned j = rand() % ( i + 1 );
+                unsigned temp = rowPermutation[i];
+                rowPermutation[i] = rowPermutation[j];
+                rowPermutation[j] = temp;
+            }
+
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                unsigned row = rowPermutation[i];
+                A[row * m + i] = 10 + ( rand() % 10 );
+
+                for ( unsigned k = 0; k < 3; ++k )
+                    A[row * m + ( rand() % m )] += ( rand() % 5 ) - 2;
+            }
+
+            SparseColumnsOfBasis sparseCols( m );
+            basisIntoSparseColumns( A, m, sparseCols );
+
+            SparseGaussianEliminator *ge = NULL;
+
+            TS_ASSERT( ge = new SparseGaussianEliminator( m ) );
+            TS_ASSERT_THROWS_NOTHING( ge->run( &sparseCols, &lu ) );
+
+            double result[m * m];
+            computeMatrixFromFactorization( &lu, result );
+
+            for ( unsigned i = 0; i < m * m; ++i )
+                TS_ASSERT( FloatUtils::areEqual( A[i], result[i] ) );
+
+            double At[m * m];
+            transposeMatrix( A, At, m );
+            computeTransposedMatrixFromFactorization( &lu, result );
+
+            for ( unsigned i = 0; i < m * m; ++i )
+                TS_ASSERT( FloatUtils::areEqual( At[i], result[i] ) );
+
+            TS_ASSERT_THROWS_NOTHING( delete ge );
+        }
+    }
 };
 
 //
@@ -174,6 +174,72 @@ public:
 
         TS_ASSERT_EQUALS( v1.getNnz(), 0U );
     }
+
+    void test_erase_while_iterating()
+    {
+        double dense[8] = {
+            1, 2, 3, 0, 0, 4, 5, 6
+        };
+
+        SparseUnsortedList v1( dense, 8 );
+
+        // Erase the odd values
+        auto it = v1.begin();
+        while ( it != v1.end() )
+        {
+            if ( ( (int)it->_value ) % 2 == 1 )
+                it = v1.erase( it );
+            else
+                ++it;
+        }
+
+        TS_ASSERT_EQUALS( v1.getNnz(), 3U );
+
+        double result[8];
+        TS_ASSERT_THROWS_NOTHING( v1.toDense( result ) );
+
+        double expected[8] = {
+            0, 2, 0, 0, 0, 4, 0, 6
+        };
+
+        for ( unsigned i = 0; i < 8; ++i )
+            TS_ASSERT( FloatUtils::areEqual( expected[i], result[i] ) );
+    }
+
+    void test_copy_and_growth()
+    {
+        SparseUnsortedList v1( 0 );
+
+        // Grow well beyond the initial capacity
+        for ( unsigned i = 0; i < 100; ++i )
+            TS_ASSERT_THROWS_NOTHING( v1.addLastEntry( ( i % 3 == 0 ) ? 0 : i ) );
+
+        TS_ASSERT_EQUALS( v1.getSize(), 100U );
+        TS_ASSERT_EQUALS( v1.getNnz(), 66U );
+
+        SparseUnsortedList v2( v1 );
+        SparseUnsortedList v3;
+        v3 = v1;
+        SparseUnsortedList v4( 5 );
+        v4.set( 2, 7 );
+        v1.storeIntoOther( &v4 );
+
+        // The copies are independent of the original
+        v1.clear();
+        TS_ASSERT( v1.empty() );
+
+        TS_ASSERT_EQUALS( v2.getSize(), 100U );
+        TS_ASSERT_EQUALS( v3.getSize(), 100U );
+        TS_ASSERT_EQUALS( v4.getSize(), 100U );
+
+        for ( unsigned i = 0; i < 100; ++i )
+        {
+            double expected = ( i % 3 == 0 ) ? 0 : i;
+            TS_ASSERT_EQUALS( v2.get( i ), expected );
+            TS_ASSERT_EQUALS( v3.get( i ), expected );
+            TS_ASSERT_EQUALS( v4.get( i ), expected );
+        }
+    }
 };
 
 //
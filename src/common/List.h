@@ -50,6 +50,11 @@ public:
         _container.push_back( value );
     }
 
+    void append( T &&value )
+    {
+        _container.push_back( std::move( value ) );
+    }
+
     void appendHead( const T &value )
     {
         _container.push_front( value );
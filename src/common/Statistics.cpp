@@ -26,6 +26,8 @@ Statistics::Statistics()
     , _currentDegradation( 0.0 )
     , _maxDegradation( 0.0 )
     , _numPrecisionRestorations( 0 )
+    , _numAssignmentRefinements( 0 )
+    , _numSuccessfulAssignmentRefinements( 0 )
     , _numSimplexSteps( 0 )
     , _timeSimplexStepsMicro( 0 )
     , _timeMainLoopMicro( 0 )
@@ -35,6 +37,12 @@ Statistics::Statistics()
     , _maxStackDepth( 0 )
     , _numSplits( 0 )
     , _numPops( 0 )
+    , _numLearnedConflictsPublished( 0 )
+    , _numLearnedConflictPrunings( 0 )
+    , _numDonatedSplits( 0 )
+    , _numSearchNodesAllocated( 0 )
+    , _numSearchNodesReused( 0 )
+    , _searchNodeStorageBytes( 0 )
     , _numVisitedTreeStates( 1 )
     , _numTableauPivots( 0 )
     , _numTableauDegeneratePivots( 0 )
@@ -58,6 +66,10 @@ Statistics::Statistics()
     , _numBoundTighteningsOnConstraintMatrix( 0 )
     , _numTighteningsFromConstraintMatrix( 0 )
     , _numBasisRefactorizations( 0 )
+    , _numBasisBumps( 0 )
+    , _totalFactorizedBasisSize( 0 )
+    , _totalBasisBumpSize( 0 )
+    , _maxBasisBumpSize( 0 )
     , _pseNumIterations( 0 )
     , _pseNumResetReferenceSpace( 0 )
     , _ppNumEliminatedVars( 0 )
@@ -219,6 +231,10 @@ void Statistics::print()
             , _maxDegradation
             , _numPrecisionRestorations
             );
+    printf( "\tAssignment refinements: %u. Refinements that avoided restoration: %u\n"
+            , _numAssignmentRefinements
+            , _numSuccessfulAssignmentRefinements
+            );
     printf( "\tNumber of simplex pivots we attempted to skip because of instability: %llu.\n"
             "\tUnstable pivots performed anyway: %llu\n"
             , _numSimplexPivotSelectionsIgnoredForStability
@@ -254,6 +270,15 @@ void Statistics::print()
             , _numPops );
     printf( "\tMax stack depth: %u\n"
             , _maxStackDepth );
+    printf( "\tLearned conflicts published: %u. States pruned by learned conflicts: %u\n"
+            , _numLearnedConflictsPublished
+            , _numLearnedConflictPrunings );
+    printf( "\tSplits donated to other workers: %u\n"
+            , _numDonatedSplits );
+    printf( "\tSearch nodes allocated: %u. Search nodes reused: %u. Bytes per node state: %llu\n"
+            , _numSearchNodesAllocated
+            , _numSearchNodesReused
+            , _searchNodeStorageBytes );
 
     printf( "\t--- Bound Tightening Statistics ---\n" );
     printf( "\tNumber of tightened bounds: %llu.\n", _numTightenedBounds );
@@ -277,6 +302,10 @@ void Statistics::print()
     printf( "\t--- Basis Factorization statistics ---\n" );
     printf( "\tNumber of basis refactorizations: %llu\n",
             _numBasisRefactorizations );
+    printf( "\tTriangular pre-pass: average bump size: %.2lf (%.2lf%% of the basis). Max bump size: %u\n"
+            , printAverage( _totalBasisBumpSize, _numBasisBumps )
+            , printPercents( _totalBasisBumpSize, _totalFactorizedBasisSize )
+            , _maxBasisBumpSize );
 
     printf( "\t--- Projected Steepest Edge Statistics ---\n" );
     printf( "\tNumber of iterations: %llu.\n", _pseNumIterations );
@@ -340,6 +369,16 @@ void Statistics::incNumPrecisionRestorations()
     ++_numPrecisionRestorations;
 }
 
+void Statistics::incNumAssignmentRefinements()
+{
+    ++_numAssignmentRefinements;
+}
+
+void Statistics::incNumSuccessfulAssignmentRefinements()
+{
+    ++_numSuccessfulAssignmentRefinements;
+}
+
 void Statistics::addTimeSimplexSteps( unsigned long long time )
 {
     _timeSimplexStepsMicro += time;
@@ -393,6 +432,46 @@ unsigned Statistics::getNumPops() const
     return _numPops;
 }
 
+void Statistics::incNumLearnedConflictsPublished()
+{
+    ++_numLearnedConflictsPublished;
+}
+
+void Statistics::incNumLearnedConflictPrunings()
+{
+    ++_numLearnedConflictPrunings;
+}
+
+void Statistics::incNumDonatedSplits()
+{
+    ++_numDonatedSplits;
+}
+
+void Statistics::incNumSearchNodesAllocated()
+{
+    ++_numSearchNodesAllocated;
+}
+
+void Statistics::incNumSearchNodesReused()
+{
+    ++_numSearchNodesReused;
+}
+
+void Statistics::setSearchNodeStorageBytes( unsigned long long bytes )
+{
+    _searchNodeStorageBytes = bytes;
+}
+
+unsigned Statistics::getNumSearchNodesAllocated() const
+{
+    return _numSearchNodesAllocated;
+}
+
+unsigned Statistics::getNumSearchNodesReused() const
+{
+    return _numSearchNodesReused;
+}
+
 void Statistics::incNumTableauPivots()
 {
     ++_numTableauPivots;
@@ -502,6 +581,26 @@ void Statistics::incNumBasisRefactorizations()
     ++_numBasisRefactorizations;
 }
 
+void Statistics::addBasisFactorizationBump( unsigned basisSize, unsigned bumpSize )
+{
+    ++_numBasisBumps;
+    _totalFactorizedBasisSize += basisSize;
+    _totalBasisBumpSize += bumpSize;
+
+    if ( bumpSize > _maxBasisBumpSize )
+        _maxBasisBumpSize = bumpSize;
+}
+
+unsigned Statistics::getMaxBasisBumpSize() const
+{
+    return _maxBasisBumpSize;
+}
+
+unsigned long long Statistics::getTotalBasisBumpSize() const
+{
+    return _totalBasisBumpSize;
+}
+
 void Statistics::pseIncNumIterations()
 {
     ++_pseNumIterations;
@@ -625,6 +724,16 @@ unsigned Statistics::getNumPrecisionRestorations() const
     return _numPrecisionRestorations;
 }
 
+unsigned Statistics::getNumAssignmentRefinements() const
+{
+    return _numAssignmentRefinements;
+}
+
+unsigned Statistics::getNumSuccessfulAssignmentRefinements() const
+{
+    return _numSuccessfulAssignmentRefinements;
+}
+
 unsigned long long Statistics::getTimeSimplexStepsMicro() const
 {
     return _timeSimplexStepsMicro;
@@ -663,6 +772,77 @@ unsigned long long Statistics::getTotalTime() const
     return total / 1000;
 }
 
+void Statistics::aggregate( const Statistics &other )
+{
+    _preprocessingTimeMicro += other._preprocessingTimeMicro;
+    _numMainLoopIterations += other._numMainLoopIterations;
+    _numPrecisionRestorations += other._numPrecisionRestorations;
+    _numAssignmentRefinements += other._numAssignmentRefinements;
+    _numSuccessfulAssignmentRefinements += other._numSuccessfulAssignmentRefinements;
+    _numSimplexSteps += other._numSimplexSteps;
+    _timeSimplexStepsMicro += other._timeSimplexStepsMicro;
+    _timeMainLoopMicro += other._timeMainLoopMicro;
+    _timeConstraintFixingStepsMicro += other._timeConstraintFixingStepsMicro;
+    _numConstraintFixingSteps += other._numConstraintFixingSteps;
+    _numSplits += other._numSplits;
+    _numPops += other._numPops;
+    _numLearnedConflictsPublished += other._numLearnedConflictsPublished;
+    _numLearnedConflictPrunings += other._numLearnedConflictPrunings;
+    _numDonatedSplits += other._numDonatedSplits;
+    _numSearchNodesAllocated += other._numSearchNodesAllocated;
+    _numSearchNodesReused += other._numSearchNodesReused;
+    _searchNodeStorageBytes += other._searchNodeStorageBytes;
+    _numVisitedTreeStates += other._numVisitedTreeStates;
+    _numTableauPivots += other._numTableauPivots;
+    _numTableauDegeneratePivots += other._numTableauDegeneratePivots;
+    _numTableauDegeneratePivotsByRequest += other._numTableauDegeneratePivotsByRequest;
+    _timePivotsMicro += other._timePivotsMicro;
+    _numSimplexPivotSelectionsIgnoredForStability += other._numSimplexPivotSelectionsIgnoredForStability;
+    _numSimplexUnstablePivots += other._numSimplexUnstablePivots;
+    _numAddedRows += other._numAddedRows;
+    _numMergedColumns += other._numMergedColumns;
+    _numTableauBoundHopping += other._numTableauBoundHopping;
+    _numTightenedBounds += other._numTightenedBounds;
+    _numTighteningsFromSymbolicBoundTightening += other._numTighteningsFromSymbolicBoundTightening;
+    _numRowsExaminedByRowTightener += other._numRowsExaminedByRowTightener;
+    _numTighteningsFromRows += other._numTighteningsFromRows;
+    _numBoundTighteningsOnExplicitBasis += other._numBoundTighteningsOnExplicitBasis;
+    _numTighteningsFromExplicitBasis += other._numTighteningsFromExplicitBasis;
+    _numBoundNotificationsToPlConstraints += other._numBoundNotificationsToPlConstraints;
+    _numBoundsProposedByPlConstraints += other._numBoundsProposedByPlConstraints;
+    _numBoundTighteningsOnConstraintMatrix += other._numBoundTighteningsOnConstraintMatrix;
+    _numTighteningsFromConstraintMatrix += other._numTighteningsFromConstraintMatrix;
+    _numBasisRefactorizations += other._numBasisRefactorizations;
+    _numBasisBumps += other._numBasisBumps;
+    _totalFactorizedBasisSize += other._totalFactorizedBasisSize;
+    _totalBasisBumpSize += other._totalBasisBumpSize;
+    _pseNumIterations += other._pseNumIterations;
+    _pseNumResetReferenceSpace += other._pseNumResetReferenceSpace;
+    _ppNumEliminatedVars += other._ppNumEliminatedVars;
+    _ppNumTighteningIterations += other._ppNumTighteningIterations;
+    _ppNumConstraintsRemoved += other._ppNumConstraintsRemoved;
+    _ppNumEquationsRemoved += other._ppNumEquationsRemoved;
+    _totalTimePerformingValidCaseSplitsMicro += other._totalTimePerformingValidCaseSplitsMicro;
+    _totalTimePerformingSymbolicBoundTightening += other._totalTimePerformingSymbolicBoundTightening;
+    _totalTimeHandlingStatisticsMicro += other._totalTimeHandlingStatisticsMicro;
+    _totalNumberOfValidCaseSplits += other._totalNumberOfValidCaseSplits;
+    _totalTimeExplicitBasisBoundTighteningMicro += other._totalTimeExplicitBasisBoundTighteningMicro;
+    _totalTimeDegradationChecking += other._totalTimeDegradationChecking;
+    _totalTimePrecisionRestoration += other._totalTimePrecisionRestoration;
+    _totalTimeConstraintMatrixBoundTighteningMicro += other._totalTimeConstraintMatrixBoundTighteningMicro;
+    _totalTimeApplyingStoredTighteningsMicro += other._totalTimeApplyingStoredTighteningsMicro;
+    _totalTimeSmtCoreMicro += other._totalTimeSmtCoreMicro;
+
+    if ( other._maxDegradation > _maxDegradation )
+        _maxDegradation = other._maxDegradation;
+    if ( other._maxStackDepth > _maxStackDepth )
+        _maxStackDepth = other._maxStackDepth;
+    if ( other._maxBasisBumpSize > _maxBasisBumpSize )
+        _maxBasisBumpSize = other._maxBasisBumpSize;
+
+    _timedOut = _timedOut || other._timedOut;
+}
+
 void Statistics::timeout()
 {
     _timedOut = true;
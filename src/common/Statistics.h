@@ -63,8 +63,12 @@ public:
     void addTimeForPrecisionRestoration( unsigned long long time );
     void addTimeForApplyingStoredTightenings( unsigned long long time );
     void incNumPrecisionRestorations();
+    void incNumAssignmentRefinements();
+    void incNumSuccessfulAssignmentRefinements();
     double getMaxDegradation() const;
     unsigned getNumPrecisionRestorations() const;
+    unsigned getNumAssignmentRefinements() const;
+    unsigned getNumSuccessfulAssignmentRefinements() const;
     unsigned long long getTimeSimplexStepsMicro() const;
     unsigned long long getNumConstraintFixingSteps() const;
 
@@ -98,6 +102,14 @@ public:
     unsigned getNumPops() const;
     unsigned getNumVisitedTreeStates() const;
     unsigned getNumSplits() const;
+    void incNumLearnedConflictsPublished();
+    void incNumLearnedConflictPrunings();
+    void incNumDonatedSplits();
+    void incNumSearchNodesAllocated();
+    void incNumSearchNodesReused();
+    void setSearchNodeStorageBytes( unsigned long long bytes );
+    unsigned getNumSearchNodesAllocated() const;
+    unsigned getNumSearchNodesReused() const;
     unsigned long long getTotalTime() const;
 
     /*
@@ -130,6 +142,15 @@ public:
     */
     void incNumBasisRefactorizations();
 
+    /*
+      Record the outcome of the triangular pre-pass of a sparse basis
+      factorization: the size of the basis, and the size of the remaining
+      bump that required numeric elimination.
+    */
+    void addBasisFactorizationBump( unsigned basisSize, unsigned bumpSize );
+    unsigned getMaxBasisBumpSize() const;
+    unsigned long long getTotalBasisBumpSize() const;
+
     /*
       Projected Steepest Edge related statistics.
     */
@@ -149,6 +170,14 @@ public:
     */
     void printStartingIteration( unsigned long long iteration, String message );
 
+    /*
+      Add the statistics of another run, e.g. of another divide-and-
+      conquer worker, to these statistics. Counters and times are
+      summed and maximal values are combined, whereas current values
+      (such as the stack depth) and the starting time are kept.
+    */
+    void aggregate( const Statistics &other );
+
 private:
     // Initial timestamp
     struct timespec _startTime;
@@ -170,6 +199,11 @@ private:
     double _maxDegradation;
     unsigned _numPrecisionRestorations;
 
+    // Attempts to resolve high degradation by iterative refinement of
+    // the assignment, and how many of those made restoration unnecessary
+    unsigned _numAssignmentRefinements;
+    unsigned _numSuccessfulAssignmentRefinements;
+
     // Number of simplex steps, i.e. pivots (including degenerate
     // pivots), performed by the main loop
     unsigned long long _numSimplexSteps;
@@ -197,6 +231,21 @@ private:
     // Total number of pops so far
     unsigned _numPops;
 
+    // Learned conflicts published to other (divide-and-conquer) workers,
+    // and the number of search states pruned by learned conflicts
+    unsigned _numLearnedConflictsPublished;
+    unsigned _numLearnedConflictPrunings;
+
+    // Unexplored splits donated to other (divide-and-conquer) workers
+    unsigned _numDonatedSplits;
+
+    // Search nodes (stack entries and their stored engine states)
+    // allocated by the SMT core, and nodes recycled from earlier pops
+    // instead. Also, the size of the most recently stored node state
+    unsigned _numSearchNodesAllocated;
+    unsigned _numSearchNodesReused;
+    unsigned long long _searchNodeStorageBytes;
+
     // Total number of states in the search tree visited so far
     unsigned _numVisitedTreeStates;
 
@@ -266,6 +315,10 @@ private:
 
     // Basis factorization statistics
     unsigned long long _numBasisRefactorizations;
+    unsigned long long _numBasisBumps;
+    unsigned long long _totalFactorizedBasisSize;
+    unsigned long long _totalBasisBumpSize;
+    unsigned _maxBasisBumpSize;
 
     // Projected steepest edge statistics
     unsigned long long _pseNumIterations;
@@ -35,6 +35,8 @@ public:
     }
 
     Vector<T>( const Vector<T> &rhs) = default;
+
+    Vector<T>( Vector<T> &&rhs ) = default;
     
     Vector<T>( const std::initializer_list<T> &initializerList ) : _container( initializerList )
     {
@@ -67,6 +69,11 @@ public:
         return _container.data();
     }
 
+    const T *data() const
+    {
+        return _container.data();
+    }
+
     T get( int index ) const
     {
         return _container.at( index );
@@ -77,6 +84,11 @@ public:
         return _container[index];
     }
 
+    const T &operator[]( int index ) const
+    {
+        return _container[index];
+    }
+
     bool empty() const
     {
         return size() == 0;
@@ -136,6 +148,16 @@ public:
         return _container.end();
     }
 
+    const_iterator begin() const
+    {
+        return _container.begin();
+    }
+
+    const_iterator end() const
+    {
+        return _container.end();
+    }
+
     void erase( iterator &it )
     {
         _container.erase( it );
@@ -246,6 +268,12 @@ public:
         return *this;
     }
 
+    Vector &operator=( Vector<T> &&other )
+    {
+        _container = std::move( other._container );
+        return *this;
+    }
+
     void sort()
     {
         std::sort( _container.begin(), _container.end() );
@@ -217,6 +217,18 @@ public:
         TS_ASSERT_EQUALS( a, List<int> ( { 1, 2, 3, 4, 5, 6 } ) );
     }
 
+    void test_append_moved_value()
+    {
+        List<List<int>> lists;
+        List<int> a( { 1, 2, 3 } );
+
+        lists.append( std::move( a ) );
+
+        TS_ASSERT_EQUALS( lists.size(), 1U );
+        TS_ASSERT_EQUALS( lists.front(), List<int>( { 1, 2, 3 } ) );
+        TS_ASSERT( a.empty() );
+    }
+
     void test_reverse_iterator()
     {
         List<int> a;
@@ -0,0 +1,62 @@
+/*********************                                                        */
+/*! \file Test_Statistics.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "Statistics.h"
+
+class StatisticsTestSuite : public CxxTest::TestSuite
+{
+public:
+
+    void test_aggregate()
+    {
+        Statistics first;
+        first.incNumSplits();
+        first.incNumPops();
+        first.incNumTableauPivots();
+        first.setCurrentStackDepth( 3 );
+        first.setCurrentStackDepth( 1 );
+
+        Statistics second;
+        second.incNumSplits();
+        second.incNumSplits();
+        second.incNumTableauPivots();
+        second.setCurrentStackDepth( 5 );
+        second.timeout();
+
+        TS_ASSERT_THROWS_NOTHING( first.aggregate( second ) );
+
+        // Counters are summed, maximal values are combined
+        TS_ASSERT_EQUALS( first.getNumSplits(), 3U );
+        TS_ASSERT_EQUALS( first.getNumPops(), 1U );
+        TS_ASSERT_EQUALS( first.getNumTableauPivots(), 2U );
+        TS_ASSERT_EQUALS( first.getMaxStackDepth(), 5U );
+        TS_ASSERT( first.hasTimedOut() );
+
+        // The other statistics are unchanged
+        TS_ASSERT_EQUALS( second.getNumSplits(), 2U );
+        TS_ASSERT_EQUALS( second.getNumPops(), 0U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -486,6 +486,34 @@ public:
         TS_ASSERT_EQUALS( b.size(), 2U );
     }
 
+    void test_const_iteration()
+    {
+        Vector<int> a( { 1, 2, 3 } );
+        const Vector<int> &b( a );
+
+        int sum = 0;
+        for ( const auto &value : b )
+            sum += value;
+
+        TS_ASSERT_EQUALS( sum, 6 );
+    }
+
+    void test_move()
+    {
+        Vector<int> a( { 1, 2, 3 } );
+        Vector<int> b( std::move( a ) );
+
+        TS_ASSERT_EQUALS( b.size(), 3U );
+        TS_ASSERT( a.empty() );
+
+        Vector<int> c;
+        c = std::move( b );
+
+        TS_ASSERT_EQUALS( c.size(), 3U );
+        TS_ASSERT_EQUALS( c[2], 3 );
+        TS_ASSERT( b.empty() );
+    }
+
     void test_get()
     {
         Vector<int> a;
@@ -25,6 +25,7 @@ const bool GlobalConfiguration::USE_POLARITY_BASED_DIRECTION_HEURISTICS = true;
 const double GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS = 0.0000000001;
 const unsigned GlobalConfiguration::DEFAULT_DOUBLE_TO_STRING_PRECISION = 10;
 const unsigned GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY = 10000;
+const unsigned GlobalConfiguration::STATISTICS_SNAPSHOT_FREQUENCY = 100;
 const double GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE = 0.0000001;
 const double GlobalConfiguration::BOUND_COMPARISON_MULTIPLICATIVE_TOLERANCE = 0.001 * 0.0000001;
 const double GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE = 0.000000001;
@@ -39,10 +40,19 @@ const double GlobalConfiguration::BASIC_COSTS_MULTIPLICATIVE_TOLERANCE = 0.001 *
 const double GlobalConfiguration::SPARSE_FORREST_TOMLIN_DIAGONAL_ELEMENT_TOLERANCE = 0.00001;
 const unsigned GlobalConfiguration::DEGRADATION_CHECKING_FREQUENCY = 100;
 const double GlobalConfiguration::DEGRADATION_THRESHOLD = 0.1;
+const unsigned GlobalConfiguration::DEGRADATION_SAMPLE_SIZE = 100;
+const double GlobalConfiguration::DEGRADATION_SAMPLE_ESCALATION_THRESHOLD = 0.01;
+const unsigned GlobalConfiguration::ASSIGNMENT_REFINEMENT_STEPS = 2;
 const double GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD = 0.0001;
 const bool GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS = false;
 const double GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD = 0.1;
+const unsigned GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT = 4;
 const unsigned GlobalConfiguration::MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS = 5;
+const bool GlobalConfiguration::DNC_SHARE_LEARNED_CONFLICTS = true;
+const unsigned GlobalConfiguration::MAX_LEARNED_CONFLICT_LENGTH = 6;
+const unsigned GlobalConfiguration::LEARNED_CONFLICT_STORE_CAPACITY = 10000;
+const bool GlobalConfiguration::DNC_DONATE_SPLITS_TO_IDLE_WORKERS = true;
+const bool GlobalConfiguration::DNC_WARM_START_SUBQUERIES = true;
 const unsigned GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD = 20;
 const unsigned GlobalConfiguration::SPLITTING_HEURISTICS = DivideStrategy::ReLUViolation;
 const unsigned GlobalConfiguration::BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY = 100;
@@ -60,7 +70,15 @@ const bool GlobalConfiguration::PREPROCESSOR_ELIMINATE_VARIABLES = true;
 const bool GlobalConfiguration::PREPROCESSOR_PL_CONSTRAINTS_ADD_AUX_EQUATIONS = true;
 const double GlobalConfiguration::PREPROCESSOR_ALMOST_FIXED_THRESHOLD = 0.00001;
 
+const bool GlobalConfiguration::SCALE_CONSTRAINT_MATRIX = false;
+const unsigned GlobalConfiguration::CONSTRAINT_MATRIX_SCALING_PASSES = 4;
 const bool GlobalConfiguration::WARM_START = false;
+const unsigned GlobalConfiguration::WARM_START_NUM_CANDIDATES = 256;
+
+const unsigned GlobalConfiguration::FALSIFIER_NUM_SAMPLES = 1000;
+const unsigned GlobalConfiguration::FALSIFIER_NUM_GRADIENT_STARTS = 8;
+const unsigned GlobalConfiguration::FALSIFIER_NUM_GRADIENT_STEPS = 50;
+const double GlobalConfiguration::FALSIFIER_TOLERANCE = 0.000001;
 
 const unsigned GlobalConfiguration::MAX_ITERATIONS_WITHOUT_PROGRESS = 10000;
 
@@ -70,6 +88,8 @@ const double GlobalConfiguration::PSE_GAMMA_UPDATE_TOLERANCE = 0.000000001;
 
 const double GlobalConfiguration::RELU_CONSTRAINT_COMPARISON_TOLERANCE = 0.001;
 
+const bool GlobalConfiguration::USE_RELU_CONSTRAINT_STORE = true;
+
 const bool GlobalConfiguration::ONLY_AUX_INITIAL_BASIS = false;
 
 const GlobalConfiguration::ExplicitBasisBoundTighteningType GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE =
@@ -103,6 +123,7 @@ void GlobalConfiguration::print()
     printf( "  DEFAULT_EPSILON_FOR_COMPARISONS: %.15lf\n", DEFAULT_EPSILON_FOR_COMPARISONS );
     printf( "  DEFAULT_DOUBLE_TO_STRING_PRECISION: %u\n", DEFAULT_DOUBLE_TO_STRING_PRECISION );
     printf( "  STATISTICS_PRINTING_FREQUENCY: %u\n", STATISTICS_PRINTING_FREQUENCY );
+    printf( "  STATISTICS_SNAPSHOT_FREQUENCY: %u\n", STATISTICS_SNAPSHOT_FREQUENCY );
     printf( "  BOUND_COMPARISON_ADDITIVE_TOLERANCE: %.15lf\n", BOUND_COMPARISON_ADDITIVE_TOLERANCE );
     printf( "  BOUND_COMPARISON_MULTIPLICATIVE_TOLERANCE: %.15lf\n", BOUND_COMPARISON_MULTIPLICATIVE_TOLERANCE );
     printf( "  PIVOT_CHANGE_COLUMN_TOLERANCE: %.15lf\n", PIVOT_CHANGE_COLUMN_TOLERANCE );
@@ -112,10 +133,19 @@ void GlobalConfiguration::print()
     printf( "  BASIC_COSTS_MULTIPLICATIVE_TOLERANCE: %.15lf\n", BASIC_COSTS_MULTIPLICATIVE_TOLERANCE );
     printf( "  DEGRADATION_CHECKING_FREQUENCY: %u\n", DEGRADATION_CHECKING_FREQUENCY );
     printf( "  DEGRADATION_THRESHOLD: %.15lf\n", DEGRADATION_THRESHOLD );
+    printf( "  DEGRADATION_SAMPLE_SIZE: %u\n", DEGRADATION_SAMPLE_SIZE );
+    printf( "  DEGRADATION_SAMPLE_ESCALATION_THRESHOLD: %.15lf\n", DEGRADATION_SAMPLE_ESCALATION_THRESHOLD );
+    printf( "  ASSIGNMENT_REFINEMENT_STEPS: %u\n", ASSIGNMENT_REFINEMENT_STEPS );
     printf( "  ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD: %.15lf\n", ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD );
     printf( "  USE_COLUMN_MERGING_EQUATIONS: %s\n", USE_COLUMN_MERGING_EQUATIONS ? "Yes" : "No" );
     printf( "  GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD: %.15lf\n", GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD );
+    printf( "  GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT: %u\n", GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT );
     printf( "  MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS: %u\n", MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS );
+    printf( "  DNC_SHARE_LEARNED_CONFLICTS: %s\n", DNC_SHARE_LEARNED_CONFLICTS ? "Yes" : "No" );
+    printf( "  MAX_LEARNED_CONFLICT_LENGTH: %u\n", MAX_LEARNED_CONFLICT_LENGTH );
+    printf( "  LEARNED_CONFLICT_STORE_CAPACITY: %u\n", LEARNED_CONFLICT_STORE_CAPACITY );
+    printf( "  DNC_DONATE_SPLITS_TO_IDLE_WORKERS: %s\n", DNC_DONATE_SPLITS_TO_IDLE_WORKERS ? "Yes" : "No" );
+    printf( "  DNC_WARM_START_SUBQUERIES: %s\n", DNC_WARM_START_SUBQUERIES ? "Yes" : "No" );
     printf( "  CONSTRAINT_VIOLATION_THRESHOLD: %u\n", CONSTRAINT_VIOLATION_THRESHOLD );
     printf( "  BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY: %u\n",
             BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY );
@@ -126,9 +156,18 @@ void GlobalConfiguration::print()
     printf( "  PREPROCESSOR_ELIMINATE_VARIABLES: %s\n", PREPROCESSOR_ELIMINATE_VARIABLES ? "Yes" : "No" );
     printf( "  PREPROCESSOR_PL_CONSTRAINTS_ADD_AUX_EQUATIONS: %s\n",
             PREPROCESSOR_PL_CONSTRAINTS_ADD_AUX_EQUATIONS ? "Yes" : "No" );
+    printf( "  SCALE_CONSTRAINT_MATRIX: %s\n", SCALE_CONSTRAINT_MATRIX ? "Yes" : "No" );
+    printf( "  CONSTRAINT_MATRIX_SCALING_PASSES: %u\n", CONSTRAINT_MATRIX_SCALING_PASSES );
+    printf( "  WARM_START: %s\n", WARM_START ? "Yes" : "No" );
+    printf( "  WARM_START_NUM_CANDIDATES: %u\n", WARM_START_NUM_CANDIDATES );
+    printf( "  FALSIFIER_NUM_SAMPLES: %u\n", FALSIFIER_NUM_SAMPLES );
+    printf( "  FALSIFIER_NUM_GRADIENT_STARTS: %u\n", FALSIFIER_NUM_GRADIENT_STARTS );
+    printf( "  FALSIFIER_NUM_GRADIENT_STEPS: %u\n", FALSIFIER_NUM_GRADIENT_STEPS );
+    printf( "  FALSIFIER_TOLERANCE: %.15lf\n", FALSIFIER_TOLERANCE );
     printf( "  PSE_ITERATIONS_BEFORE_RESET: %u\n", PSE_ITERATIONS_BEFORE_RESET );
     printf( "  PSE_GAMMA_ERROR_THRESHOLD: %.15lf\n", PSE_GAMMA_ERROR_THRESHOLD );
     printf( "  RELU_CONSTRAINT_COMPARISON_TOLERANCE: %.15lf\n", RELU_CONSTRAINT_COMPARISON_TOLERANCE );
+    printf( "  USE_RELU_CONSTRAINT_STORE: %s\n", USE_RELU_CONSTRAINT_STORE ? "Yes" : "No" );
 
     String basisBoundTighteningType;
     switch ( EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE )
@@ -32,6 +32,10 @@ public:
     // How often should the main loop print statistics?
     static const unsigned STATISTICS_PRINTING_FREQUENCY;
 
+    // How often (in main loop iterations) should the engine take a snapshot of its
+    // statistics, for readers on other threads?
+    static const unsigned STATISTICS_SNAPSHOT_FREQUENCY;
+
     // Tolerance when checking whether the value computed for a basic variable is out of bounds
     static const double BOUND_COMPARISON_ADDITIVE_TOLERANCE;
     static const double BOUND_COMPARISON_MULTIPLICATIVE_TOLERANCE;
@@ -78,10 +82,29 @@ public:
     // threshold, the preprocessor will treat it as fixed.
     static const double PREPROCESSOR_ALMOST_FIXED_THRESHOLD;
 
+    // Toggle geometric scaling of the equations before the tableau is constructed, and set the
+    // number of alternating row/column scaling passes. Variables that participate in piecewise
+    // linear constraints, and input and output variables, are never scaled.
+    static const bool SCALE_CONSTRAINT_MATRIX;
+    static const unsigned CONSTRAINT_MATRIX_SCALING_PASSES;
+
     // Try to set the initial tableau assignment to an assignment that is legal with
     // respect to the input network.
     static const bool WARM_START;
 
+    // The number of candidate input points that the warm start evaluates (as a single
+    // batch) before picking the one whose network assignment best respects the bounds.
+    static const unsigned WARM_START_NUM_CANDIDATES;
+
+    // The parameters of the falsifier, which searches for a satisfying assignment before
+    // the query is solved: the number of random input samples, the number of best samples
+    // that are refined by gradient search, the number of gradient steps for each of them,
+    // and the tolerance for considering an equation or bound satisfied.
+    static const unsigned FALSIFIER_NUM_SAMPLES;
+    static const unsigned FALSIFIER_NUM_GRADIENT_STARTS;
+    static const unsigned FALSIFIER_NUM_GRADIENT_STEPS;
+    static const double FALSIFIER_TOLERANCE;
+
     // The maximal number of iterations without new tree states being visited, before
     // the engine performs a precision restoration.
     static const unsigned MAX_ITERATIONS_WITHOUT_PROGRESS;
@@ -92,6 +115,18 @@ public:
     // The threshold of degradation above which restoration is required
     static const double DEGRADATION_THRESHOLD;
 
+    // The periodic degradation check only evaluates this many equations, in a round-robin fashion,
+    // and extrapolates the degradation of all equations from them. If the extrapolated degradation
+    // exceeds the escalation threshold, all equations are checked. A sample size of 0 means that
+    // all equations are always checked.
+    static const unsigned DEGRADATION_SAMPLE_SIZE;
+    static const double DEGRADATION_SAMPLE_ESCALATION_THRESHOLD;
+
+    // When high degradation is found, the engine first recomputes the assignment from a fresh
+    // basis factorization, followed by this many steps of iterative refinement. Precision
+    // restoration is only performed if the degradation remains high.
+    static const unsigned ASSIGNMENT_REFINEMENT_STEPS;
+
     // If a pivot element in a simplex iteration is smaller than this threshold, the engine will attempt
     // to pick another element.
     static const double ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD;
@@ -104,6 +139,26 @@ public:
     // the largest element in the column, the elimination engine will attempt to pick another pivot.
     static const double GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD;
 
+    // When no singleton row or column exists, the Gaussian elimination engine examines the rows and
+    // columns with the fewest non-zeros first, and stops looking for a pivot with a lower Markowitz
+    // cost once it has a candidate and has examined this many rows and columns.
+    static const unsigned GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT;
+
+    // Should divide-and-conquer workers share the conflicts they learn? Conflicts longer than
+    // the maximal length (in case splits) are not shared, and the shared store holds at most
+    // the given number of conflicts.
+    static const bool DNC_SHARE_LEARNED_CONFLICTS;
+    static const unsigned MAX_LEARNED_CONFLICT_LENGTH;
+    static const unsigned LEARNED_CONFLICT_STORE_CAPACITY;
+
+    // Should busy divide-and-conquer workers donate unexplored case splits from their search
+    // trees to idle workers?
+    static const bool DNC_DONATE_SPLITS_TO_IDLE_WORKERS;
+
+    // When a divide-and-conquer subquery times out, should the subqueries it is divided into
+    // inherit its bounds, basis and fixed ReLU phases?
+    static const bool DNC_WARM_START_SUBQUERIES;
+
     // How many potential pivots should the engine inspect (at most) in every simplex iteration?
     static const unsigned MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS;
 
@@ -134,6 +189,10 @@ public:
     // The tolerance for checking whether f = Relu( b ), to determine a ReLU's statisfaction
     static const double RELU_CONSTRAINT_COMPARISON_TOLERANCE;
 
+    // If all the PL constraints are ReLUs, should their states be saved and restored in bulk,
+    // through a ReluConstraintStore, rather than by duplicating each constraint?
+    static const bool USE_RELU_CONSTRAINT_STORE;
+
     // Should the initial basis be comprised only of auxiliary (row) variables?
     static const bool ONLY_AUX_INITIAL_BASIS;
 
@@ -34,6 +34,9 @@ public:
         // Should DNC mode be on or off
         DNC_MODE,
 
+        // Should the falsifier search for a satisfying assignment before solving
+        FALSIFY,
+
         // Help flag
         HELP,
 
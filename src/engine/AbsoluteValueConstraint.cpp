@@ -0,0 +1,519 @@
+/*********************                                                        */
+/*! \file AbsoluteValueConstraint.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "AbsoluteValueConstraint.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "IConstraintBoundTightener.h"
+#include "ITableau.h"
+#include "InputQuery.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "Statistics.h"
+
+AbsoluteValueConstraint::AbsoluteValueConstraint( unsigned b, unsigned f )
+    : _b( b )
+    , _f( f )
+    , _phaseStatus( PHASE_NOT_FIXED )
+    , _haveEliminatedVariables( false )
+    , _fEliminated( false )
+    , _fFixedValue( 0 )
+{
+}
+
+AbsoluteValueConstraint::AbsoluteValueConstraint( const String &serializedAbs )
+    : _phaseStatus( PHASE_NOT_FIXED )
+    , _haveEliminatedVariables( false )
+    , _fEliminated( false )
+    , _fFixedValue( 0 )
+{
+    String constraintType = serializedAbs.substring( 0, 3 );
+    ASSERT( constraintType == String( "abs" ) );
+
+    // Remove the constraint type in serialized form
+    String serializedValues = serializedAbs.substring( 4, serializedAbs.length() - 4 );
+    List<String> values = serializedValues.tokenize( "," );
+
+    ASSERT( values.size() == 2 );
+
+    auto var = values.begin();
+    _f = atoi( var->ascii() );
+    ++var;
+    _b = atoi( var->ascii() );
+}
+
+PiecewiseLinearConstraint *AbsoluteValueConstraint::duplicateConstraint() const
+{
+    AbsoluteValueConstraint *clone = new AbsoluteValueConstraint( _b, _f );
+    *clone = *this;
+    return clone;
+}
+
+void AbsoluteValueConstraint::restoreState( const PiecewiseLinearConstraint *state )
+{
+    const AbsoluteValueConstraint *abs = dynamic_cast<const AbsoluteValueConstraint *>( state );
+    *this = *abs;
+}
+
+void AbsoluteValueConstraint::registerAsWatcher( ITableau *tableau )
+{
+    for ( unsigned variable : getParticipatingVariables() )
+        tableau->registerToWatchVariable( this, variable );
+}
+
+void AbsoluteValueConstraint::unregisterAsWatcher( ITableau *tableau )
+{
+    for ( unsigned variable : getParticipatingVariables() )
+        tableau->unregisterToWatchVariable( this, variable );
+}
+
+void AbsoluteValueConstraint::notifyVariableValue( unsigned variable, double value )
+{
+    _assignment[variable] = value;
+    reportStateChange();
+}
+
+void AbsoluteValueConstraint::notifyLowerBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incNumBoundNotificationsPlConstraints();
+
+    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+        return;
+
+    _lowerBounds[variable] = bound;
+    updatePhaseStatus();
+    reportStateChange();
+
+    propagateEntailedTightenings();
+}
+
+void AbsoluteValueConstraint::notifyUpperBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incNumBoundNotificationsPlConstraints();
+
+    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+        return;
+
+    _upperBounds[variable] = bound;
+    updatePhaseStatus();
+    reportStateChange();
+
+    propagateEntailedTightenings();
+}
+
+void AbsoluteValueConstraint::propagateEntailedTightenings()
+{
+    if ( !isActive() || !_constraintBoundTightener )
+        return;
+
+    List<Tightening> tightenings;
+    getEntailedTightenings( tightenings );
+    for ( const auto &tightening : tightenings )
+    {
+        if ( tightening._type == Tightening::LB )
+            _constraintBoundTightener->registerTighterLowerBound( tightening._variable, tightening._value );
+        else if ( tightening._type == Tightening::UB )
+            _constraintBoundTightener->registerTighterUpperBound( tightening._variable, tightening._value );
+    }
+}
+
+bool AbsoluteValueConstraint::participatingVariable( unsigned variable ) const
+{
+    return ( variable == _b ) || ( !_fEliminated && variable == _f );
+}
+
+List<unsigned> AbsoluteValueConstraint::getParticipatingVariables() const
+{
+    return _fEliminated ?
+        List<unsigned>( { _b } ) :
+        List<unsigned>( { _b, _f } );
+}
+
+bool AbsoluteValueConstraint::satisfied() const
+{
+    if ( !_assignment.exists( _b ) || ( !_fEliminated && !_assignment.exists( _f ) ) )
+        throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
+
+    return FloatUtils::areEqual( FloatUtils::abs( _assignment.get( _b ) ), getFValue() );
+}
+
+List<PiecewiseLinearConstraint::Fix> AbsoluteValueConstraint::getPossibleFixes() const
+{
+    ASSERT( !satisfied() );
+
+    double bValue = _assignment.get( _b );
+    double fValue = getFValue();
+
+    List<PiecewiseLinearConstraint::Fix> fixes;
+
+    // Either move f to |b|, or move b to +-f, keeping its sign
+    if ( !_fEliminated )
+        fixes.append( PiecewiseLinearConstraint::Fix( _f, FloatUtils::abs( bValue ) ) );
+
+    if ( !FloatUtils::isNegative( fValue ) )
+        fixes.append( PiecewiseLinearConstraint::Fix( _b, FloatUtils::isNegative( bValue ) ? -fValue : fValue ) );
+
+    return fixes;
+}
+
+List<PiecewiseLinearConstraint::Fix> AbsoluteValueConstraint::getSmartFixes( ITableau * ) const
+{
+    return getPossibleFixes();
+}
+
+List<PiecewiseLinearCaseSplit> AbsoluteValueConstraint::getCaseSplits() const
+{
+    if ( _phaseStatus != PHASE_NOT_FIXED )
+        throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
+
+    List<PiecewiseLinearCaseSplit> splits;
+
+    // Start with the phase that matches the current assignment of b
+    if ( _assignment.exists( _b ) && FloatUtils::isNegative( _assignment.get( _b ) ) )
+    {
+        splits.append( getNegativeSplit() );
+        splits.append( getPositiveSplit() );
+    }
+    else
+    {
+        splits.append( getPositiveSplit() );
+        splits.append( getNegativeSplit() );
+    }
+
+    return splits;
+}
+
+PiecewiseLinearCaseSplit AbsoluteValueConstraint::getPositiveSplit() const
+{
+    PiecewiseLinearCaseSplit positivePhase;
+
+    if ( _fEliminated )
+    {
+        // b = f
+        positivePhase.storeBoundTightening( Tightening( _b, _fFixedValue, Tightening::LB ) );
+        positivePhase.storeBoundTightening( Tightening( _b, _fFixedValue, Tightening::UB ) );
+        return positivePhase;
+    }
+
+    // Positive phase: b >= 0, b - f = 0
+    positivePhase.storeBoundTightening( Tightening( _b, 0.0, Tightening::LB ) );
+    Equation positiveEquation( Equation::EQ );
+    positiveEquation.addAddend( 1, _b );
+    positiveEquation.addAddend( -1, _f );
+    positiveEquation.setScalar( 0 );
+    positivePhase.addEquation( positiveEquation );
+    return positivePhase;
+}
+
+PiecewiseLinearCaseSplit AbsoluteValueConstraint::getNegativeSplit() const
+{
+    PiecewiseLinearCaseSplit negativePhase;
+
+    if ( _fEliminated )
+    {
+        // b = -f
+        negativePhase.storeBoundTightening( Tightening( _b, -_fFixedValue, Tightening::LB ) );
+        negativePhase.storeBoundTightening( Tightening( _b, -_fFixedValue, Tightening::UB ) );
+        return negativePhase;
+    }
+
+    // Negative phase: b <= 0, b + f = 0
+    negativePhase.storeBoundTightening( Tightening( _b, 0.0, Tightening::UB ) );
+    Equation negativeEquation( Equation::EQ );
+    negativeEquation.addAddend( 1, _b );
+    negativeEquation.addAddend( 1, _f );
+    negativeEquation.setScalar( 0 );
+    negativePhase.addEquation( negativeEquation );
+    return negativePhase;
+}
+
+bool AbsoluteValueConstraint::phaseFixed() const
+{
+    return _phaseStatus != PHASE_NOT_FIXED;
+}
+
+PiecewiseLinearCaseSplit AbsoluteValueConstraint::getValidCaseSplit() const
+{
+    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+
+    if ( _phaseStatus == PHASE_POSITIVE )
+        return getPositiveSplit();
+
+    return getNegativeSplit();
+}
+
+void AbsoluteValueConstraint::updatePhaseStatus()
+{
+    if ( _phaseStatus != PHASE_NOT_FIXED )
+        return;
+
+    double bLowerBound = getBLowerBound();
+    double bUpperBound = getBUpperBound();
+    double fLowerBound = getFLowerBound();
+    double fUpperBound = getFUpperBound();
+
+    /*
+      The positive phase needs some b > 0 in [b.lb, b.ub] ^ [f.lb, f.ub],
+      and the negative phase some b < 0 in [b.lb, b.ub] ^ [-f.ub, -f.lb].
+      Where b = 0 is the only option, both phases coincide.
+    */
+    double positiveMin = FloatUtils::max( FloatUtils::max( bLowerBound, fLowerBound ), 0 );
+    double positiveMax = FloatUtils::min( bUpperBound, fUpperBound );
+    bool positivePossible =
+        FloatUtils::isPositive( positiveMax ) && FloatUtils::lte( positiveMin, positiveMax );
+
+    double negativeMin = FloatUtils::max( bLowerBound, -fUpperBound );
+    double negativeMax = FloatUtils::min( FloatUtils::min( bUpperBound, -fLowerBound ), 0 );
+    bool negativePossible =
+        FloatUtils::isNegative( negativeMin ) && FloatUtils::lte( negativeMin, negativeMax );
+
+    if ( !negativePossible )
+        _phaseStatus = PHASE_POSITIVE;
+    else if ( !positivePossible )
+        _phaseStatus = PHASE_NEGATIVE;
+}
+
+void AbsoluteValueConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
+{
+    double bLowerBound = getBLowerBound();
+    double bUpperBound = getBUpperBound();
+    double fLowerBound = getFLowerBound();
+    double fUpperBound = getFUpperBound();
+
+    if ( !_fEliminated )
+    {
+        // f is always non-negative
+        tightenings.append( Tightening( _f, 0, Tightening::LB ) );
+    }
+
+    if ( _phaseStatus == PHASE_POSITIVE )
+    {
+        // b = f, b non-negative
+        tightenings.append( Tightening( _b, 0, Tightening::LB ) );
+        tightenings.append( Tightening( _b, fLowerBound, Tightening::LB ) );
+        tightenings.append( Tightening( _b, fUpperBound, Tightening::UB ) );
+
+        if ( !_fEliminated )
+        {
+            tightenings.append( Tightening( _f, bLowerBound, Tightening::LB ) );
+            tightenings.append( Tightening( _f, bUpperBound, Tightening::UB ) );
+        }
+    }
+    else if ( _phaseStatus == PHASE_NEGATIVE )
+    {
+        // b = -f, b non-positive
+        tightenings.append( Tightening( _b, 0, Tightening::UB ) );
+        tightenings.append( Tightening( _b, -fUpperBound, Tightening::LB ) );
+        tightenings.append( Tightening( _b, -fLowerBound, Tightening::UB ) );
+
+        if ( !_fEliminated )
+        {
+            tightenings.append( Tightening( _f, -bUpperBound, Tightening::LB ) );
+            tightenings.append( Tightening( _f, -bLowerBound, Tightening::UB ) );
+        }
+    }
+    else
+    {
+        // |b| <= f.ub, and f <= max( -b.lb, b.ub )
+        tightenings.append( Tightening( _b, -fUpperBound, Tightening::LB ) );
+        tightenings.append( Tightening( _b, fUpperBound, Tightening::UB ) );
+
+        if ( !_fEliminated )
+            tightenings.append( Tightening( _f, FloatUtils::max( -bLowerBound, bUpperBound ), Tightening::UB ) );
+    }
+}
+
+void AbsoluteValueConstraint::dump( String &output ) const
+{
+    output = Stringf( "AbsoluteValueConstraint: x%u = Abs( x%u ). Active? %s. PhaseStatus = %u (%s).\n",
+                      _f, _b,
+                      _constraintActive ? "Yes" : "No",
+                      _phaseStatus, phaseToString( _phaseStatus ).ascii() );
+
+    output += Stringf( "b in [%lf, %lf], f in [%lf, %lf]",
+                       getBLowerBound(), getBUpperBound(), getFLowerBound(), getFUpperBound() );
+}
+
+void AbsoluteValueConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
+{
+    ASSERT( participatingVariable( oldIndex ) );
+    ASSERT( !participatingVariable( newIndex ) );
+
+    if ( _assignment.exists( oldIndex ) )
+    {
+        _assignment[newIndex] = _assignment.get( oldIndex );
+        _assignment.erase( oldIndex );
+    }
+
+    if ( _lowerBounds.exists( oldIndex ) )
+    {
+        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
+        _lowerBounds.erase( oldIndex );
+    }
+
+    if ( _upperBounds.exists( oldIndex ) )
+    {
+        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
+        _upperBounds.erase( oldIndex );
+    }
+
+    if ( oldIndex == _b )
+        _b = newIndex;
+    else
+        _f = newIndex;
+}
+
+void AbsoluteValueConstraint::eliminateVariable( unsigned variable, double fixedValue )
+{
+    ASSERT( participatingVariable( variable ) );
+
+    if ( variable == _b )
+    {
+        // f = |b| has already been entailed
+        _haveEliminatedVariables = true;
+        return;
+    }
+
+    // b is still either f or -f
+    ASSERT( FloatUtils::gte( fixedValue, 0.0 ) );
+    _fEliminated = true;
+    _fFixedValue = fixedValue;
+    if ( _assignment.exists( _f ) )
+        _assignment.erase( _f );
+    if ( _lowerBounds.exists( _f ) )
+        _lowerBounds.erase( _f );
+    if ( _upperBounds.exists( _f ) )
+        _upperBounds.erase( _f );
+}
+
+bool AbsoluteValueConstraint::constraintObsolete() const
+{
+    return _haveEliminatedVariables;
+}
+
+void AbsoluteValueConstraint::addAuxiliaryEquations( InputQuery &inputQuery )
+{
+    /*
+      We want to add the equations
+
+          f >= b, f >= -b
+
+      Which actually become
+
+          f - b - aux1 = 0, f + b - aux2 = 0
+
+      for non-negative aux1 and aux2.
+    */
+    for ( int sign : { -1, 1 } )
+    {
+        unsigned aux = inputQuery.getNumberOfVariables();
+        inputQuery.setNumberOfVariables( aux + 1 );
+
+        Equation equation( Equation::EQ );
+        equation.addAddend( 1.0, _f );
+        equation.addAddend( sign, _b );
+        equation.addAddend( -1.0, aux );
+        equation.setScalar( 0 );
+        inputQuery.addEquation( equation );
+
+        inputQuery.setLowerBound( aux, 0 );
+    }
+}
+
+String AbsoluteValueConstraint::serializeToString() const
+{
+    // Output format is: abs,f,b
+    return Stringf( "abs,%u,%u", _f, _b );
+}
+
+unsigned AbsoluteValueConstraint::getB() const
+{
+    return _b;
+}
+
+unsigned AbsoluteValueConstraint::getF() const
+{
+    return _f;
+}
+
+AbsoluteValueConstraint::PhaseStatus AbsoluteValueConstraint::getPhaseStatus() const
+{
+    return _phaseStatus;
+}
+
+bool AbsoluteValueConstraint::supportsSymbolicBoundTightening() const
+{
+    return true;
+}
+
+double AbsoluteValueConstraint::getBLowerBound() const
+{
+    return _lowerBounds.exists( _b ) ? _lowerBounds.get( _b ) : FloatUtils::negativeInfinity();
+}
+
+double AbsoluteValueConstraint::getBUpperBound() const
+{
+    return _upperBounds.exists( _b ) ? _upperBounds.get( _b ) : FloatUtils::infinity();
+}
+
+double AbsoluteValueConstraint::getFLowerBound() const
+{
+    if ( _fEliminated )
+        return _fFixedValue;
+
+    return _lowerBounds.exists( _f ) ? _lowerBounds.get( _f ) : 0;
+}
+
+double AbsoluteValueConstraint::getFUpperBound() const
+{
+    if ( _fEliminated )
+        return _fFixedValue;
+
+    return _upperBounds.exists( _f ) ? _upperBounds.get( _f ) : FloatUtils::infinity();
+}
+
+double AbsoluteValueConstraint::getFValue() const
+{
+    return _fEliminated ? _fFixedValue : _assignment.get( _f );
+}
+
+String AbsoluteValueConstraint::phaseToString( PhaseStatus phase )
+{
+    switch ( phase )
+    {
+    case PHASE_NOT_FIXED:
+        return "PHASE_NOT_FIXED";
+
+    case PHASE_POSITIVE:
+        return "PHASE_POSITIVE";
+
+    case PHASE_NEGATIVE:
+        return "PHASE_NEGATIVE";
+
+    default:
+        return "UNKNOWN";
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
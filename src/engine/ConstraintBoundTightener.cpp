@@ -20,6 +20,9 @@
 
 ConstraintBoundTightener::ConstraintBoundTightener( const ITableau &tableau )
     : _tableau( tableau )
+    , _n( 0 )
+    , _m( 0 )
+    , _nCapacity( 0 )
     , _lowerBounds( NULL )
     , _upperBounds( NULL )
     , _tightenedLower( NULL )
@@ -30,26 +33,32 @@ ConstraintBoundTightener::ConstraintBoundTightener( const ITableau &tableau )
 
 void ConstraintBoundTightener::setDimensions()
 {
-    freeMemoryIfNeeded();
-
     _n = _tableau.getN();
     _m = _tableau.getM();
 
-    _lowerBounds = new double[_n];
-    if ( !_lowerBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::lowerBounds" );
+    // Reuse the existing work space, if it is large enough
+    if ( _n > _nCapacity )
+    {
+        freeMemoryIfNeeded();
+
+        _nCapacity = std::max( _n, _tableau.getNCapacity() );
+
+        _lowerBounds = new double[_nCapacity];
+        if ( !_lowerBounds )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::lowerBounds" );
 
-    _upperBounds = new double[_n];
-    if ( !_upperBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::upperBounds" );
+        _upperBounds = new double[_nCapacity];
+        if ( !_upperBounds )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::upperBounds" );
 
-    _tightenedLower = new bool[_n];
-    if ( !_tightenedLower )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::tightenedLower" );
+        _tightenedLower = new bool[_nCapacity];
+        if ( !_tightenedLower )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::tightenedLower" );
 
-    _tightenedUpper = new bool[_n];
-    if ( !_tightenedUpper )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::tightenedUpper" );
+        _tightenedUpper = new bool[_nCapacity];
+        if ( !_tightenedUpper )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ConstraintBoundTightener::tightenedUpper" );
+    }
 
     resetBounds();
 }
@@ -68,6 +68,13 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The number of variables for which the work space is allocated.
+      This follows the tableau's capacity, so that the work space is
+      not reallocated every time a row is added to the tableau.
+    */
+    unsigned _nCapacity;
+
     /*
       Work space for the tightener to derive tighter bounds. These
       represent the tightest bounds currently known, either taken
@@ -15,8 +15,13 @@
 
 #include "ConstraintMatrixAnalyzer.h"
 #include "FloatUtils.h"
+#include "GlobalConfiguration.h"
 #include "List.h"
 #include "MStringf.h"
+#include "SparseUnsortedList.h"
+
+#include <functional>
+#include <queue>
 
 ConstraintMatrixAnalyzer::ConstraintMatrixAnalyzer()
     : _matrix( NULL )
@@ -24,6 +29,10 @@ ConstraintMatrixAnalyzer::ConstraintMatrixAnalyzer()
     , _logging( false )
     , _rowHeaders( NULL )
     , _columnHeaders( NULL )
+    , _columnToPivot( NULL )
+    , _remainingInColumn( NULL )
+    , _nonZeroColumns( NULL )
+    , _touchedColumns( NULL )
 {
 }
 
@@ -57,30 +66,76 @@ void ConstraintMatrixAnalyzer::freeMemoryIfNeeded()
         delete[] _columnHeaders;
         _columnHeaders = NULL;
     }
+
+    if ( _columnToPivot )
+    {
+        delete[] _columnToPivot;
+        _columnToPivot = NULL;
+    }
+
+    if ( _remainingInColumn )
+    {
+        delete[] _remainingInColumn;
+        _remainingInColumn = NULL;
+    }
+
+    if ( _nonZeroColumns )
+    {
+        delete[] _nonZeroColumns;
+        _nonZeroColumns = NULL;
+    }
+
+    if ( _touchedColumns )
+    {
+        delete[] _touchedColumns;
+        _touchedColumns = NULL;
+    }
+
+    _independentColumns.clear();
 }
 
 void ConstraintMatrixAnalyzer::analyze( const SparseMatrix *matrix, unsigned m, unsigned n )
+{
+    SparseUnsortedList **rows = new SparseUnsortedList *[m];
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        rows[i] = new SparseUnsortedList( n );
+        matrix->getRow( i, rows[i] );
+    }
+
+    analyze( rows, m, n );
+
+    for ( unsigned i = 0; i < m; ++i )
+        delete rows[i];
+    delete[] rows;
+}
+
+void ConstraintMatrixAnalyzer::analyze( const SparseUnsortedList * const *rows, unsigned m, unsigned n )
 {
     freeMemoryIfNeeded();
 
     _m = m;
     _n = n;
 
-    _matrix = new double[m * n];
     _work = new double[n];
     _rowHeaders = new unsigned[m];
-    _columnHeaders = new unsigned[n];
-
-    matrix->toDense( _matrix );
+    _columnToPivot = new unsigned[n];
+    _remainingInColumn = new unsigned[n];
+    _nonZeroColumns = new unsigned[n];
+    _touchedColumns = new bool[n];
 
-    // Initialize the row and column headers
-    for ( unsigned i = 0; i < _m; ++i )
-        _rowHeaders[i] = i;
+    std::fill_n( _work, n, 0.0 );
+    std::fill_n( _columnToPivot, n, m );
+    std::fill_n( _remainingInColumn, n, 0 );
+    std::fill_n( _touchedColumns, n, false );
 
-    for ( unsigned i = 0; i < _n; ++i )
-        _columnHeaders[i] = i;
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        for ( const auto &entry : *rows[i] )
+            ++_remainingInColumn[entry._index];
+    }
 
-    gaussianElimination();
+    sparseGaussianElimination( rows );
 }
 
 void ConstraintMatrixAnalyzer::analyze( const double *matrix, unsigned m, unsigned n )
@@ -168,6 +223,179 @@ void ConstraintMatrixAnalyzer::gaussianElimination()
     dumpMatrix( "Elimination finished" );
 }
 
+void ConstraintMatrixAnalyzer::sparseGaussianElimination( const SparseUnsortedList * const *rows )
+{
+    _pivotRowStart.clear();
+    _pivotRowColumns.clear();
+    _pivotRowValues.clear();
+    _pivotColumns.clear();
+    _pivotValues.clear();
+
+    _pivotRowStart.append( 0 );
+
+    /*
+      Pivot rows are placed at the top of _rowHeaders, in the order
+      in which they are found, and redundant rows at the bottom.
+    */
+    _eliminationStep = 0;
+    unsigned numRedundantRows = 0;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        for ( const auto &entry : *rows[i] )
+            --_remainingInColumn[entry._index];
+
+        unsigned numTouched = eliminateSparseRow( rows[i] );
+        unsigned pivotColumn = chooseSparsePivot( numTouched );
+
+        if ( pivotColumn < _n )
+        {
+            // Store the eliminated row as a new pivot row
+            for ( unsigned j = 0; j < numTouched; ++j )
+            {
+                unsigned column = _nonZeroColumns[j];
+                if ( column == pivotColumn ||
+                     _columnToPivot[column] < _m ||
+                     FloatUtils::isZero( _work[column] ) )
+                    continue;
+
+                _pivotRowColumns.append( column );
+                _pivotRowValues.append( _work[column] );
+            }
+
+            _pivotRowStart.append( _pivotRowColumns.size() );
+            _pivotColumns.append( pivotColumn );
+            _pivotValues.append( _work[pivotColumn] );
+            _columnToPivot[pivotColumn] = _eliminationStep;
+
+            _independentColumns.append( pivotColumn );
+            _rowHeaders[_eliminationStep] = i;
+            ++_eliminationStep;
+        }
+        else
+        {
+            ++numRedundantRows;
+            _rowHeaders[_m - numRedundantRows] = i;
+        }
+
+        // Reset the work memory
+        for ( unsigned j = 0; j < numTouched; ++j )
+        {
+            _work[_nonZeroColumns[j]] = 0;
+            _touchedColumns[_nonZeroColumns[j]] = false;
+        }
+    }
+}
+
+unsigned ConstraintMatrixAnalyzer::eliminateSparseRow( const SparseUnsortedList *row )
+{
+    /*
+      Pivot row k has no entries in the pivot columns of rows 0..k-1,
+      so processing the pivots in increasing order only ever
+      introduces entries in pivot columns that are yet to be
+      processed.
+    */
+    std::priority_queue<unsigned, std::vector<unsigned>, std::greater<unsigned>> pivotsToProcess;
+    unsigned numTouched = 0;
+
+    for ( const auto &entry : *row )
+    {
+        unsigned column = entry._index;
+        if ( FloatUtils::isZero( entry._value ) )
+            continue;
+
+        if ( !_touchedColumns[column] )
+        {
+            _touchedColumns[column] = true;
+            _nonZeroColumns[numTouched] = column;
+            ++numTouched;
+
+            if ( _columnToPivot[column] < _m )
+                pivotsToProcess.push( _columnToPivot[column] );
+        }
+
+        _work[column] = entry._value;
+    }
+
+    while ( !pivotsToProcess.empty() )
+    {
+        unsigned pivot = pivotsToProcess.top();
+        pivotsToProcess.pop();
+
+        unsigned pivotColumn = _pivotColumns[pivot];
+        double factor = _work[pivotColumn] / _pivotValues[pivot];
+        _work[pivotColumn] = 0;
+
+        if ( FloatUtils::isZero( factor ) )
+            continue;
+
+        for ( unsigned j = _pivotRowStart[pivot]; j < _pivotRowStart[pivot + 1]; ++j )
+        {
+            unsigned column = _pivotRowColumns[j];
+
+            if ( !_touchedColumns[column] )
+            {
+                _touchedColumns[column] = true;
+                _nonZeroColumns[numTouched] = column;
+                ++numTouched;
+
+                if ( _columnToPivot[column] < _m )
+                    pivotsToProcess.push( _columnToPivot[column] );
+            }
+
+            _work[column] -= factor * _pivotRowValues[j];
+        }
+    }
+
+    return numTouched;
+}
+
+unsigned ConstraintMatrixAnalyzer::chooseSparsePivot( unsigned numTouched ) const
+{
+    double largestEntry = 0.0;
+    for ( unsigned j = 0; j < numTouched; ++j )
+    {
+        unsigned column = _nonZeroColumns[j];
+        if ( _columnToPivot[column] < _m )
+            continue;
+
+        double contender = FloatUtils::abs( _work[column] );
+        if ( contender > largestEntry )
+            largestEntry = contender;
+    }
+
+    if ( FloatUtils::isZero( largestEntry ) )
+        return _n;
+
+    double threshold = largestEntry * GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD;
+    unsigned bestColumn = _n;
+    unsigned bestCount = 0;
+    double bestEntry = 0.0;
+
+    for ( unsigned j = 0; j < numTouched; ++j )
+    {
+        unsigned column = _nonZeroColumns[j];
+        if ( _columnToPivot[column] < _m )
+            continue;
+
+        double contender = FloatUtils::abs( _work[column] );
+        if ( contender < threshold || FloatUtils::isZero( contender ) )
+            continue;
+
+        unsigned count = _remainingInColumn[column];
+        if ( ( bestColumn == _n ) ||
+             ( count < bestCount ) ||
+             ( count == bestCount && contender > bestEntry ) )
+        {
+            bestColumn = column;
+            bestCount = count;
+            bestEntry = contender;
+        }
+    }
+
+    return bestColumn;
+}
+
 List<unsigned> ConstraintMatrixAnalyzer::getIndependentColumns() const
 {
     return _independentColumns;
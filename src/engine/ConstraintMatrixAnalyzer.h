@@ -19,6 +19,7 @@
 #include "IConstraintMatrixAnalyzer.h"
 #include "List.h"
 #include "SparseMatrix.h"
+#include "Vector.h"
 
 class String;
 
@@ -35,7 +36,17 @@ public:
       major format.
     */
     void analyze( const double *matrix, unsigned m, unsigned n );
+
+    /*
+      Analyze a sparse matrix, given either as a SparseMatrix or as
+      an array of m sparse rows, without ever storing it densely.
+      The rows are eliminated one at a time against the pivot rows
+      found so far, and rows that vanish are reported as redundant.
+      The canonical form is not available after a sparse analysis.
+    */
     void analyze( const SparseMatrix *matrix, unsigned m, unsigned n );
+    void analyze( const SparseUnsortedList * const *rows, unsigned m, unsigned n );
+
     void getCanonicalForm( double *matrix );
     unsigned getRank() const;
     List<unsigned> getIndependentColumns() const;
@@ -57,10 +68,45 @@ private:
     unsigned *_rowHeaders;
     unsigned *_columnHeaders;
 
+    /*
+      Data structures for the sparse elimination. The pivot rows
+      found so far are stored in CSR format, without their pivot
+      entries: the entries of pivot row k are at indices
+      _pivotRowStart[k] .. _pivotRowStart[k+1] - 1. _columnToPivot
+      maps a column to the index of its pivot row (or to _m, if the
+      column has no pivot), and _remainingInColumn counts the
+      entries of each column in the rows not yet eliminated.
+    */
+    Vector<unsigned> _pivotRowStart;
+    Vector<unsigned> _pivotRowColumns;
+    Vector<double> _pivotRowValues;
+    Vector<unsigned> _pivotColumns;
+    Vector<double> _pivotValues;
+    unsigned *_columnToPivot;
+    unsigned *_remainingInColumn;
+    unsigned *_nonZeroColumns;
+    bool *_touchedColumns;
+
     /*
       Helper functions for performing Gaussian elimination.
     */
     void gaussianElimination();
+    void sparseGaussianElimination( const SparseUnsortedList * const *rows );
+
+    /*
+      Eliminate the given row against the current pivot rows, leaving
+      the result in _work. Return the number of touched columns,
+      which are listed in _nonZeroColumns.
+    */
+    unsigned eliminateSparseRow( const SparseUnsortedList *row );
+
+    /*
+      Among the touched columns without a pivot, choose a pivot for
+      the eliminated row, or return _n if the row has vanished. Large
+      enough entries in columns that appear in few of the remaining
+      rows are preferred, as these cause the least fill-in.
+    */
+    unsigned chooseSparsePivot( unsigned numTouched ) const;
     void swapRows( unsigned i, unsigned j );
     void swapColumns( unsigned i, unsigned j );
 
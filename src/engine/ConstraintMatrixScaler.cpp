@@ -0,0 +1,161 @@
+/*********************                                                        */
+/*! \file ConstraintMatrixScaler.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "ConstraintMatrixScaler.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "InputQuery.h"
+
+#include <cmath>
+
+void ConstraintMatrixScaler::scale( InputQuery &query, const Set<unsigned> &unscalableVariables )
+{
+    _columnScalingFactors.clear();
+
+    List<Equation> &equations( query.getEquations() );
+
+    for ( unsigned pass = 0; pass < GlobalConfiguration::CONSTRAINT_MATRIX_SCALING_PASSES; ++pass )
+    {
+        // Scale the rows
+        for ( auto &equation : equations )
+        {
+            double minCoefficient = FloatUtils::infinity();
+            double maxCoefficient = 0;
+
+            for ( const auto &addend : equation._addends )
+            {
+                double coefficient = FloatUtils::abs( addend._coefficient );
+                if ( FloatUtils::isZero( coefficient ) )
+                    continue;
+
+                if ( coefficient < minCoefficient )
+                    minCoefficient = coefficient;
+                if ( coefficient > maxCoefficient )
+                    maxCoefficient = coefficient;
+            }
+
+            if ( FloatUtils::isZero( maxCoefficient ) )
+                continue;
+
+            double factor = computeScalingFactor( minCoefficient, maxCoefficient );
+            if ( factor == 1 )
+                continue;
+
+            for ( auto &addend : equation._addends )
+                addend._coefficient *= factor;
+            equation._scalar *= factor;
+        }
+
+        // Scale the columns
+        Map<unsigned, double> minCoefficients;
+        Map<unsigned, double> maxCoefficients;
+
+        for ( const auto &equation : equations )
+        {
+            for ( const auto &addend : equation._addends )
+            {
+                unsigned variable = addend._variable;
+                double coefficient = FloatUtils::abs( addend._coefficient );
+
+                if ( unscalableVariables.exists( variable ) || FloatUtils::isZero( coefficient ) )
+                    continue;
+
+                if ( !minCoefficients.exists( variable ) )
+                {
+                    minCoefficients[variable] = coefficient;
+                    maxCoefficients[variable] = coefficient;
+                    continue;
+                }
+
+                if ( coefficient < minCoefficients[variable] )
+                    minCoefficients[variable] = coefficient;
+                if ( coefficient > maxCoefficients[variable] )
+                    maxCoefficients[variable] = coefficient;
+            }
+        }
+
+        Map<unsigned, double> columnFactors;
+        for ( const auto &minCoefficient : minCoefficients )
+        {
+            unsigned variable = minCoefficient.first;
+            double factor = computeScalingFactor( minCoefficient.second, maxCoefficients[variable] );
+            if ( factor == 1 )
+                continue;
+
+            columnFactors[variable] = factor;
+
+            if ( _columnScalingFactors.exists( variable ) )
+                _columnScalingFactors[variable] *= factor;
+            else
+                _columnScalingFactors[variable] = factor;
+        }
+
+        if ( columnFactors.empty() )
+            continue;
+
+        for ( auto &equation : equations )
+        {
+            for ( auto &addend : equation._addends )
+            {
+                if ( columnFactors.exists( addend._variable ) )
+                    addend._coefficient *= columnFactors[addend._variable];
+            }
+        }
+    }
+
+    // The scaled variables are y = x / s, so adjust their bounds accordingly
+    for ( const auto &factor : _columnScalingFactors )
+    {
+        unsigned variable = factor.first;
+        double s = factor.second;
+
+        if ( query.getLowerBounds().exists( variable ) )
+            query.setLowerBound( variable, query.getLowerBound( variable ) / s );
+        if ( query.getUpperBounds().exists( variable ) )
+            query.setUpperBound( variable, query.getUpperBound( variable ) / s );
+    }
+}
+
+double ConstraintMatrixScaler::unscaleValue( unsigned variable, double value ) const
+{
+    return value * getColumnScalingFactor( variable );
+}
+
+double ConstraintMatrixScaler::getColumnScalingFactor( unsigned variable ) const
+{
+    if ( !_columnScalingFactors.exists( variable ) )
+        return 1;
+
+    return _columnScalingFactors.get( variable );
+}
+
+unsigned ConstraintMatrixScaler::getNumScaledColumns() const
+{
+    return _columnScalingFactors.size();
+}
+
+double ConstraintMatrixScaler::computeScalingFactor( double minCoefficient, double maxCoefficient )
+{
+    double exponent = std::round( -0.5 * ( std::log2( minCoefficient ) + std::log2( maxCoefficient ) ) );
+    return std::ldexp( 1.0, (int)exponent );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,76 @@
+/*********************                                                        */
+/*! \file ConstraintMatrixScaler.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Geometric scaling of the equations of an input query, prior to the
+ ** construction of the tableau. Rows are multiplied by scaling factors,
+ ** which does not affect the variables. A column (variable) x is scaled
+ ** by substituting x = s * y, where y is the variable that the tableau
+ ** then works with; its bounds are divided by s, and values are
+ ** multiplied by s when they are extracted. All factors are powers of 2,
+ ** so scaling introduces no rounding errors.
+
+ **/
+
+#ifndef __ConstraintMatrixScaler_h__
+#define __ConstraintMatrixScaler_h__
+
+#include "Map.h"
+#include "Set.h"
+
+class InputQuery;
+
+class ConstraintMatrixScaler
+{
+public:
+    /*
+      Scale the equations and bounds of the query in place. The columns
+      of the given variables are not scaled: these are variables that
+      other components (e.g., piecewise linear constraints) refer to
+      directly.
+    */
+    void scale( InputQuery &query, const Set<unsigned> &unscalableVariables );
+
+    /*
+      Given a value of a variable in the scaled query, return the
+      corresponding value of the original variable.
+    */
+    double unscaleValue( unsigned variable, double value ) const;
+
+    /*
+      The factor s such that x = s * y, for original variable x and
+      scaled variable y. This is 1 for variables that were not scaled.
+    */
+    double getColumnScalingFactor( unsigned variable ) const;
+    unsigned getNumScaledColumns() const;
+
+private:
+    /*
+      The column scaling factors, for the variables that were scaled.
+    */
+    Map<unsigned, double> _columnScalingFactors;
+
+    /*
+      The power of 2 that is closest to 1 / sqrt( min * max ), where
+      min and max are the smallest and largest absolute values of the
+      coefficients in a row or column.
+    */
+    static double computeScalingFactor( double minCoefficient, double maxCoefficient );
+};
+
+#endif // __ConstraintMatrixScaler_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -27,6 +27,7 @@ CostFunctionManager::CostFunctionManager( ITableau *tableau )
     , _multipliers( NULL )
     , _n( 0 )
     , _m( 0 )
+    , _mCapacity( 0 )
     , _costFunctionStatus( COST_FUNCTION_INVALID )
     , _ANColumn( NULL )
 {
@@ -60,22 +61,33 @@ void CostFunctionManager::freeMemoryIfNeeded()
 
 void CostFunctionManager::initialize()
 {
-    _n = _tableau->getN();
-    _m = _tableau->getM();
+    unsigned n = _tableau->getN();
+    unsigned m = _tableau->getM();
 
-    freeMemoryIfNeeded();
+    // Reuse the existing memory, if it is large enough
+    bool reallocate = !_costFunction || ( m > _mCapacity ) || ( n - m != _n - _m );
+
+    _n = n;
+    _m = m;
+
+    if ( reallocate )
+    {
+        freeMemoryIfNeeded();
+
+        _mCapacity = std::max( _m, _tableau->getMCapacity() );
 
-    _costFunction = new double[_n - _m];
-    if ( !_costFunction )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::costFunction" );
+        _costFunction = new double[_n - _m];
+        if ( !_costFunction )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::costFunction" );
 
-    _basicCosts = new double[_m];
-    if ( !_basicCosts )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::basicCosts" );
+        _basicCosts = new double[_mCapacity];
+        if ( !_basicCosts )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::basicCosts" );
 
-    _multipliers = new double[_m];
-    if ( !_multipliers )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::multipliers" );
+        _multipliers = new double[_mCapacity];
+        if ( !_multipliers )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::multipliers" );
+    }
 
     invalidateCostFunction();
 }
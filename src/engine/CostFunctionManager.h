@@ -100,6 +100,13 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The number of rows for which memory is allocated. This follows
+      the tableau's capacity, so that memory is not reallocated every
+      time a row is added to the tableau.
+    */
+    unsigned _mCapacity;
+
     /*
       Status of the cost function.
     */
@@ -15,30 +15,103 @@
 
 #include "DegradationChecker.h"
 #include "FloatUtils.h"
+#include "ITableau.h"
 #include "InputQuery.h"
 
+DegradationChecker::DegradationChecker()
+    : _nextSampleRow( 0 )
+{
+}
+
 void DegradationChecker::storeEquations( const InputQuery &query )
 {
-    _equations = query.getEquations();
+    _rowStart.clear();
+    _columnIndex.clear();
+    _coefficients.clear();
+    _scalars.clear();
+    _variables.clear();
+    _nextSampleRow = 0;
+
+    Map<unsigned, unsigned> variableToIndex;
+
+    _rowStart.append( 0 );
+    for ( const auto &equation : query.getEquations() )
+    {
+        for ( const auto &addend : equation._addends )
+        {
+            if ( !variableToIndex.exists( addend._variable ) )
+            {
+                variableToIndex[addend._variable] = _variables.size();
+                _variables.append( addend._variable );
+            }
+
+            _columnIndex.append( variableToIndex[addend._variable] );
+            _coefficients.append( addend._coefficient );
+        }
+
+        _scalars.append( equation._scalar );
+        _rowStart.append( _columnIndex.size() );
+    }
+
+    _values = Vector<double>( _variables.size(), 0.0 );
 }
 
 double DegradationChecker::computeDegradation( ITableau &tableau ) const
 {
-    double degradation = 0.0;
+    // Gather the values of all participating variables once
+    unsigned numVariables = _variables.size();
+    for ( unsigned i = 0; i < numVariables; ++i )
+        _values[i] = tableau.getValue( _variables[i] );
 
-    for ( const auto &equation : _equations )
-        degradation += computeDegradation( equation, tableau );
+    double degradation = 0.0;
+    unsigned numRows = _scalars.size();
+    for ( unsigned row = 0; row < numRows; ++row )
+        degradation += computeRowDegradation( row );
 
     return degradation;
 }
 
-double DegradationChecker::computeDegradation( const Equation &equation, ITableau &tableau ) const
+double DegradationChecker::computeSampledDegradation( ITableau &tableau,
+                                                      unsigned sampleSize,
+                                                      double escalationThreshold )
 {
+    unsigned numRows = _scalars.size();
+    if ( sampleSize == 0 || sampleSize >= numRows )
+        return computeDegradation( tableau );
+
+    const unsigned *columnIndex = _columnIndex.data();
+
+    double sampledDegradation = 0.0;
+    for ( unsigned i = 0; i < sampleSize; ++i )
+    {
+        unsigned row = _nextSampleRow;
+        _nextSampleRow = ( _nextSampleRow + 1 ) % numRows;
+
+        // Only gather the values of variables that appear in the sample
+        for ( unsigned j = _rowStart[row]; j < _rowStart[row + 1]; ++j )
+            _values[columnIndex[j]] = tableau.getValue( _variables[columnIndex[j]] );
+
+        sampledDegradation += computeRowDegradation( row );
+    }
+
+    double extrapolated = sampledDegradation * numRows / sampleSize;
+    if ( FloatUtils::gt( extrapolated, escalationThreshold ) )
+        return computeDegradation( tableau );
+
+    return extrapolated;
+}
+
+double DegradationChecker::computeRowDegradation( unsigned row ) const
+{
+    const unsigned *columnIndex = _columnIndex.data();
+    const double *coefficients = _coefficients.data();
+    const double *values = _values.data();
+
     double sum = 0.0;
-    for ( const auto &addend : equation._addends )
-        sum += addend._coefficient * tableau.getValue( addend._variable );
+    for ( unsigned i = _rowStart[row]; i < _rowStart[row + 1]; ++i )
+        sum += coefficients[i] * values[columnIndex[i]];
 
-    return FloatUtils::abs( sum - equation._scalar );
+    return FloatUtils::abs( sum - _scalars[row] );
 }
 
 //
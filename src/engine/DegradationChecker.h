@@ -16,22 +16,66 @@
 #ifndef __DegradationChecker_h__
 #define __DegradationChecker_h__
 
-#include "List.h"
+#include "Map.h"
+#include "Vector.h"
 
-class Equation;
 class ITableau;
 class InputQuery;
 
 class DegradationChecker
 {
 public:
+    DegradationChecker();
+
+    /*
+      Store the equations of the query, against which degradation is
+      measured, in compressed sparse row form.
+    */
     void storeEquations( const InputQuery &query );
+
+    /*
+      The degradation is the sum, over all stored equations, of the
+      absolute difference between the two sides of the equation under
+      the tableau's current assignment.
+    */
     double computeDegradation( ITableau &tableau ) const;
 
+    /*
+      A cheaper check that only evaluates the next sampleSize equations,
+      in a round-robin fashion, and extrapolates the degradation of all
+      equations from them. If the extrapolated degradation exceeds
+      escalationThreshold, a full check is performed and its result
+      returned instead.
+    */
+    double computeSampledDegradation( ITableau &tableau,
+                                      unsigned sampleSize,
+                                      double escalationThreshold );
+
 private:
-    List<Equation> _equations;
+    /*
+      The equations in compressed sparse row form. The addends of
+      equation i are at positions _rowStart[i] to _rowStart[i+1] - 1.
+      Variables are renamed to a compact range of indices, so that their
+      values can be gathered into a dense array.
+    */
+    Vector<unsigned> _rowStart;
+    Vector<unsigned> _columnIndex;
+    Vector<double> _coefficients;
+    Vector<double> _scalars;
+
+    /*
+      The original variable of each compact index, and work memory for
+      the variables' values.
+    */
+    Vector<unsigned> _variables;
+    mutable Vector<double> _values;
+
+    /*
+      The first equation of the next sample
+    */
+    unsigned _nextSampleRow;
 
-    double computeDegradation( const Equation &equation, ITableau &tableau ) const;
+    double computeRowDegradation( unsigned row ) const;
 };
 
 #endif // __DegradationChecker_h__
@@ -14,6 +14,9 @@
 
 #include "Debug.h"
 #include "DisjunctionConstraint.h"
+#include "FloatUtils.h"
+#include "IConstraintBoundTightener.h"
+#include "InfeasibleQueryException.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "Statistics.h"
@@ -21,14 +24,72 @@
 DisjunctionConstraint::DisjunctionConstraint( const List<PiecewiseLinearCaseSplit> &disjuncts )
     : _disjuncts( disjuncts )
     , _feasibleDisjuncts( disjuncts )
+    , _haveTriviallySatisfiedDisjunct( false )
 {
     extractParticipatingVariables();
 }
 
-DisjunctionConstraint::DisjunctionConstraint( const String &/* serializedDisjunction */ )
+DisjunctionConstraint::DisjunctionConstraint( const String &serializedDisjunction )
+    : _haveTriviallySatisfiedDisjunct( false )
 {
-    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
-                        "Construct DisjunctionConstraint from String" );
+    List<String> values = serializedDisjunction.tokenize( "," );
+    auto it = values.begin();
+
+    ASSERT( *it == String( "disj" ) );
+    ++it;
+
+    unsigned numDisjuncts = atoi( it->ascii() );
+    ++it;
+
+    for ( unsigned i = 0; i < numDisjuncts; ++i )
+    {
+        PiecewiseLinearCaseSplit disjunct;
+
+        unsigned numBounds = atoi( it->ascii() );
+        ++it;
+        for ( unsigned j = 0; j < numBounds; ++j )
+        {
+            Tightening::BoundType type = ( *it == String( "l" ) ) ? Tightening::LB : Tightening::UB;
+            ++it;
+            unsigned variable = atoi( it->ascii() );
+            ++it;
+            double value = atof( it->ascii() );
+            ++it;
+
+            disjunct.storeBoundTightening( Tightening( variable, value, type ) );
+        }
+
+        unsigned numEquations = atoi( it->ascii() );
+        ++it;
+        for ( unsigned j = 0; j < numEquations; ++j )
+        {
+            int type = atoi( it->ascii() );
+            ++it;
+            Equation equation( type == 1 ? Equation::GE : ( type == 2 ? Equation::LE : Equation::EQ ) );
+            equation.setScalar( atof( it->ascii() ) );
+            ++it;
+
+            unsigned numAddends = atoi( it->ascii() );
+            ++it;
+            for ( unsigned k = 0; k < numAddends; ++k )
+            {
+                double coefficient = atof( it->ascii() );
+                ++it;
+                unsigned variable = atoi( it->ascii() );
+                ++it;
+                equation.addAddend( coefficient, variable );
+            }
+
+            disjunct.addEquation( equation );
+        }
+
+        _disjuncts.append( disjunct );
+    }
+
+    ASSERT( it == values.end() );
+
+    _feasibleDisjuncts = _disjuncts;
+    extractParticipatingVariables();
 }
 
 PiecewiseLinearConstraint *DisjunctionConstraint::duplicateConstraint() const
@@ -59,6 +120,7 @@ void DisjunctionConstraint::unregisterAsWatcher( ITableau *tableau )
 void DisjunctionConstraint::notifyVariableValue( unsigned variable, double value )
 {
     _assignment[variable] = value;
+    reportStateChange();
 }
 
 void DisjunctionConstraint::notifyLowerBound( unsigned variable, double bound )
@@ -70,8 +132,10 @@ void DisjunctionConstraint::notifyLowerBound( unsigned variable, double bound )
         return;
 
     _lowerBounds[variable] = bound;
+    reportStateChange();
 
     updateFeasibleDisjuncts();
+    propagateEntailedTightenings();
 }
 
 void DisjunctionConstraint::notifyUpperBound( unsigned variable, double bound )
@@ -83,8 +147,26 @@ void DisjunctionConstraint::notifyUpperBound( unsigned variable, double bound )
         return;
 
     _upperBounds[variable] = bound;
+    reportStateChange();
 
     updateFeasibleDisjuncts();
+    propagateEntailedTightenings();
+}
+
+void DisjunctionConstraint::propagateEntailedTightenings()
+{
+    if ( !isActive() || !_constraintBoundTightener )
+        return;
+
+    List<Tightening> tightenings;
+    getEntailedTightenings( tightenings );
+    for ( const auto &tightening : tightenings )
+    {
+        if ( tightening._type == Tightening::LB )
+            _constraintBoundTightener->registerTighterLowerBound( tightening._variable, tightening._value );
+        else if ( tightening._type == Tightening::UB )
+            _constraintBoundTightener->registerTighterUpperBound( tightening._variable, tightening._value );
+    }
 }
 
 bool DisjunctionConstraint::participatingVariable( unsigned variable ) const
@@ -122,7 +204,12 @@ List<PiecewiseLinearConstraint::Fix> DisjunctionConstraint::getSmartFixes( ITabl
 
 List<PiecewiseLinearCaseSplit> DisjunctionConstraint::getCaseSplits() const
 {
-    return _disjuncts;
+    // Splitting requires at least two disjuncts. Otherwise, the
+    // current bounds are infeasible, and any split will do.
+    if ( _feasibleDisjuncts.size() < 2 )
+        return _disjuncts;
+
+    return _feasibleDisjuncts;
 }
 
 bool DisjunctionConstraint::phaseFixed() const
@@ -175,21 +262,159 @@ void DisjunctionConstraint::updateVariableIndex( unsigned oldIndex, unsigned new
         disjunct.updateVariableIndex( oldIndex, newIndex );
 
     extractParticipatingVariables();
+    updateFeasibleDisjuncts();
+}
+
+void DisjunctionConstraint::eliminateVariable( unsigned variable, double fixedValue )
+{
+    List<PiecewiseLinearCaseSplit> remainingDisjuncts;
+    for ( auto &disjunct : _disjuncts )
+    {
+        if ( !eliminateVariableFromDisjunct( disjunct, variable, fixedValue ) )
+            continue;
+
+        if ( disjunct.getBoundTightenings().empty() && disjunct.getEquations().empty() )
+            _haveTriviallySatisfiedDisjunct = true;
+
+        remainingDisjuncts.append( disjunct );
+    }
+
+    // If every disjunct is violated by the fixed value, the query is infeasible
+    if ( remainingDisjuncts.empty() )
+        throw InfeasibleQueryException();
+
+    _disjuncts = remainingDisjuncts;
+
+    if ( _assignment.exists( variable ) )
+        _assignment.erase( variable );
+    if ( _lowerBounds.exists( variable ) )
+        _lowerBounds.erase( variable );
+    if ( _upperBounds.exists( variable ) )
+        _upperBounds.erase( variable );
+
+    extractParticipatingVariables();
+    updateFeasibleDisjuncts();
 }
 
-void DisjunctionConstraint::eliminateVariable( unsigned /* variable */, double /* fixedValue */ )
+bool DisjunctionConstraint::eliminateVariableFromDisjunct( PiecewiseLinearCaseSplit &disjunct,
+                                                           unsigned variable,
+                                                           double fixedValue )
 {
-    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
-                        "Eliminate variable from a DisjunctionConstraint" );
+    PiecewiseLinearCaseSplit result;
+
+    for ( const auto &bound : disjunct.getBoundTightenings() )
+    {
+        if ( bound._variable != variable )
+        {
+            result.storeBoundTightening( bound );
+            continue;
+        }
+
+        if ( bound._type == Tightening::LB && FloatUtils::lt( fixedValue, bound._value ) )
+            return false;
+        if ( bound._type == Tightening::UB && FloatUtils::gt( fixedValue, bound._value ) )
+            return false;
+    }
+
+    for ( const auto &equation : disjunct.getEquations() )
+    {
+        Equation substituted( equation._type );
+        double scalar = equation._scalar;
+        for ( const auto &addend : equation._addends )
+        {
+            if ( addend._variable == variable )
+                scalar -= addend._coefficient * fixedValue;
+            else
+                substituted.addAddend( addend._coefficient, addend._variable );
+        }
+        substituted.setScalar( scalar );
+
+        if ( !substituted._addends.empty() )
+        {
+            result.addEquation( substituted );
+            continue;
+        }
+
+        // No variables left: the equation is now 0 ? scalar
+        if ( ( equation._type == Equation::EQ && !FloatUtils::isZero( scalar ) ) ||
+             ( equation._type == Equation::GE && FloatUtils::isPositive( scalar ) ) ||
+             ( equation._type == Equation::LE && FloatUtils::isNegative( scalar ) ) )
+            return false;
+    }
+
+    disjunct = result;
+    return true;
 }
 
 bool DisjunctionConstraint::constraintObsolete() const
 {
-    return _feasibleDisjuncts.empty();
+    return _haveTriviallySatisfiedDisjunct;
+}
+
+void DisjunctionConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
+{
+    if ( _feasibleDisjuncts.empty() )
+    {
+        /*
+          No disjunct is feasible, so any bound is entailed. For every
+          disjunct, report the bound that rules it out: each of these
+          contradicts the current bounds.
+        */
+        for ( const auto &disjunct : _disjuncts )
+        {
+            for ( const auto &bound : disjunct.getBoundTightenings() )
+            {
+                if ( boundIsViolated( bound ) )
+                {
+                    tightenings.append( bound );
+                    break;
+                }
+            }
+        }
+        return;
+    }
+
+    for ( unsigned variable : _participatingVariables )
+    {
+        // The loosest bounds that any feasible disjunct imposes on the variable
+        double hullLowerBound = FloatUtils::infinity();
+        double hullUpperBound = FloatUtils::negativeInfinity();
+
+        for ( const auto &disjunct : _feasibleDisjuncts )
+        {
+            double disjunctLowerBound = getLowerBound( variable );
+            double disjunctUpperBound = getUpperBound( variable );
+
+            for ( const auto &bound : disjunct.getBoundTightenings() )
+            {
+                if ( bound._variable != variable )
+                    continue;
+
+                if ( bound._type == Tightening::LB )
+                    disjunctLowerBound = FloatUtils::max( disjunctLowerBound, bound._value );
+                else
+                    disjunctUpperBound = FloatUtils::min( disjunctUpperBound, bound._value );
+            }
+
+            hullLowerBound = FloatUtils::min( hullLowerBound, disjunctLowerBound );
+            hullUpperBound = FloatUtils::max( hullUpperBound, disjunctUpperBound );
+        }
+
+        if ( FloatUtils::gt( hullLowerBound, getLowerBound( variable ) ) )
+            tightenings.append( Tightening( variable, hullLowerBound, Tightening::LB ) );
+        if ( FloatUtils::lt( hullUpperBound, getUpperBound( variable ) ) )
+            tightenings.append( Tightening( variable, hullUpperBound, Tightening::UB ) );
+    }
+}
+
+double DisjunctionConstraint::getLowerBound( unsigned variable ) const
+{
+    return _lowerBounds.exists( variable ) ? _lowerBounds.get( variable ) : FloatUtils::negativeInfinity();
 }
 
-void DisjunctionConstraint::getEntailedTightenings( List<Tightening> &/* tightenings */ ) const
+double DisjunctionConstraint::getUpperBound( unsigned variable ) const
 {
+    return _upperBounds.exists( variable ) ? _upperBounds.get( variable ) : FloatUtils::infinity();
 }
 
 void DisjunctionConstraint::addAuxiliaryEquations( InputQuery &/* inputQuery */ )
@@ -202,8 +427,29 @@ void DisjunctionConstraint::getCostFunctionComponent( Map<unsigned, double> &/*
 
 String DisjunctionConstraint::serializeToString() const
 {
-    throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
-                        "Serialize DisjunctionConstraint to String" );
+    String result = Stringf( "disj,%u", _disjuncts.size() );
+
+    for ( const auto &disjunct : _disjuncts )
+    {
+        const Vector<Tightening> &bounds( disjunct.getBoundTightenings() );
+        result += Stringf( ",%u", bounds.size() );
+        for ( const auto &bound : bounds )
+            result += Stringf( ",%s,%u,%.15lf",
+                               bound._type == Tightening::LB ? "l" : "u",
+                               bound._variable,
+                               bound._value );
+
+        const List<Equation> &equations( disjunct.getEquations() );
+        result += Stringf( ",%u", equations.size() );
+        for ( const auto &equation : equations )
+        {
+            result += Stringf( ",%d,%.15lf,%u", equation._type, equation._scalar, equation._addends.size() );
+            for ( const auto &addend : equation._addends )
+                result += Stringf( ",%.15lf,%u", addend._coefficient, addend._variable );
+        }
+    }
+
+    return result;
 }
 
 bool DisjunctionConstraint::supportsSymbolicBoundTightening() const
@@ -276,23 +522,21 @@ bool DisjunctionConstraint::disjunctIsFeasible( const PiecewiseLinearCaseSplit &
 {
     for ( const auto &bound : disjunct.getBoundTightenings() )
     {
-        if ( bound._type == Tightening::LB )
-        {
-            if ( _upperBounds.exists( bound._variable ) &&
-                 _upperBounds[bound._variable] < bound._value )
-                return false;
-        }
-        else
-        {
-            if ( _lowerBounds.exists( bound._variable ) &&
-                 _lowerBounds[bound._variable] > bound._value )
-                return false;
-        }
+        if ( boundIsViolated( bound ) )
+            return false;
     }
 
     return true;
 }
 
+bool DisjunctionConstraint::boundIsViolated( const Tightening &bound ) const
+{
+    if ( bound._type == Tightening::LB )
+        return FloatUtils::lt( getUpperBound( bound._variable ), bound._value );
+
+    return FloatUtils::gt( getLowerBound( bound._variable ), bound._value );
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
@@ -81,6 +81,8 @@ public:
       constraint breaks into. These splits need to complementary,
       i.e. if the list is {l1, l2, ..., ln-1, ln},
       then ~l1 /\ ~l2 /\ ... /\ ~ln-1 --> ln.
+      Disjuncts that are infeasible given the current bounds are
+      omitted.
      */
     List<PiecewiseLinearCaseSplit> getCaseSplits() const;
 
@@ -98,14 +100,19 @@ public:
       Preprocessing related functions, to inform that a variable has been eliminated completely
       because it was fixed to some value, or that a variable's index has changed (e.g., x4 is now
       called x2). constraintObsolete() returns true iff and the constraint has become obsolote
-      as a result of variable eliminations.
+      as a result of variable eliminations. An eliminated variable is substituted into the
+      disjuncts, and disjuncts that its value violates are dropped; if some disjunct becomes
+      empty, the constraint holds trivially, and if all are dropped, an
+      InfeasibleQueryException is thrown.
     */
     void eliminateVariable( unsigned variable, double fixedValue );
     void updateVariableIndex( unsigned oldIndex, unsigned newIndex );
     bool constraintObsolete() const;
 
     /*
-      Get the tightenings entailed by the constraint.
+      Get the tightenings entailed by the constraint: the bound hull
+      of the feasible disjuncts. A variable gets a lower (upper) bound
+      if every feasible disjunct bounds it from below (above).
     */
     void getEntailedTightenings( List<Tightening> &tightenings ) const;
 
@@ -116,9 +123,8 @@ public:
 
     /*
       For preprocessing: get any auxiliary equations that this
-      constraint would like to add to the equation pool. In the Disjunction
-      case, this is an equation of the form aux = f - b, where aux is
-      non-negative.
+      constraint would like to add to the equation pool. The
+      Disjunction constraint adds none.
     */
     void addAuxiliaryEquations( InputQuery &inputQuery );
 
@@ -131,7 +137,9 @@ public:
     virtual void getCostFunctionComponent( Map<unsigned, double> &cost ) const;
 
     /*
-      Returns string with shape: disjunction, _f, _b
+      Returns string with shape:
+        disj,<#disjuncts>,[<#bounds>,[l|u,var,value]*,<#equations>,[type,scalar,<#addends>,[coefficient,var]*]*]*
+      where the equation type is as in the query file format.
     */
     String serializeToString() const;
 
@@ -158,6 +166,11 @@ private:
     */
     Set<unsigned> _participatingVariables;
 
+    /*
+      Set if variable elimination rendered one of the disjuncts empty
+    */
+    bool _haveTriviallySatisfiedDisjunct;
+
     /*
       Go over the participating disjuncts and extract from them the list
       of participating variables
@@ -176,6 +189,29 @@ private:
     */
     void updateFeasibleDisjuncts();
     bool disjunctIsFeasible( const PiecewiseLinearCaseSplit &disjunct ) const;
+
+    /*
+      Returns true iff the given bound of a disjunct contradicts the
+      current variable bounds
+    */
+    bool boundIsViolated( const Tightening &bound ) const;
+
+    /*
+      Inform the constraint bound tightener, if one is registered, of
+      the currently entailed tightenings.
+    */
+    void propagateEntailedTightenings();
+
+    /*
+      Substitute a fixed value for a variable in a disjunct. Returns
+      false if the value violates the disjunct.
+    */
+    static bool eliminateVariableFromDisjunct( PiecewiseLinearCaseSplit &disjunct,
+                                               unsigned variable,
+                                               double fixedValue );
+
+    double getLowerBound( unsigned variable ) const;
+    double getUpperBound( unsigned variable ) const;
 };
 
 #endif // __DisjunctionConstraint_h__
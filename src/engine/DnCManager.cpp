@@ -34,6 +34,7 @@
 void DnCManager::dncSolve( WorkerQueue *workload, std::shared_ptr<Engine> engine,
                            std::atomic_uint &numUnsolvedSubQueries,
                            std::atomic_bool &shouldQuitSolving,
+                           std::atomic_uint &numIdleWorkers,
                            unsigned threadId, unsigned onlineDivides,
                            float timeoutFactor, DivideStrategy divideStrategy )
 {
@@ -44,6 +45,9 @@ void DnCManager::dncSolve( WorkerQueue *workload, std::shared_ptr<Engine> engine
     DnCWorker worker( workload, engine, std::ref( numUnsolvedSubQueries ),
                       std::ref( shouldQuitSolving ), threadId, onlineDivides,
                       timeoutFactor, divideStrategy );
+    if ( GlobalConfiguration::DNC_DONATE_SPLITS_TO_IDLE_WORKERS )
+        worker.enableSplitDonation( numIdleWorkers );
+
     while ( !shouldQuitSolving.load() )
     {
         worker.popOneSubQueryAndSolve();
@@ -63,7 +67,9 @@ DnCManager::DnCManager( unsigned numWorkers, unsigned initialDivides,
     , _baseInputQuery( inputQuery )
     , _exitCode( DnCManager::NOT_DONE )
     , _workload( NULL )
+    , _learnedConflictStore( NULL )
     , _timeoutReached( false )
+    , _quitRequested( false )
     , _numUnsolvedSubQueries( 0 )
     , _verbosity( verbosity )
     , _constraintViolationThreshold( GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD )
@@ -89,6 +95,12 @@ void DnCManager::freeMemoryIfNeeded()
         delete _workload;
         _workload = NULL;
     }
+
+    if ( _learnedConflictStore )
+    {
+        delete _learnedConflictStore;
+        _learnedConflictStore = NULL;
+    }
 }
 
 void DnCManager::solve( unsigned timeoutInSeconds )
@@ -124,6 +136,7 @@ void DnCManager::solve( unsigned timeoutInSeconds )
     // Create objects shared across workers
     _numUnsolvedSubQueries = subQueries.size();
     std::atomic_bool shouldQuitSolving( false );
+    std::atomic_uint numIdleWorkers( 0 );
     WorkerQueue *workload = new WorkerQueue( 0 );
     for ( auto &subQuery : subQueries )
     {
@@ -134,6 +147,20 @@ void DnCManager::solve( unsigned timeoutInSeconds )
         }
     }
 
+    // Conflicts are described in terms of variable indices, and so can
+    // only be shared as long as the engines do not merge variables
+    if ( GlobalConfiguration::DNC_SHARE_LEARNED_CONFLICTS &&
+         !GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS )
+    {
+        _learnedConflictStore =
+            new LearnedConflictStore( GlobalConfiguration::LEARNED_CONFLICT_STORE_CAPACITY );
+        if ( !_learnedConflictStore )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "DnCManager::learnedConflictStore" );
+
+        for ( unsigned i = 0; i < _numWorkers; ++i )
+            _engines[i]->setLearnedConflictStore( _learnedConflictStore );
+    }
+
     // Spawn threads and start solving
     std::list<std::thread> threads;
     for ( unsigned threadId = 0; threadId < _numWorkers; ++threadId )
@@ -142,6 +169,7 @@ void DnCManager::solve( unsigned timeoutInSeconds )
                                         _engines[ threadId ],
                                         std::ref( _numUnsolvedSubQueries ),
                                         std::ref( shouldQuitSolving ),
+                                        std::ref( numIdleWorkers ),
                                         threadId, _onlineDivides,
                                         _timeoutFactor, _divideStrategy ) );
     }
@@ -151,7 +179,7 @@ void DnCManager::solve( unsigned timeoutInSeconds )
     while ( !shouldQuitSolving.load() )
     {
         updateTimeoutReached( startTime, timeoutInMicroSeconds );
-        if ( _timeoutReached )
+        if ( _timeoutReached || _quitRequested.load() )
             shouldQuitSolving = true;
         else
             std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
@@ -197,7 +225,7 @@ void DnCManager::updateDnCExitCode()
         _exitCode = DnCManager::SAT;
     else if ( _timeoutReached )
         _exitCode = DnCManager::TIMEOUT;
-    else if ( hasQuitRequested )
+    else if ( hasQuitRequested || _quitRequested.load() )
         _exitCode = DnCManager::QUIT_REQUESTED;
     else if ( hasError )
         _exitCode = DnCManager::ERROR;
@@ -232,6 +260,22 @@ String DnCManager::getResultString()
     }
 }
 
+void DnCManager::quitSignal()
+{
+    _quitRequested = true;
+}
+
+Statistics DnCManager::getStatisticsSnapshot() const
+{
+    Statistics statistics;
+
+    std::lock_guard<std::mutex> lock( _enginesMutex );
+    for ( const auto &engine : _engines )
+        statistics.aggregate( engine->getStatisticsSnapshot() );
+
+    return statistics;
+}
+
 void DnCManager::getSolution( std::map<int, double> &ret )
 {
     ASSERT( _engineWithSATAssignment != nullptr );
@@ -328,6 +372,8 @@ bool DnCManager::createEngines()
         *inputQuery = *baseInputQuery;
         engine->processInputQuery( *inputQuery );
         engine->setConstraintViolationThreshold( _constraintViolationThreshold );
+
+        std::lock_guard<std::mutex> lock( _enginesMutex );
         _engines.append( engine );
     }
 
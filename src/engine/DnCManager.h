@@ -19,10 +19,12 @@
 #include "DivideStrategy.h"
 #include "Engine.h"
 #include "InputQuery.h"
+#include "LearnedConflictStore.h"
 #include "SubQuery.h"
 #include "Vector.h"
 
 #include <atomic>
+#include <mutex>
 
 class DnCManager
 {
@@ -75,6 +77,20 @@ public:
 
     void setConstraintViolationThreshold( unsigned threshold );
 
+    /*
+      Ask the manager to stop solving, e.g. on behalf of a user. May be
+      called from any thread; solve() then returns with exit code
+      QUIT_REQUESTED.
+    */
+    void quitSignal();
+
+    /*
+      The statistics of all workers, aggregated from their engines'
+      most recent snapshots. May be called from any thread, also while
+      solve() is running.
+    */
+    Statistics getStatisticsSnapshot() const;
+
 private:
     /*
       Create and run a DnCWorker
@@ -82,6 +98,7 @@ private:
     static void dncSolve( WorkerQueue *workload, std::shared_ptr<Engine> engine,
                           std::atomic_uint &numUnsolvedSubQueries,
                           std::atomic_bool &shouldQuitSolving,
+                          std::atomic_uint &numIdleWorkers,
                           unsigned threadId, unsigned onlineDivides,
                           float timeoutFactor, DivideStrategy divideStrategy );
 
@@ -116,9 +133,11 @@ private:
     std::shared_ptr<Engine> _baseEngine;
 
     /*
-      The engines that are run in different threads
+      The engines that are run in different threads. The mutex guards
+      their creation against concurrent statistics readers.
     */
     Vector<std::shared_ptr<Engine>> _engines;
+    mutable std::mutex _enginesMutex;
 
     /*
       The engine with the satisfying assignment
@@ -176,11 +195,21 @@ private:
     */
     WorkerQueue *_workload;
 
+    /*
+      Conflicts learned by the workers, shared across threads
+    */
+    LearnedConflictStore *_learnedConflictStore;
+
     /*
       Whether the timeout has been reached
     */
     bool _timeoutReached;
 
+    /*
+      Indicates an external request to quit
+    */
+    std::atomic_bool _quitRequested;
+
     /*
       The number of currently unsolved sub queries
     */
@@ -18,6 +18,7 @@
 #include "DnCWorker.h"
 #include "IEngine.h"
 #include "EngineState.h"
+#include "GlobalConfiguration.h"
 #include "LargestIntervalDivider.h"
 #include "MarabouError.h"
 #include "MStringf.h"
@@ -41,6 +42,11 @@ DnCWorker::DnCWorker( WorkerQueue *workload, std::shared_ptr<IEngine> engine,
     , _threadId( threadId )
     , _onlineDivides( onlineDivides )
     , _timeoutFactor( timeoutFactor )
+    , _numIdleWorkers( NULL )
+    , _isIdle( false )
+    , _currentSplit( NULL )
+    , _currentTimeoutInSeconds( 0 )
+    , _numDonatedSplits( 0 )
 {
     setQueryDivider( divideStrategy );
 
@@ -69,9 +75,16 @@ void DnCWorker::popOneSubQueryAndSolve()
     // in most cases)
     if ( _workload->pop( subQuery ) )
     {
+        if ( _isIdle )
+        {
+            *_numIdleWorkers -= 1;
+            _isIdle = false;
+        }
+
         String queryId = subQuery->_queryId;
         auto split = std::move( subQuery->_split );
         unsigned timeoutInSeconds = subQuery->_timeoutInSeconds;
+        auto warmStart = subQuery->_warmStart;
 
         // Reset the engine state
         _engine->restoreState( *_initialState );
@@ -81,10 +94,26 @@ void DnCWorker::popOneSubQueryAndSolve()
         // object of class DnCStatistics, which contains some basic
         // statistics. The maps are owned by the DnCManager.
 
-        // Apply the split and solve
-        _engine->applySplit( *split );
+        // Apply the warm start (if any) and the split, and solve. While
+        // solving, unexplored splits may be donated to idle workers.
+        if ( warmStart )
+            _engine->applyWarmStart( *warmStart );
+        _engine->applySubQuerySplit( *split );
+
+        _currentQueryId = queryId;
+        _currentSplit = split.get();
+        _currentWarmStart = warmStart;
+        _currentTimeoutInSeconds = timeoutInSeconds;
+        _numDonatedSplits = 0;
+        if ( _numIdleWorkers )
+            _engine->setSplitDonationReceiver( this );
+
         _engine->solve( timeoutInSeconds );
 
+        _engine->setSplitDonationReceiver( NULL );
+        _currentSplit = NULL;
+        _currentWarmStart = NULL;
+
         IEngine::ExitCode result = _engine->getExitCode();
         printProgress( queryId, result );
         // Switch on the result
@@ -105,8 +134,19 @@ void DnCWorker::popOneSubQueryAndSolve()
                                              queryId, *split,
                                              (unsigned)timeoutInSeconds *
                                              _timeoutFactor, subQueries );
+
+            // The new subQueries start where this one left off
+            std::shared_ptr<const SubQueryWarmStart> newWarmStart;
+            if ( GlobalConfiguration::DNC_WARM_START_SUBQUERIES )
+            {
+                auto extractedWarmStart = std::make_shared<SubQueryWarmStart>();
+                _engine->extractWarmStart( *extractedWarmStart );
+                newWarmStart = extractedWarmStart;
+            }
+
             for ( auto &newSubQuery : subQueries )
             {
+                newSubQuery->_warmStart = newWarmStart;
                 if ( !_workload->push( std::move( newSubQuery ) ) )
                 {
                     throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
@@ -153,11 +193,49 @@ void DnCWorker::popOneSubQueryAndSolve()
     }
     else
     {
+        if ( _numIdleWorkers && !_isIdle )
+        {
+            *_numIdleWorkers += 1;
+            _isIdle = true;
+        }
+
         // If the queue is empty but the pop fails, wait and retry
         std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
     }
 }
 
+void DnCWorker::enableSplitDonation( std::atomic_uint &numIdleWorkers )
+{
+    _numIdleWorkers = &numIdleWorkers;
+}
+
+bool DnCWorker::wantsSplit() const
+{
+    // Only donate if there are idle workers that have nothing to pop
+    return _numIdleWorkers && ( _numIdleWorkers->load() > 0 ) && _workload->empty();
+}
+
+void DnCWorker::receiveSplit( const PiecewiseLinearCaseSplit &split )
+{
+    ASSERT( _currentSplit );
+
+    // The donated subquery is restricted to the current subquery's region
+    auto donatedSplit = std::unique_ptr<PiecewiseLinearCaseSplit>
+        ( new PiecewiseLinearCaseSplit( *_currentSplit ) );
+    donatedSplit->addSplit( split );
+
+    ++_numDonatedSplits;
+    String queryId = _currentQueryId + Stringf( "-d%u", _numDonatedSplits );
+
+    SubQuery *subQuery = new SubQuery( queryId, donatedSplit, _currentTimeoutInSeconds );
+    subQuery->_warmStart = _currentWarmStart;
+
+    // Count the new subquery before it can be popped and solved
+    *_numUnsolvedSubQueries += 1;
+    if ( !_workload->push( subQuery ) )
+        throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
+}
+
 void DnCWorker::printProgress( String queryId, IEngine::ExitCode result ) const
 {
     printf( "Worker %d: Query %s %s, %d tasks remaining\n", _threadId,
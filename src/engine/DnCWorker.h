@@ -23,7 +23,7 @@
 
 #include <atomic>
 
-class DnCWorker
+class DnCWorker : public IEngine::SplitDonationReceiver
 {
 public:
     DnCWorker( WorkerQueue *workload, std::shared_ptr<IEngine> engine,
@@ -38,6 +38,18 @@ public:
     */
     void popOneSubQueryAndSolve();
 
+    /*
+      Have the worker report when it is idle, and donate unexplored
+      splits from its search to other workers when some of them are idle.
+    */
+    void enableSplitDonation( std::atomic_uint &numIdleWorkers );
+
+    /*
+      Callbacks from the engine, for split donation.
+    */
+    bool wantsSplit() const;
+    void receiveSplit( const PiecewiseLinearCaseSplit &split );
+
 private:
     /*
       Initiate the query-divider object
@@ -80,6 +92,23 @@ private:
     unsigned _threadId;
     unsigned _onlineDivides;
     float _timeoutFactor;
+
+    /*
+      The number of idle workers (shared across threads), and whether
+      this worker is currently counted among them
+    */
+    std::atomic_uint *_numIdleWorkers;
+    bool _isIdle;
+
+    /*
+      The subquery currently being solved, and the number of splits
+      donated from it so far
+    */
+    String _currentQueryId;
+    const PiecewiseLinearCaseSplit *_currentSplit;
+    std::shared_ptr<const SubQueryWarmStart> _currentWarmStart;
+    unsigned _currentTimeoutInSeconds;
+    unsigned _numDonatedSplits;
 };
 
 #endif // __DnCWorker_h__
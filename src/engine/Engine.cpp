@@ -25,21 +25,29 @@
 #include "MarabouError.h"
 #include "PiecewiseLinearConstraint.h"
 #include "Preprocessor.h"
+#include "SparseUnsortedList.h"
+#include "SubQuery.h"
 #include "TableauRow.h"
 #include "TimeUtils.h"
 
+#include <algorithm>
+#include <random>
+
 Engine::Engine( unsigned verbosity )
-    : _rowBoundTightener( *_tableau )
+    : _useReluConstraintStore( false )
+    , _rowBoundTightener( *_tableau )
     , _symbolicBoundTightener( NULL )
     , _smtCore( this )
     , _numPlConstraintsDisabledByValidSplits( 0 )
     , _preprocessingEnabled( false )
     , _initialStateStored( false )
     , _work( NULL )
+    , _workSize( 0 )
     , _basisRestorationRequired( Engine::RESTORATION_NOT_NEEDED )
     , _basisRestorationPerformed( Engine::NO_RESTORATION_PERFORMED )
     , _costFunctionManager( _tableau )
     , _quitRequested( false )
+    , _numIterationsSinceStatisticsSnapshot( 0 )
     , _exitCode( Engine::NOT_DONE )
     , _constraintBoundTightener( *_tableau )
     , _numVisitedStatesAtPreviousRestoration( 0 )
@@ -47,6 +55,9 @@ Engine::Engine( unsigned verbosity )
     , _verbosity( verbosity )
     , _lastNumVisitedStates( 0 )
     , _lastIterationWithProgress( 0 )
+    , _learnedConflictStore( NULL )
+    , _learnedConflictStoreCursor( 0 )
+    , _splitDonationReceiver( NULL )
 {
     _smtCore.setStatistics( &_statistics );
     _tableau->setStatistics( &_statistics );
@@ -76,13 +87,18 @@ void Engine::setVerbosity( unsigned verbosity )
 
 void Engine::adjustWorkMemorySize()
 {
+    // Reuse the existing memory, if it is large enough
+    if ( _work && _tableau->getM() <= _workSize )
+        return;
+
     if ( _work )
     {
         delete[] _work;
         _work = NULL;
     }
 
-    _work = new double[_tableau->getM()];
+    _workSize = std::max( _tableau->getM(), _tableau->getMCapacity() );
+    _work = new double[_workSize];
     if ( !_work )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::work" );
 }
@@ -94,6 +110,13 @@ bool Engine::solve( unsigned timeoutInSeconds )
 
     updateDirections();
     storeInitialEngineState();
+    takeStatisticsSnapshot();
+
+    if ( _learnedConflictStore )
+    {
+        _smtCore.setLearnedConflictStore( _learnedConflictStore );
+        _smtCore.setSearchRegion( _subQuerySplit );
+    }
 
     if ( _verbosity > 0 )
     {
@@ -110,6 +133,9 @@ bool Engine::solve( unsigned timeoutInSeconds )
         _statistics.addTimeMainLoop( TimeUtils::timePassed( mainLoopStart, mainLoopEnd ) );
         mainLoopStart = mainLoopEnd;
 
+        if ( ++_numIterationsSinceStatisticsSnapshot >= GlobalConfiguration::STATISTICS_SNAPSHOT_FREQUENCY )
+            takeStatisticsSnapshot();
+
         if ( shouldExitDueToTimeout( timeoutInSeconds ) )
         {
             if ( _verbosity > 0 )
@@ -121,6 +147,7 @@ bool Engine::solve( unsigned timeoutInSeconds )
 
             _exitCode = Engine::TIMEOUT;
             _statistics.timeout();
+            takeStatisticsSnapshot();
             return false;
         }
 
@@ -134,6 +161,7 @@ bool Engine::solve( unsigned timeoutInSeconds )
             }
 
             _exitCode = Engine::QUIT_REQUESTED;
+            takeStatisticsSnapshot();
             return false;
         }
 
@@ -170,9 +198,11 @@ bool Engine::solve( unsigned timeoutInSeconds )
             _basisRestorationPerformed = Engine::NO_RESTORATION_PERFORMED;
 
             // Possible restoration due to preceision degradation
-            if ( shouldCheckDegradation() && highDegradation() )
+            if ( shouldCheckDegradation() && highDegradation( true ) )
             {
-                performPrecisionRestoration( PrecisionRestorer::RESTORE_BASICS );
+                // Try the cheaper iterative refinement first
+                if ( !performAssignmentRefinement() )
+                    performPrecisionRestoration( PrecisionRestorer::RESTORE_BASICS );
                 continue;
             }
 
@@ -187,6 +217,11 @@ bool Engine::solve( unsigned timeoutInSeconds )
                 }
                 while ( applyAllValidConstraintCaseSplits() );
                 splitJustPerformed = false;
+
+                if ( learnedConflictApplies() )
+                    throw InfeasibleQueryException();
+
+                donateSplitIfNeeded();
             }
 
             // Perform any SmtCore-initiated case splits
@@ -229,6 +264,7 @@ bool Engine::solve( unsigned timeoutInSeconds )
                         _statistics.print();
                     }
                     _exitCode = Engine::SAT;
+                    takeStatisticsSnapshot();
                     return true;
                 }
 
@@ -276,6 +312,7 @@ bool Engine::solve( unsigned timeoutInSeconds )
             {
                 printf( "Engine: Cannot restore tableau!\n" );
                 _exitCode = Engine::ERROR;
+                takeStatisticsSnapshot();
                 return false;
             }
         }
@@ -291,6 +328,7 @@ bool Engine::solve( unsigned timeoutInSeconds )
                     _statistics.print();
                 }
                 _exitCode = Engine::UNSAT;
+                takeStatisticsSnapshot();
                 return false;
             }
             else
@@ -302,6 +340,7 @@ bool Engine::solve( unsigned timeoutInSeconds )
         catch ( ... )
         {
             _exitCode = Engine::ERROR;
+            takeStatisticsSnapshot();
             printf( "Engine: Unknown error!\n" );
             return false;
         }
@@ -313,9 +352,14 @@ void Engine::mainLoopStatistics()
     struct timespec start = TimeUtils::sampleMicro();
 
     unsigned activeConstraints = 0;
-    for ( const auto &constraint : _plConstraints )
-        if ( constraint->isActive() )
-            ++activeConstraints;
+    if ( _useReluConstraintStore )
+        activeConstraints = _reluConstraintStore.countActive();
+    else
+    {
+        for ( const auto &constraint : _plConstraints )
+            if ( constraint->isActive() )
+                ++activeConstraints;
+    }
 
     _statistics.setNumActivePlConstraints( activeConstraints );
     _statistics.setNumPlValidSplits( _numPlConstraintsDisabledByValidSplits );
@@ -726,45 +770,119 @@ void Engine::storeEquationsInDegradationChecker()
     _degradationChecker.storeEquations( _preprocessedQuery );
 }
 
-double *Engine::createConstraintMatrix()
+void Engine::scaleConstraintMatrix()
+{
+    /*
+      Piecewise linear constraints, the network level reasoner and
+      symbolic bound tightening all refer to their variables directly,
+      so these variables are left unscaled. Their rows may still be
+      scaled.
+    */
+    Set<unsigned> unscalableVariables;
+
+    NetworkLevelReasoner *nlr = _preprocessedQuery.getNetworkLevelReasoner();
+    if ( nlr )
+    {
+        for ( unsigned layer = 0; layer < nlr->getNumberOfLayers(); ++layer )
+        {
+            for ( unsigned neuron = 0; neuron < nlr->getLayerSize( layer ); ++neuron )
+            {
+                if ( nlr->hasWeightedSumVariable( layer, neuron ) )
+                    unscalableVariables.insert( nlr->getWeightedSumVariable( layer, neuron ) );
+                if ( nlr->hasActivationResultVariable( layer, neuron ) )
+                    unscalableVariables.insert( nlr->getActivationResultVariable( layer, neuron ) );
+            }
+        }
+    }
+
+    for ( const auto &constraint : _preprocessedQuery.getPiecewiseLinearConstraints() )
+    {
+        for ( unsigned variable : constraint->getParticipatingVariables() )
+            unscalableVariables.insert( variable );
+    }
+
+    for ( unsigned variable : _preprocessedQuery.getInputVariables() )
+        unscalableVariables.insert( variable );
+
+    for ( unsigned variable : _preprocessedQuery.getOutputVariables() )
+        unscalableVariables.insert( variable );
+
+    _constraintMatrixScaler.scale( _preprocessedQuery, unscalableVariables );
+
+    log( Stringf( "Constraint matrix scaled. Number of scaled columns: %u",
+                  _constraintMatrixScaler.getNumScaledColumns() ) );
+}
+
+SparseUnsortedList **Engine::createSparseConstraintMatrix()
 {
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
     unsigned m = equations.size();
     unsigned n = _preprocessedQuery.getNumberOfVariables();
 
-    // Step 1: create a constraint matrix from the equations
-    double *constraintMatrix = new double[n*m];
+    SparseUnsortedList **constraintMatrix = new SparseUnsortedList *[m];
     if ( !constraintMatrix )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::constraintMatrix" );
-    std::fill_n( constraintMatrix, n*m, 0.0 );
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::sparseConstraintMatrix" );
+
+    /*
+      Each row is first gathered in a dense work row, so that repeated
+      addends of the same variable behave as in the dense matrix.
+    */
+    double *denseRow = new double[n];
+    std::fill_n( denseRow, n, 0.0 );
 
     unsigned equationIndex = 0;
     for ( const auto &equation : equations )
     {
         if ( equation._type != Equation::EQ )
         {
+            for ( unsigned i = 0; i < equationIndex; ++i )
+                delete constraintMatrix[i];
+            delete[] constraintMatrix;
+            delete[] denseRow;
+
             _exitCode = Engine::ERROR;
             throw MarabouError( MarabouError::NON_EQUALITY_INPUT_EQUATION_DISCOVERED );
         }
 
         for ( const auto &addend : equation._addends )
-            constraintMatrix[equationIndex*n + addend._variable] = addend._coefficient;
+            denseRow[addend._variable] = addend._coefficient;
+
+        constraintMatrix[equationIndex] = new SparseUnsortedList( n );
+        for ( const auto &addend : equation._addends )
+        {
+            unsigned variable = addend._variable;
+            if ( !FloatUtils::isZero( denseRow[variable] ) )
+                constraintMatrix[equationIndex]->append( variable, denseRow[variable] );
+            denseRow[variable] = 0.0;
+        }
 
         ++equationIndex;
     }
 
+    delete[] denseRow;
+
     return constraintMatrix;
 }
 
-void Engine::removeRedundantEquations( const double *constraintMatrix )
+void Engine::deleteSparseConstraintMatrix( SparseUnsortedList **constraintMatrix, unsigned m )
+{
+    for ( unsigned i = 0; i < m; ++i )
+        delete constraintMatrix[i];
+    delete[] constraintMatrix;
+}
+
+void Engine::removeRedundantEquations()
 {
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
     unsigned m = equations.size();
     unsigned n = _preprocessedQuery.getNumberOfVariables();
 
     // Step 1: analyze the matrix to identify redundant rows
+    SparseUnsortedList **constraintMatrix = createSparseConstraintMatrix();
+
     AutoConstraintMatrixAnalyzer analyzer;
     analyzer->analyze( constraintMatrix, m, n );
+    deleteSparseConstraintMatrix( constraintMatrix, m );
 
     log( Stringf( "Number of redundant rows: %u out of %u",
                   analyzer->getRedundantRows().size(), m ) );
@@ -779,16 +897,19 @@ void Engine::removeRedundantEquations( const double *constraintMatrix )
     }
 }
 
-void Engine::selectInitialVariablesForBasis( const double *constraintMatrix, List<unsigned> &initialBasis, List<unsigned> &basicRows )
+void Engine::selectInitialVariablesForBasis( List<unsigned> &initialBasis, List<unsigned> &basicRows )
 {
     /*
-      This method permutes rows and columns in the constraint matrix (prior
-      to the addition of auxiliary variables), in order to obtain a set of
-      column that constitue a lower triangular matrix. The variables
-      corresponding to the columns of this matrix join the initial basis.
-
-      (It is possible that not enough variables are obtained this way, in which
-      case the initial basis will have to be augmented later).
+      This method looks for rows and columns of the constraint matrix
+      (prior to the addition of auxiliary variables) that, once
+      permuted, constitute a lower triangular matrix. The variables
+      corresponding to these columns join the initial basis, and the
+      remaining rows will use their auxiliary variables instead.
+
+      The triangular matrix is found by repeatedly taking a singleton
+      row, and excluding the densest remaining column whenever there
+      are no singleton rows. The matrix is accessed through its sparse
+      rows and columns only.
     */
 
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
@@ -805,31 +926,21 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix, Lis
         return;
     }
 
+    SparseUnsortedList **constraintMatrix = createSparseConstraintMatrix();
+
     unsigned *nnzInRow = new unsigned[m];
     unsigned *nnzInColumn = new unsigned[n];
 
     std::fill_n( nnzInRow, m, 0 );
     std::fill_n( nnzInColumn, n, 0 );
 
-    unsigned *columnOrdering = new unsigned[n];
-    unsigned *rowOrdering = new unsigned[m];
-
-    for ( unsigned i = 0; i < m; ++i )
-        rowOrdering[i] = i;
-
-    for ( unsigned i = 0; i < n; ++i )
-        columnOrdering[i] = i;
-
     // Initialize the counters
     for ( unsigned i = 0; i < m; ++i )
     {
-        for ( unsigned j = 0; j < n; ++j )
+        for ( const auto &entry : *constraintMatrix[i] )
         {
-            if ( !FloatUtils::isZero( constraintMatrix[i*n + j] ) )
-            {
-                ++nnzInRow[i];
-                ++nnzInColumn[j];
-            }
+            ++nnzInRow[i];
+            ++nnzInColumn[entry._index];
         }
     }
 
@@ -840,114 +951,125 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix, Lis
             }
         });
 
-    unsigned numExcluded = 0;
-    unsigned numTriangularRows = 0;
-    unsigned temp;
+    // The rows of column j are rowsOfColumn[columnStart[j]..columnStart[j+1]-1]
+    unsigned *columnStart = new unsigned[n + 1];
+    columnStart[0] = 0;
+    for ( unsigned j = 0; j < n; ++j )
+        columnStart[j + 1] = columnStart[j] + nnzInColumn[j];
+
+    unsigned *rowsOfColumn = new unsigned[columnStart[n]];
+    unsigned *columnFill = new unsigned[n];
+    memcpy( columnFill, columnStart, sizeof(unsigned) * n );
 
-    while ( numExcluded + numTriangularRows < n )
+    for ( unsigned i = 0; i < m; ++i )
     {
-        // Do we have a singleton row?
-        unsigned singletonRow = m;
-        for ( unsigned i = numTriangularRows; i < m; ++i )
+        for ( const auto &entry : *constraintMatrix[i] )
         {
-            if ( nnzInRow[i] == 1 )
-            {
-                singletonRow = i;
-                break;
-            }
+            rowsOfColumn[columnFill[entry._index]] = i;
+            ++columnFill[entry._index];
         }
+    }
+
+    // The column counters never change, so the exclusion order is fixed
+    unsigned *columnsByDensity = new unsigned[n];
+    for ( unsigned j = 0; j < n; ++j )
+        columnsByDensity[j] = j;
+
+    std::stable_sort( columnsByDensity, columnsByDensity + n,
+                      [nnzInColumn]( unsigned a, unsigned b )
+                      {
+                          return nnzInColumn[a] > nnzInColumn[b];
+                      } );
+
+    bool *rowIsTriangular = new bool[m];
+    bool *columnIsActive = new bool[n];
+    std::fill_n( rowIsTriangular, m, false );
+    std::fill_n( columnIsActive, n, true );
+
+    List<unsigned> singletonRows;
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        if ( nnzInRow[i] == 1 )
+            singletonRows.append( i );
+    }
+
+    unsigned numTriangularRows = 0;
+    unsigned nextColumnToExclude = 0;
 
-        if ( singletonRow < m )
+    while ( numTriangularRows < m )
+    {
+        unsigned column = n;
+
+        if ( !singletonRows.empty() )
         {
-            // Have a singleton row! Swap it to the top and update counters
-            temp = rowOrdering[singletonRow];
-            rowOrdering[singletonRow] = rowOrdering[numTriangularRows];
-            rowOrdering[numTriangularRows] = temp;
-
-            temp = nnzInRow[numTriangularRows];
-            nnzInRow[numTriangularRows] = nnzInRow[singletonRow];
-            nnzInRow[singletonRow] = temp;
-
-            // Find the non-zero entry in the row and swap it to the diagonal
-            DEBUG( bool foundNonZero = false );
-            for ( unsigned i = numTriangularRows; i < n - numExcluded; ++i )
-            {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[numTriangularRows] * n + columnOrdering[i]] ) )
-                {
-                    temp = columnOrdering[i];
-                    columnOrdering[i] = columnOrdering[numTriangularRows];
-                    columnOrdering[numTriangularRows] = temp;
+            unsigned row = singletonRows.back();
+            singletonRows.popBack();
 
-                    temp = nnzInColumn[numTriangularRows];
-                    nnzInColumn[numTriangularRows] = nnzInColumn[i];
-                    nnzInColumn[i] = temp;
+            // The row's last entry may have been removed in the meantime
+            if ( rowIsTriangular[row] || nnzInRow[row] != 1 )
+                continue;
 
-                    DEBUG( foundNonZero = true );
+            // Have a singleton row! Its remaining entry joins the diagonal
+            for ( const auto &entry : *constraintMatrix[row] )
+            {
+                if ( columnIsActive[entry._index] )
+                {
+                    column = entry._index;
                     break;
                 }
             }
 
-            ASSERT( foundNonZero );
-
-            // Remove all entries under the diagonal entry from the row counters
-            for ( unsigned i = numTriangularRows + 1; i < m; ++i )
-            {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[i] * n + columnOrdering[numTriangularRows]] ) )
-                    --nnzInRow[i];
-            }
+            ASSERT( column < n );
 
+            rowIsTriangular[row] = true;
+            initialBasis.append( column );
             ++numTriangularRows;
         }
         else
         {
             // No singleton rows. Exclude the densest column
-            unsigned maxDensity = nnzInColumn[numTriangularRows];
-            unsigned column = numTriangularRows;
-
-            for ( unsigned i = numTriangularRows; i < n - numExcluded; ++i )
-            {
-                if ( nnzInColumn[i] > maxDensity )
-                {
-                    maxDensity = nnzInColumn[i];
-                    column = i;
-                }
-            }
+            while ( nextColumnToExclude < n && !columnIsActive[columnsByDensity[nextColumnToExclude]] )
+                ++nextColumnToExclude;
 
-            // Update the row counters to account for the excluded column
-            for ( unsigned i = numTriangularRows; i < m; ++i )
-            {
-                double element = constraintMatrix[rowOrdering[i]*n + columnOrdering[column]];
-                if ( !FloatUtils::isZero( element ) )
-                {
-                    ASSERT( nnzInRow[i] > 1 );
-                    --nnzInRow[i];
-                }
-            }
+            if ( nextColumnToExclude == n )
+                break;
 
-            columnOrdering[column] = columnOrdering[n - 1 - numExcluded];
-            nnzInColumn[column] = nnzInColumn[n - 1 - numExcluded];
-            ++numExcluded;
+            column = columnsByDensity[nextColumnToExclude];
         }
-    }
 
-    // Final basis: diagonalized columns + non-diagonalized rows
-    List<unsigned> result;
+        // Remove the column's entries from the row counters
+        columnIsActive[column] = false;
+        for ( unsigned k = columnStart[column]; k < columnStart[column + 1]; ++k )
+        {
+            unsigned row = rowsOfColumn[k];
+            if ( rowIsTriangular[row] )
+                continue;
 
-    for ( unsigned i = 0; i < numTriangularRows; ++i )
-    {
-        initialBasis.append( columnOrdering[i] );
+            ASSERT( nnzInRow[row] > 0 );
+            --nnzInRow[row];
+            if ( nnzInRow[row] == 1 )
+                singletonRows.append( row );
+        }
     }
 
-    for ( unsigned i = numTriangularRows; i < m; ++i )
+    // Final basis: diagonalized columns + non-diagonalized rows
+    for ( unsigned i = 0; i < m; ++i )
     {
-        basicRows.append( rowOrdering[i] );
+        if ( !rowIsTriangular[i] )
+            basicRows.append( i );
     }
 
     // Cleanup
+    deleteSparseConstraintMatrix( constraintMatrix, m );
+
     delete[] nnzInRow;
     delete[] nnzInColumn;
-    delete[] columnOrdering;
-    delete[] rowOrdering;
+    delete[] columnStart;
+    delete[] rowsOfColumn;
+    delete[] columnFill;
+    delete[] columnsByDensity;
+    delete[] rowIsTriangular;
+    delete[] columnIsActive;
 }
 
 void Engine::addAuxiliaryVariables()
@@ -987,7 +1109,7 @@ void Engine::augmentInitialBasisIfNeeded( List<unsigned> &initialBasis, const Li
     }
 }
 
-void Engine::initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis )
+void Engine::initializeTableau( const SparseUnsortedList * const *constraintMatrix, const List<unsigned> &initialBasis )
 {
     const List<Equation> &equations( _preprocessedQuery.getEquations() );
     unsigned m = equations.size();
@@ -1033,6 +1155,15 @@ void Engine::initializeTableau( const double *constraintMatrix, const List<unsig
         constraint->setStatistics( &_statistics );
     }
 
+    _plConstraintTracker.initialize( _plConstraints );
+
+    _reluConstraintStore.clear();
+    _useReluConstraintStore =
+        GlobalConfiguration::USE_RELU_CONSTRAINT_STORE &&
+        ReluConstraintStore::canStore( _plConstraints );
+    if ( _useReluConstraintStore )
+        _reluConstraintStore.initialize( _plConstraints );
+
     _tableau->initializeTableau( initialBasis );
 
     _costFunctionManager->initialize();
@@ -1063,24 +1194,21 @@ bool Engine::processInputQuery( InputQuery &inputQuery, bool preprocess )
         if ( _verbosity > 0 )
             printInputBounds( inputQuery );
 
-        double *constraintMatrix = createConstraintMatrix();
-        removeRedundantEquations( constraintMatrix );
+        removeRedundantEquations();
 
-        // The equations have changed, recreate the constraint matrix
-        delete[] constraintMatrix;
-        constraintMatrix = createConstraintMatrix();
+        if ( GlobalConfiguration::SCALE_CONSTRAINT_MATRIX )
+            scaleConstraintMatrix();
 
         List<unsigned> initialBasis;
         List<unsigned> basicRows;
-        selectInitialVariablesForBasis( constraintMatrix, initialBasis, basicRows );
+        selectInitialVariablesForBasis( initialBasis, basicRows );
         addAuxiliaryVariables();
         augmentInitialBasisIfNeeded( initialBasis, basicRows );
 
         storeEquationsInDegradationChecker();
 
-        // The equations have changed, recreate the constraint matrix
-        delete[] constraintMatrix;
-        constraintMatrix = createConstraintMatrix();
+        SparseUnsortedList **constraintMatrix = createSparseConstraintMatrix();
+        unsigned m = _preprocessedQuery.getEquations().size();
 
         initializeNetworkLevelReasoning();
         initializeTableau( constraintMatrix, initialBasis );
@@ -1088,7 +1216,7 @@ bool Engine::processInputQuery( InputQuery &inputQuery, bool preprocess )
         if ( GlobalConfiguration::WARM_START )
             warmStart();
 
-        delete[] constraintMatrix;
+        deleteSparseConstraintMatrix( constraintMatrix, m );
 
         struct timespec end = TimeUtils::sampleMicro();
         _statistics.setPreprocessingTime( TimeUtils::timePassed( start, end ) );
@@ -1133,11 +1261,13 @@ void Engine::extractSolution( InputQuery &inputQuery )
             variable = _preprocessor.getNewIndex( variable );
 
             // Finally, set the assigned value
-            inputQuery.setSolutionValue( i, _tableau->getValue( variable ) );
+            inputQuery.setSolutionValue( i, _constraintMatrixScaler.unscaleValue
+                                         ( variable, _tableau->getValue( variable ) ) );
         }
         else
         {
-            inputQuery.setSolutionValue( i, _tableau->getValue( i ) );
+            inputQuery.setSolutionValue( i, _constraintMatrixScaler.unscaleValue
+                                         ( i, _tableau->getValue( i ) ) );
         }
     }
 }
@@ -1149,24 +1279,20 @@ bool Engine::allVarsWithinBounds() const
 
 void Engine::collectViolatedPlConstraints()
 {
-    _violatedPlConstraints.clear();
-    for ( const auto &constraint : _plConstraints )
-    {
-        if ( constraint->isActive() && !constraint->satisfied() )
-            _violatedPlConstraints.append( constraint );
-    }
+    _plConstraintTracker.updateViolatedConstraints();
 }
 
 bool Engine::allPlConstraintsHold()
 {
-    return _violatedPlConstraints.empty();
+    return _plConstraintTracker.getViolatedConstraints().empty();
 }
 
 void Engine::selectViolatedPlConstraint()
 {
-    ASSERT( !_violatedPlConstraints.empty() );
+    const Map<unsigned, PiecewiseLinearConstraint *> &violated = _plConstraintTracker.getViolatedConstraints();
+    ASSERT( !violated.empty() );
 
-    _plConstraintToFix = _smtCore.chooseViolatedConstraintForFixing( _violatedPlConstraints );
+    _plConstraintToFix = _smtCore.chooseViolatedConstraintForFixing( violated );
 
     ASSERT( _plConstraintToFix );
 }
@@ -1186,8 +1312,23 @@ void Engine::storeState( EngineState &state, bool storeAlsoTableauState ) const
     else
         state._tableauStateIsStored = false;
 
-    for ( const auto &constraint : _plConstraints )
-        state._plConstraintToState[constraint] = constraint->duplicateConstraint();
+    if ( _useReluConstraintStore )
+    {
+        _reluConstraintStore.storeState( state._reluStoreState );
+        state._reluStoreStateIsStored = true;
+    }
+    else
+    {
+        // A state that was stored before already holds a clone of each
+        // constraint, which is then updated in place
+        for ( const auto &constraint : _plConstraints )
+        {
+            if ( state._plConstraintToState.exists( constraint ) )
+                state._plConstraintToState[constraint]->restoreState( constraint );
+            else
+                state._plConstraintToState[constraint] = constraint->duplicateConstraint();
+        }
+    }
 
     state._numPlConstraintsDisabledByValidSplits = _numPlConstraintsDisabledByValidSplits;
 }
@@ -1203,14 +1344,27 @@ void Engine::restoreState( const EngineState &state )
     _tableau->restoreState( state._tableauState );
 
     log( "\tRestoring constraint states" );
-    for ( auto &constraint : _plConstraints )
+    if ( _useReluConstraintStore )
     {
-        if ( !state._plConstraintToState.exists( constraint ) )
+        if ( !state._reluStoreStateIsStored )
             throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
 
-        constraint->restoreState( state._plConstraintToState[constraint] );
+        _reluConstraintStore.restoreState( state._reluStoreState );
+    }
+    else
+    {
+        for ( auto &constraint : _plConstraints )
+        {
+            if ( !state._plConstraintToState.exists( constraint ) )
+                throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
+
+            constraint->restoreState( state._plConstraintToState[constraint] );
+        }
     }
 
+    // The constraints were restored wholesale, so re-examine all of them
+    _plConstraintTracker.markAllChanged();
+
     _numPlConstraintsDisabledByValidSplits = state._numPlConstraintsDisabledByValidSplits;
 
     // Make sure the data structures are initialized to the correct size
@@ -1229,6 +1383,21 @@ void Engine::setNumPlConstraintsDisabledByValidSplits( unsigned numConstraints )
     _numPlConstraintsDisabledByValidSplits = numConstraints;
 }
 
+void Engine::restorePlConstraintActivity( const EngineState &state )
+{
+    if ( _useReluConstraintStore )
+    {
+        if ( !state._reluStoreStateIsStored )
+            throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
+
+        _reluConstraintStore.restoreActivity( state._reluStoreState );
+        return;
+    }
+
+    for ( const auto &pair : state._plConstraintToState )
+        pair.first->setActiveConstraint( pair.second->isActive() );
+}
+
 bool Engine::attemptToMergeVariables( unsigned x1, unsigned x2 )
 {
     /*
@@ -1332,10 +1501,19 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
 
     DEBUG( _tableau->verifyInvariants() );
 
-    List<Tightening> bounds = split.getBoundTightenings();
-    List<Equation> equations = split.getEquations();
-    for ( auto &equation : equations )
+    // The split is only read: each of its equations is copied once, to
+    // be adjusted below, and is then moved into the tableau. The bounds
+    // of any new auxiliary variables are kept separately
+    Vector<Tightening> auxiliaryBounds;
+
+    // Equations that cannot be handled by merging columns are added to
+    // the tableau together
+    List<Equation> equationsToAdd;
+
+    for ( const auto &splitEquation : split.getEquations() )
     {
+        Equation equation( splitEquation );
+
         /*
           First, adjust the equation if any variables have been merged.
           E.g., if the equation is x1 + x2 + x3 = 0, and x1 and x2 have been
@@ -1376,6 +1554,10 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
           x1 = x2, which are common, e.g., with ReLUs. For these equations we
           may be able to merge two columns of the tableau.
         */
+        // Merging works on the current tableau, so first add any pending equations
+        if ( GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS )
+            addEquationsToTableau( equationsToAdd, auxiliaryBounds );
+
         unsigned x1, x2;
         bool canMergeColumns =
             // Only if the flag is on
@@ -1393,57 +1575,86 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
         if ( canMergeColumns )
             columnsSuccessfullyMerged = attemptToMergeVariables( x1, x2 );
 
+        // General case: add a new equation to the tableau
         if ( !columnsSuccessfullyMerged )
-        {
-            // General case: add a new equation to the tableau
-            unsigned auxVariable = _tableau->addEquation( equation );
-            _activeEntryStrategy->resizeHook( _tableau );
-
-            switch ( equation._type )
-            {
-            case Equation::GE:
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::UB ) );
-                break;
-
-            case Equation::LE:
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::LB ) );
-                break;
-
-            case Equation::EQ:
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::LB ) );
-                bounds.append( Tightening( auxVariable, 0.0, Tightening::UB ) );
-                break;
-
-            default:
-                ASSERT( false );
-                break;
-            }
-        }
+            equationsToAdd.append( std::move( equation ) );
     }
 
+    addEquationsToTableau( equationsToAdd, auxiliaryBounds );
+
     adjustWorkMemorySize();
 
     _rowBoundTightener->resetBounds();
     _constraintBoundTightener->resetBounds();
 
-    for ( auto &bound : bounds )
+    for ( const auto &bound : split.getBoundTightenings() )
+        applySplitBound( bound );
+
+    for ( const auto &bound : auxiliaryBounds )
+        applySplitBound( bound );
+
+    DEBUG( _tableau->verifyInvariants() );
+    log( "Done with split\n" );
+}
+
+void Engine::applySplitBound( const Tightening &bound )
+{
+    unsigned variable = _tableau->getVariableAfterMerging( bound._variable );
+
+    if ( bound._type == Tightening::LB )
     {
-        unsigned variable = _tableau->getVariableAfterMerging( bound._variable );
+        log( Stringf( "x%u: lower bound set to %.3lf", variable, bound._value ) );
+        _tableau->tightenLowerBound( variable, bound._value );
+    }
+    else
+    {
+        log( Stringf( "x%u: upper bound set to %.3lf", variable, bound._value ) );
+        _tableau->tightenUpperBound( variable, bound._value );
+    }
+}
 
-        if ( bound._type == Tightening::LB )
-        {
-            log( Stringf( "x%u: lower bound set to %.3lf", variable, bound._value ) );
-            _tableau->tightenLowerBound( variable, bound._value );
-        }
-        else
+void Engine::addEquationsToTableau( List<Equation> &equations, Vector<Tightening> &bounds )
+{
+    if ( equations.empty() )
+        return;
+
+    List<unsigned> auxVariables;
+    _tableau->addEquations( equations, auxVariables );
+    _activeEntryStrategy->resizeHook( _tableau );
+
+    auto auxVariable = auxVariables.begin();
+    for ( const auto &equation : equations )
+    {
+        switch ( equation._type )
         {
-            log( Stringf( "x%u: upper bound set to %.3lf", variable, bound._value ) );
-            _tableau->tightenUpperBound( variable, bound._value );
+        case Equation::GE:
+            bounds.append( Tightening( *auxVariable, 0.0, Tightening::UB ) );
+            break;
+
+        case Equation::LE:
+            bounds.append( Tightening( *auxVariable, 0.0, Tightening::LB ) );
+            break;
+
+        case Equation::EQ:
+            bounds.append( Tightening( *auxVariable, 0.0, Tightening::LB ) );
+            bounds.append( Tightening( *auxVariable, 0.0, Tightening::UB ) );
+            break;
+
+        default:
+            ASSERT( false );
+            break;
         }
+
+        ++auxVariable;
     }
 
-    DEBUG( _tableau->verifyInvariants() );
-    log( "Done with split\n" );
+    equations.clear();
+}
+
+void Engine::applySubQuerySplit( const PiecewiseLinearCaseSplit &split )
+{
+    applySplit( split );
+    _subQuerySplit = split;
 }
 
 void Engine::applyAllRowTightenings()
@@ -1493,9 +1704,20 @@ bool Engine::applyAllValidConstraintCaseSplits()
     struct timespec start = TimeUtils::sampleMicro();
 
     bool appliedSplit = false;
-    for ( auto &constraint : _plConstraints )
-        if ( applyValidConstraintCaseSplit( constraint ) )
-            appliedSplit = true;
+    if ( _useReluConstraintStore )
+    {
+        // Only visit the constraints that actually have a valid split
+        for ( unsigned i = 0; i < _reluConstraintStore.size(); ++i )
+            if ( _reluConstraintStore.hasValidSplit( i ) &&
+                 applyValidConstraintCaseSplit( _reluConstraintStore.getConstraint( i ) ) )
+                appliedSplit = true;
+    }
+    else
+    {
+        for ( auto &constraint : _plConstraints )
+            if ( applyValidConstraintCaseSplit( constraint ) )
+                appliedSplit = true;
+    }
 
     struct timespec end = TimeUtils::sampleMicro();
     _statistics.addTimeForValidCaseSplit( TimeUtils::timePassed( start, end ) );
@@ -1530,11 +1752,15 @@ bool Engine::shouldCheckDegradation()
         GlobalConfiguration::DEGRADATION_CHECKING_FREQUENCY == 0 ;
 }
 
-bool Engine::highDegradation()
+bool Engine::highDegradation( bool sample )
 {
     struct timespec start = TimeUtils::sampleMicro();
 
-    double degradation = _degradationChecker.computeDegradation( *_tableau );
+    double degradation = sample ?
+        _degradationChecker.computeSampledDegradation( *_tableau,
+                                                       GlobalConfiguration::DEGRADATION_SAMPLE_SIZE,
+                                                       GlobalConfiguration::DEGRADATION_SAMPLE_ESCALATION_THRESHOLD ) :
+        _degradationChecker.computeDegradation( *_tableau );
     _statistics.setCurrentDegradation( degradation );
 
     bool result = FloatUtils::gt( degradation, GlobalConfiguration::DEGRADATION_THRESHOLD );
@@ -1588,6 +1814,28 @@ void Engine::explicitBasisBoundTightening()
     _statistics.addTimeForExplicitBasisBoundTightening( TimeUtils::timePassed( start, end ) );
 }
 
+bool Engine::performAssignmentRefinement()
+{
+    struct timespec start = TimeUtils::sampleMicro();
+
+    _tableau->computeRefinedAssignment( GlobalConfiguration::ASSIGNMENT_REFINEMENT_STEPS );
+
+    struct timespec end = TimeUtils::sampleMicro();
+    _statistics.addTimeForPrecisionRestoration( TimeUtils::timePassed( start, end ) );
+    _statistics.incNumAssignmentRefinements();
+
+    bool success = !highDegradation( false );
+
+    if ( _verbosity > 0 )
+        printf( "Performed assignment refinement. Degradation is %s\n",
+                success ? "now acceptable" : "still high" );
+
+    if ( success )
+        _statistics.incNumSuccessfulAssignmentRefinements();
+
+    return success;
+}
+
 void Engine::performPrecisionRestoration( PrecisionRestorer::RestoreBasics restoreBasics )
 {
     struct timespec start = TimeUtils::sampleMicro();
@@ -1612,7 +1860,7 @@ void Engine::performPrecisionRestoration( PrecisionRestorer::RestoreBasics resto
                 after );
     //
 
-    if ( highDegradation() && ( restoreBasics == PrecisionRestorer::RESTORE_BASICS ) )
+    if ( highDegradation( false ) && ( restoreBasics == PrecisionRestorer::RESTORE_BASICS ) )
     {
         // First round, with basic restoration, still resulted in high degradation.
         // Try again!
@@ -1633,7 +1881,7 @@ void Engine::performPrecisionRestoration( PrecisionRestorer::RestoreBasics resto
                     after,
                     afterSecond );
 
-        if ( highDegradation() )
+        if ( highDegradation( false ) )
             throw MarabouError( MarabouError::RESTORATION_FAILED_TO_RESTORE_PRECISION );
     }
 }
@@ -1659,6 +1907,19 @@ const Statistics *Engine::getStatistics() const
     return &_statistics;
 }
 
+Statistics Engine::getStatisticsSnapshot() const
+{
+    std::lock_guard<std::mutex> lock( _statisticsSnapshotMutex );
+    return _statisticsSnapshot;
+}
+
+void Engine::takeStatisticsSnapshot()
+{
+    std::lock_guard<std::mutex> lock( _statisticsSnapshotMutex );
+    _statisticsSnapshot = _statistics;
+    _numIterationsSinceStatisticsSnapshot = 0;
+}
+
 InputQuery *Engine::getInputQuery()
 {
     return &_preprocessedQuery;
@@ -1724,6 +1985,203 @@ List<unsigned> Engine::getInputVariables() const
     return _preprocessedQuery.getInputVariables();
 }
 
+void Engine::setLearnedConflictStore( LearnedConflictStore *store )
+{
+    _learnedConflictStore = store;
+    _learnedConflictStoreCursor = 0;
+    _learnedConflicts.clear();
+}
+
+bool Engine::learnedConflictApplies()
+{
+    if ( !_learnedConflictStore )
+        return false;
+
+    _learnedConflictStore->importConflicts( _learnedConflictStoreCursor, _learnedConflicts );
+
+    for ( const auto &conflict : _learnedConflicts )
+    {
+        if ( learnedConflictApplies( *conflict ) )
+        {
+            _statistics.incNumLearnedConflictPrunings();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Engine::learnedConflictApplies( const LearnedConflict &conflict ) const
+{
+    for ( const auto &bound : conflict._bounds )
+    {
+        if ( bound._type == Tightening::LB )
+        {
+            if ( FloatUtils::lt( _tableau->getLowerBound( bound._variable ), bound._value ) )
+                return false;
+        }
+        else
+        {
+            if ( FloatUtils::gt( _tableau->getUpperBound( bound._variable ), bound._value ) )
+                return false;
+        }
+    }
+
+    for ( const auto &split : conflict._splitsWithEquations )
+    {
+        if ( !( split == _subQuerySplit ) && !_smtCore.splitIsApplied( split ) )
+            return false;
+    }
+
+    return true;
+}
+
+void Engine::setSplitDonationReceiver( SplitDonationReceiver *receiver )
+{
+    _splitDonationReceiver = receiver;
+}
+
+void Engine::donateSplitIfNeeded()
+{
+    if ( !_splitDonationReceiver || !_splitDonationReceiver->wantsSplit() )
+        return;
+
+    PiecewiseLinearCaseSplit split;
+    if ( _smtCore.donateAlternativeSplit( split ) )
+    {
+        _splitDonationReceiver->receiveSplit( split );
+        _statistics.incNumDonatedSplits();
+    }
+}
+
+void Engine::extractWarmStart( SubQueryWarmStart &warmStart ) const
+{
+    /*
+      Everything that was learned below the root of the search is only
+      valid in a part of the region, so use the state stored before the
+      first split. If no split was performed, the current state is the
+      state at the root.
+    */
+    EngineState currentState;
+    const EngineState *rootState = _smtCore.getStateAtRoot();
+    if ( !rootState )
+    {
+        storeState( currentState, true );
+        rootState = &currentState;
+    }
+
+    // Variables added by splits at the root are not part of the warm start
+    const TableauState &tableauState = rootState->_tableauState;
+    unsigned n = std::min( tableauState._n, _preprocessedQuery.getNumberOfVariables() );
+
+    warmStart._basicVariables.clear();
+    for ( const auto &basic : tableauState._basicVariables )
+    {
+        if ( basic < n )
+            warmStart._basicVariables.append( basic );
+    }
+
+    warmStart._lowerBounds = Vector<double>( n );
+    warmStart._upperBounds = Vector<double>( n );
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        warmStart._lowerBounds[i] = tableauState._lowerBounds[i];
+        warmStart._upperBounds[i] = tableauState._upperBounds[i];
+    }
+
+    warmStart._fixedReluPhases.clear();
+    if ( rootState->_reluStoreStateIsStored )
+    {
+        const ReluConstraintStore::State &reluState = rootState->_reluStoreState;
+        for ( unsigned i = 0; i < reluState.size(); ++i )
+        {
+            if ( reluState._phaseStatus[i] != ReluConstraint::PHASE_NOT_FIXED )
+                warmStart._fixedReluPhases[_reluConstraintStore.getB( i )] = reluState._phaseStatus[i];
+        }
+    }
+    else
+    {
+        for ( const auto &constraint : _plConstraints )
+        {
+            if ( !rootState->_plConstraintToState.exists( constraint ) )
+                continue;
+
+            const ReluConstraint *relu =
+                dynamic_cast<const ReluConstraint *>( rootState->_plConstraintToState[constraint] );
+            if ( relu && relu->getPhaseStatus() != ReluConstraint::PHASE_NOT_FIXED )
+                warmStart._fixedReluPhases[relu->getB()] = relu->getPhaseStatus();
+        }
+    }
+}
+
+void Engine::applyWarmStart( const SubQueryWarmStart &warmStart )
+{
+    log( "Applying a warm start" );
+
+    unsigned n = std::min( _tableau->getN(), warmStart._lowerBounds.size() );
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        _tableau->tightenLowerBound( i, warmStart._lowerBounds[i] );
+        _tableau->tightenUpperBound( i, warmStart._upperBounds[i] );
+    }
+
+    // Fix the phases of the ReLUs through the bounds of their b variables
+    for ( const auto &phase : warmStart._fixedReluPhases )
+    {
+        if ( phase.first >= _tableau->getN() )
+            continue;
+
+        if ( phase.second == ReluConstraint::PHASE_ACTIVE )
+            _tableau->tightenLowerBound( phase.first, 0 );
+        else if ( phase.second == ReluConstraint::PHASE_INACTIVE )
+            _tableau->tightenUpperBound( phase.first, 0 );
+    }
+
+    /*
+      Start from the parent's basis, if it fits the current tableau. If
+      it cannot be factorized, keep the current basis.
+    */
+    if ( warmStart._basicVariables.size() != _tableau->getM() )
+        return;
+
+    for ( const auto &basic : warmStart._basicVariables )
+    {
+        if ( basic >= _tableau->getN() )
+            return;
+    }
+
+    Set<unsigned> currentBasics = _tableau->getBasicVariables();
+
+    bool failed = false;
+    try
+    {
+        _tableau->initializeTableau( warmStart._basicVariables );
+    }
+    catch ( MalformedBasisException & )
+    {
+        failed = true;
+    }
+
+    if ( failed )
+    {
+        List<unsigned> currentBasicList;
+        for ( const auto &basic : currentBasics )
+            currentBasicList.append( basic );
+
+        try
+        {
+            _tableau->initializeTableau( currentBasicList );
+        }
+        catch ( MalformedBasisException & )
+        {
+            throw MarabouError( MarabouError::RESTORATION_FAILED_TO_REFACTORIZE_BASIS,
+                                "Warm start failed - could not refactorize basis" );
+        }
+    }
+
+    _costFunctionManager->invalidateCostFunction();
+}
+
 void Engine::performSymbolicBoundTightening()
 {
     if ( ( !GlobalConfiguration::USE_SYMBOLIC_BOUND_TIGHTENING ) ||
@@ -1757,15 +2215,25 @@ void Engine::performSymbolicBoundTightening()
     }
 
     // Step 2: tell the SBT about the state of the ReLU constraints
-    for ( const auto &constraint : _plConstraints )
+    if ( _useReluConstraintStore )
+    {
+        for ( unsigned i = 0; i < _reluConstraintStore.size(); ++i )
+        {
+            SymbolicBoundTightener::NodeIndex nodeIndex =
+                _symbolicBoundTightener->nodeIndexFromB( _reluConstraintStore.getB( i ) );
+            _symbolicBoundTightener->setReluStatus( nodeIndex._layer, nodeIndex._neuron,
+                                                    _reluConstraintStore.getConstraint( i )->getPhaseStatus() );
+        }
+    }
+    else
     {
-        if ( !constraint->supportsSymbolicBoundTightening() )
-            throw MarabouError( MarabouError::SYMBOLIC_BOUND_TIGHTENER_UNSUPPORTED_CONSTRAINT_TYPE );
+        for ( const auto &constraint : _plConstraints )
+        {
+            if ( !constraint->supportsSymbolicBoundTightening() )
+                throw MarabouError( MarabouError::SYMBOLIC_BOUND_TIGHTENER_UNSUPPORTED_CONSTRAINT_TYPE );
 
-        ReluConstraint *relu = (ReluConstraint *)constraint;
-        unsigned b = relu->getB();
-        SymbolicBoundTightener::NodeIndex nodeIndex = _symbolicBoundTightener->nodeIndexFromB( b );
-        _symbolicBoundTightener->setReluStatus( nodeIndex._layer, nodeIndex._neuron, relu->getPhaseStatus() );
+            _symbolicBoundTightener->setConstraintStatus( constraint );
+        }
     }
 
     // Step 3: perfrom the bound tightening
@@ -1814,6 +2282,7 @@ bool Engine::shouldExitDueToTimeout( unsigned timeout ) const
 
 void Engine::reset()
 {
+    _subQuerySplit = PiecewiseLinearCaseSplit();
     resetStatistics();
     clearViolatedPLConstraints();
     resetSmtCore();
@@ -1837,14 +2306,15 @@ void Engine::resetStatistics()
 
 void Engine::clearViolatedPLConstraints()
 {
-    _violatedPlConstraints.clear();
     _plConstraintToFix = NULL;
+    _plConstraintTracker.markAllChanged();
 }
 
 void Engine::resetSmtCore()
 {
     _smtCore.freeMemory();
     _smtCore = SmtCore( this );
+    _smtCore.setStatistics( &_statistics );
 }
 
 void Engine::resetExitCode()
@@ -1864,9 +2334,7 @@ void Engine::warmStart()
     if ( !_networkLevelReasoner )
         return;
 
-    // First, choose an arbitrary assignment for the input variables
     unsigned numInputVariables = _preprocessedQuery.getNumInputVariables();
-    unsigned numOutputVariables = _preprocessedQuery.getNumOutputVariables();
 
     if ( numInputVariables == 0 )
     {
@@ -1874,41 +2342,132 @@ void Engine::warmStart()
         return;
     }
 
-    double *inputAssignment = new double[numInputVariables];
-    double *outputAssignment = new double[numOutputVariables];
+    NetworkLevelReasoner *nlr = _networkLevelReasoner;
+    unsigned numberOfLayers = nlr->getNumberOfLayers();
+    if ( nlr->getLayerSize( 0 ) != numInputVariables )
+        return;
+
+    /*
+      Choose candidate assignments for the input variables: the lower
+      corner of the input box, its upper corner, its center, and
+      pseudo-random points inside it. All candidates are evaluated as
+      one batch.
+    */
+    unsigned numCandidates = std::max( 1U, GlobalConfiguration::WARM_START_NUM_CANDIDATES );
+    Vector<double> inputs( numCandidates * numInputVariables );
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution<double> uniform( 0, 1 );
 
     for ( unsigned i = 0; i < numInputVariables; ++i )
     {
         unsigned variable = _preprocessedQuery.inputVariableByIndex( i );
-        inputAssignment[i] = _tableau->getLowerBound( variable );
+        double lb = _tableau->getLowerBound( variable );
+        double ub = _tableau->getUpperBound( variable );
+
+        for ( unsigned candidate = 0; candidate < numCandidates; ++candidate )
+        {
+            double value;
+            if ( !FloatUtils::isFinite( lb ) || !FloatUtils::isFinite( ub ) )
+                value = FloatUtils::isFinite( lb ) ? lb : ( FloatUtils::isFinite( ub ) ? ub : 0 );
+            else if ( candidate == 0 )
+                value = lb;
+            else if ( candidate == 1 )
+                value = ub;
+            else if ( candidate == 2 )
+                value = ( lb + ub ) / 2;
+            else
+                value = lb + uniform( generator ) * ( ub - lb );
+
+            inputs[candidate * numInputVariables + i] = value;
+        }
     }
 
-    // Evaluate the network for this assignment
-    _networkLevelReasoner->evaluate( inputAssignment, outputAssignment );
+    // Evaluate the network for these assignments
+    unsigned numberOfNeurons = nlr->getNumberOfNeurons();
+    Vector<double> outputs( numCandidates * nlr->getLayerSize( numberOfLayers - 1 ) );
+    Vector<double> weightedSums( numCandidates * numberOfNeurons );
+    Vector<double> activationResults( numCandidates * numberOfNeurons );
+    nlr->evaluateBatch( inputs.data(), numCandidates, outputs.data(),
+                        weightedSums.data(), activationResults.data() );
 
-    // Try to update as many variables as possible to match their assignment
-    for ( const auto &assignment : _networkLevelReasoner->getIndexToWeightedSumAssignment() )
+    // Pick the candidate whose assignment is closest to respecting the variable bounds
+    auto boundViolation = [this]( unsigned variable, double value )
     {
-        unsigned variable = _networkLevelReasoner->getWeightedSumVariable( assignment.first._layer, assignment.first._neuron );
+        double lb = _tableau->getLowerBound( variable );
+        double ub = _tableau->getUpperBound( variable );
+        if ( value < lb )
+            return lb - value;
+        if ( value > ub )
+            return value - ub;
+        return 0.0;
+    };
 
-        if ( !_tableau->isBasic( variable ) )
-            _tableau->setNonBasicAssignment( variable, assignment.second, false );
+    unsigned bestCandidate = 0;
+    double bestViolation = FloatUtils::infinity();
+    for ( unsigned candidate = 0; candidate < numCandidates; ++candidate )
+    {
+        const double *candidateWeightedSums = weightedSums.data() + candidate * numberOfNeurons;
+        const double *candidateActivationResults = activationResults.data() + candidate * numberOfNeurons;
+
+        double violation = 0;
+        unsigned neuronIndex = 0;
+        for ( unsigned layer = 0; layer < numberOfLayers; ++layer )
+        {
+            for ( unsigned neuron = 0; neuron < nlr->getLayerSize( layer ); ++neuron, ++neuronIndex )
+            {
+                if ( nlr->hasWeightedSumVariable( layer, neuron ) )
+                    violation += boundViolation( nlr->getWeightedSumVariable( layer, neuron ),
+                                                 candidateWeightedSums[neuronIndex] );
+
+                if ( nlr->hasActivationResultVariable( layer, neuron ) )
+                    violation += boundViolation( nlr->getActivationResultVariable( layer, neuron ),
+                                                 candidateActivationResults[neuronIndex] );
+            }
+        }
+
+        if ( violation < bestViolation )
+        {
+            bestViolation = violation;
+            bestCandidate = candidate;
+        }
     }
 
-    for ( const auto &assignment : _networkLevelReasoner->getIndexToActivationResultAssignment() )
+    // Try to update as many variables as possible to match their assignment
+    const double *bestWeightedSums = weightedSums.data() + bestCandidate * numberOfNeurons;
+    const double *bestActivationResults = activationResults.data() + bestCandidate * numberOfNeurons;
+
+    unsigned neuronIndex = 0;
+    for ( unsigned layer = 0; layer < numberOfLayers; ++layer )
     {
-        unsigned variable = _networkLevelReasoner->getActivationResultVariable( assignment.first._layer, assignment.first._neuron );
+        for ( unsigned neuron = 0; neuron < nlr->getLayerSize( layer ); ++neuron, ++neuronIndex )
+        {
+            if ( nlr->hasWeightedSumVariable( layer, neuron ) )
+            {
+                unsigned variable = nlr->getWeightedSumVariable( layer, neuron );
+                if ( !_tableau->isBasic( variable ) )
+                    _tableau->setNonBasicAssignment( variable, bestWeightedSums[neuronIndex], false );
+            }
 
+            if ( nlr->hasActivationResultVariable( layer, neuron ) )
+            {
+                unsigned variable = nlr->getActivationResultVariable( layer, neuron );
+                if ( !_tableau->isBasic( variable ) )
+                    _tableau->setNonBasicAssignment( variable, bestActivationResults[neuronIndex], false );
+            }
+        }
+    }
+
+    // Input variables are not necessarily represented in the reasoner
+    for ( unsigned i = 0; i < numInputVariables; ++i )
+    {
+        unsigned variable = _preprocessedQuery.inputVariableByIndex( i );
         if ( !_tableau->isBasic( variable ) )
-            _tableau->setNonBasicAssignment( variable, assignment.second, false );
+            _tableau->setNonBasicAssignment( variable, inputs[bestCandidate * numInputVariables + i], false );
     }
 
     // We did what we could for the non-basics; now let the tableau compute
     // the basic assignment
     _tableau->computeAssignment();
-
-    delete[] outputAssignment;
-    delete[] inputAssignment;
 }
 
 void Engine::checkOverallProgress()
@@ -1948,23 +2507,14 @@ void Engine::updateDirections()
 
 void Engine::updateScores()
 {
-    _candidatePlConstraints.clear();
-    for ( const auto plConstraint : _plConstraints )
-    {
-        if ( plConstraint->isActive() && !plConstraint->phaseFixed() )
-        {
-            plConstraint->updateScore();
-            _candidatePlConstraints.insert( plConstraint );
-        }
-    }
+    _plConstraintTracker.updateSplitCandidates();
 }
 
 PiecewiseLinearConstraint *Engine::pickSplitPLConstraint()
 {
-    updateScores();
-    auto constraint = *_candidatePlConstraints.begin();
-    _candidatePlConstraints.erase( constraint );
-    return constraint;
+    // The chosen constraint is deactivated by the SmtCore when the
+    // split is performed, which removes it from the candidates
+    return _plConstraintTracker.topSplitCandidate();
 }
 
 void Engine::setConstraintViolationThreshold( unsigned threshold )
@@ -22,19 +22,24 @@
 #include "AutoRowBoundTightener.h"
 #include "AutoTableau.h"
 #include "BlandsRule.h"
+#include "ConstraintMatrixScaler.h"
 #include "DantzigsRule.h"
 #include "DegradationChecker.h"
 #include "DivideStrategy.h"
 #include "IEngine.h"
 #include "InputQuery.h"
+#include "LearnedConflictStore.h"
 #include "Map.h"
+#include "PlConstraintTracker.h"
 #include "PrecisionRestorer.h"
 #include "Preprocessor.h"
+#include "ReluConstraintStore.h"
 #include "SignalHandler.h"
 #include "SmtCore.h"
 #include "Statistics.h"
 
 #include <atomic>
+#include <mutex>
 
 #ifdef _WIN32
 #undef ERROR
@@ -43,6 +48,7 @@
 class EngineState;
 class InputQuery;
 class PiecewiseLinearConstraint;
+class SparseUnsortedList;
 class String;
 
 class Engine : public IEngine, public SignalHandler::Signalable
@@ -77,6 +83,7 @@ public:
     void storeState( EngineState &state, bool storeAlsoTableauState ) const;
     void restoreState( const EngineState &state );
     void setNumPlConstraintsDisabledByValidSplits( unsigned numConstraints );
+    void restorePlConstraintActivity( const EngineState &state );
 
     /*
       A request from the user to terminate
@@ -85,6 +92,14 @@ public:
 
     const Statistics *getStatistics() const;
 
+    /*
+      A copy of the statistics as of the most recent snapshot. Unlike
+      getStatistics(), this may be called from another thread while
+      the engine is solving. Snapshots are taken when solving starts
+      and ends, and periodically in between.
+    */
+    Statistics getStatisticsSnapshot() const;
+
     InputQuery *getInputQuery();
 
     /*
@@ -106,6 +121,20 @@ public:
       Add equations and tightenings from a split.
     */
     void applySplit( const PiecewiseLinearCaseSplit &split );
+    void applySubQuerySplit( const PiecewiseLinearCaseSplit &split );
+
+    /*
+      Donate unexplored case splits to the given receiver, when it asks
+      for them (as part of DnC mode).
+    */
+    void setSplitDonationReceiver( SplitDonationReceiver *receiver );
+
+    /*
+      Pass the bounds, basis and ReLU phases from the root of the search
+      on to subqueries (as part of DnC mode).
+    */
+    void extractWarmStart( SubQueryWarmStart &warmStart ) const;
+    void applyWarmStart( const SubQueryWarmStart &warmStart );
 
     /*
       Reset the state of the engine, before solving a new query
@@ -143,6 +172,12 @@ public:
     */
     void setConstraintViolationThreshold( unsigned threshold );
 
+    /*
+      Share learned conflicts with other engines (as part of DnC
+      mode) through the given store.
+    */
+    void setLearnedConflictStore( LearnedConflictStore *store );
+
     /*
       PSA: The following two methods are for DnC only and should be used very
       cautiously.
@@ -187,14 +222,17 @@ private:
     List<PiecewiseLinearConstraint *> _plConstraints;
 
     /*
-      The ordered set of candidate PL constraints for splitting
+      Incrementally tracks the violated PL constraints and the
+      candidate PL constraints for splitting.
     */
-    Set<PiecewiseLinearConstraint *> _candidatePlConstraints;
+    PlConstraintTracker _plConstraintTracker;
 
     /*
-      Piecewise linear constraints that are currently violated.
+      If all the PL constraints are ReLUs, they are also kept in a
+      store, which saves and restores their states in bulk.
     */
-    List<PiecewiseLinearConstraint *> _violatedPlConstraints;
+    ReluConstraintStore _reluConstraintStore;
+    bool _useReluConstraintStore;
 
     /*
       A single, violated PL constraint, selected for fixing.
@@ -239,6 +277,12 @@ private:
     */
     DegradationChecker _degradationChecker;
 
+    /*
+      Scales the equations before the tableau is constructed, if
+      scaling is enabled, and unscales the extracted solution.
+    */
+    ConstraintMatrixScaler _constraintMatrixScaler;
+
     /*
       Query preprocessor.
     */
@@ -255,9 +299,10 @@ private:
     bool _initialStateStored;
 
     /*
-      Work memory (of size m)
+      Work memory (of size at least m), and its allocated size
     */
     double *_work;
+    unsigned _workSize;
 
     /*
       Restoration status.
@@ -280,6 +325,14 @@ private:
     */
     std::atomic_bool _quitRequested;
 
+    /*
+      The latest snapshot of the statistics, and the number of main
+      loop iterations since it was taken.
+    */
+    Statistics _statisticsSnapshot;
+    mutable std::mutex _statisticsSnapshotMutex;
+    unsigned _numIterationsSinceStatisticsSnapshot;
+
     /*
       A code indicating how the run terminated.
     */
@@ -323,6 +376,26 @@ private:
     unsigned _lastNumVisitedStates;
     unsigned long long _lastIterationWithProgress;
 
+    /*
+      A store of learned conflicts shared with other engines, the
+      position up to which its conflicts have been imported, and the
+      imported conflicts.
+    */
+    LearnedConflictStore *_learnedConflictStore;
+    unsigned _learnedConflictStoreCursor;
+    List<const LearnedConflict *> _learnedConflicts;
+
+    /*
+      The split that restricts the search to the current subquery, if
+      any, as part of DnC mode.
+    */
+    PiecewiseLinearCaseSplit _subQuerySplit;
+
+    /*
+      The receiver of donated case splits, if any.
+    */
+    SplitDonationReceiver *_splitDonationReceiver;
+
     /*
       Perform a simplex step: compute the cost function, pick the
       entering and leaving variables and perform a pivot.
@@ -388,16 +461,37 @@ private:
     bool applyAllValidConstraintCaseSplits();
     bool applyValidConstraintCaseSplit( PiecewiseLinearConstraint *constraint );
 
+    /*
+      Import any newly published learned conflicts, and return true
+      iff one of the learned conflicts applies to the current state,
+      which is then known to be infeasible.
+    */
+    bool learnedConflictApplies();
+    bool learnedConflictApplies( const LearnedConflict &conflict ) const;
+
+    /*
+      If the split donation receiver asks for a split, donate one of the
+      unexplored alternatives in the SMT core's stack.
+    */
+    void donateSplitIfNeeded();
+
     /*
       Update statitstics, print them if needed.
     */
     void mainLoopStatistics();
 
     /*
-      Check if the current degradation is high
+      Copy the current statistics into the snapshot.
+    */
+    void takeStatisticsSnapshot();
+
+    /*
+      Check if the current degradation is high. If sample is true,
+      only a rotating sample of the equations is checked, with a full
+      check performed only if the sample looks degraded.
     */
     bool shouldCheckDegradation();
-    bool highDegradation();
+    bool highDegradation( bool sample );
 
     /*
       Perform bound tightening on the constraint matrix A.
@@ -409,12 +503,33 @@ private:
     */
     void adjustWorkMemorySize();
 
+    /*
+      Add the given equations to the tableau as a batch, and append
+      the bounds of the new auxiliary variables to the given vector. The
+      list of equations is cleared.
+    */
+    void addEquationsToTableau( List<Equation> &equations, Vector<Tightening> &bounds );
+
+    /*
+      Tighten a bound that is part of an applied split, taking any
+      merged columns into account.
+    */
+    void applySplitBound( const Tightening &bound );
+
     /*
       Store the original engine state within the precision restorer.
       Restore the tableau from the original version.
     */
     void storeInitialEngineState();
     void performPrecisionRestoration( PrecisionRestorer::RestoreBasics restoreBasics );
+
+    /*
+      The first response to high degradation: recompute the assignment
+      with iterative refinement. Returns true iff this brought the
+      degradation back below the threshold, in which case precision
+      restoration is not needed.
+    */
+    bool performAssignmentRefinement();
     bool basisRestorationNeeded() const;
 
     static void log( const String &message );
@@ -465,11 +580,13 @@ private:
     void invokePreprocessor( const InputQuery &inputQuery, bool preprocess );
     void printInputBounds( const InputQuery &inputQuery ) const;
     void storeEquationsInDegradationChecker();
-    void removeRedundantEquations( const double *constraintMatrix );
-    void selectInitialVariablesForBasis( const double *constraintMatrix, List<unsigned> &initialBasis, List<unsigned> &basicRows );
-    void initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis );
+    void scaleConstraintMatrix();
+    void removeRedundantEquations();
+    void selectInitialVariablesForBasis( List<unsigned> &initialBasis, List<unsigned> &basicRows );
+    void initializeTableau( const SparseUnsortedList * const *constraintMatrix, const List<unsigned> &initialBasis );
     void initializeNetworkLevelReasoning();
-    double *createConstraintMatrix();
+    SparseUnsortedList **createSparseConstraintMatrix();
+    void deleteSparseConstraintMatrix( SparseUnsortedList **constraintMatrix, unsigned m );
     void addAuxiliaryVariables();
     void augmentInitialBasisIfNeeded( List<unsigned> &initialBasis, const List<unsigned> &basicRows );
 
@@ -16,6 +16,8 @@
 #include "EngineState.h"
 
 EngineState::EngineState()
+    : _tableauStateIsStored( false )
+    , _reluStoreStateIsStored( false )
 {
 }
 
@@ -32,6 +34,16 @@ EngineState::~EngineState()
     }
 }
 
+unsigned long long EngineState::getStorageSize() const
+{
+    unsigned long long size = _tableauState.getStorageSize();
+
+    if ( _reluStoreStateIsStored )
+        size += _reluStoreState.getStorageSize();
+
+    return size;
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
@@ -19,6 +19,7 @@
 #include "List.h"
 #include "Map.h"
 #include "PiecewiseLinearConstraint.h"
+#include "ReluConstraintStore.h"
 #include "TableauState.h"
 
 class EngineState
@@ -27,6 +28,13 @@ public:
     EngineState();
     ~EngineState();
 
+    /*
+      The number of bytes held by the stored tableau arrays and ReLU
+      store state. The shared constraint matrix, the basis
+      factorization and the cloned constraints are not counted.
+    */
+    unsigned long long getStorageSize() const;
+
     /*
       The state of the tableau
     */
@@ -37,6 +45,14 @@ public:
       The state of each of the PL constraints
     */
     Map<PiecewiseLinearConstraint *, PiecewiseLinearConstraint *> _plConstraintToState;
+
+    /*
+      When the engine keeps its constraints in a ReLU store, their
+      states are stored here in bulk, instead of in the map above
+    */
+    bool _reluStoreStateIsStored;
+    ReluConstraintStore::State _reluStoreState;
+
     unsigned _numPlConstraintsDisabledByValidSplits;
 
     /*
@@ -0,0 +1,382 @@
+/*********************                                                        */
+/*! \file Falsifier.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "Falsifier.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "NetworkLevelReasoner.h"
+#include "PiecewiseLinearConstraint.h"
+
+#include <algorithm>
+#include <random>
+
+Falsifier::Falsifier()
+    : _numSamples( GlobalConfiguration::FALSIFIER_NUM_SAMPLES )
+    , _numGradientStarts( GlobalConfiguration::FALSIFIER_NUM_GRADIENT_STARTS )
+    , _numGradientSteps( GlobalConfiguration::FALSIFIER_NUM_GRADIENT_STEPS )
+    , _seed( 1 )
+    , _numEvaluations( 0 )
+    , _inputQuery( NULL )
+    , _nlr( NULL )
+    , _numberOfVariables( 0 )
+    , _numInputs( 0 )
+    , _numberOfNeurons( 0 )
+{
+}
+
+void Falsifier::setNumSamples( unsigned numSamples )
+{
+    _numSamples = numSamples;
+}
+
+void Falsifier::setNumGradientStarts( unsigned numGradientStarts )
+{
+    _numGradientStarts = numGradientStarts;
+}
+
+void Falsifier::setNumGradientSteps( unsigned numGradientSteps )
+{
+    _numGradientSteps = numGradientSteps;
+}
+
+void Falsifier::setSeed( unsigned seed )
+{
+    _seed = seed;
+}
+
+unsigned long long Falsifier::getNumEvaluations() const
+{
+    return _numEvaluations;
+}
+
+bool Falsifier::falsify( InputQuery &inputQuery )
+{
+    _numEvaluations = 0;
+    _inputQuery = &inputQuery;
+    _nlr = inputQuery.getNetworkLevelReasoner();
+    if ( !_nlr || _numSamples == 0 )
+        return false;
+
+    _numberOfVariables = inputQuery.getNumberOfVariables();
+    _numInputs = inputQuery.getNumInputVariables();
+    _numberOfNeurons = _nlr->getNumberOfNeurons();
+    if ( _numInputs == 0 )
+        return false;
+
+    Vector<unsigned> inputVariables;
+    Vector<unsigned> outputVariables;
+    for ( unsigned i = 0; i < _numInputs; ++i )
+        inputVariables.append( inputQuery.inputVariableByIndex( i ) );
+    for ( unsigned i = 0; i < inputQuery.getNumOutputVariables(); ++i )
+        outputVariables.append( inputQuery.outputVariableByIndex( i ) );
+
+    if ( !_nlr->mapVariablesToNeuronValues( _numberOfVariables, inputVariables, outputVariables, _variableToValue ) )
+        return false;
+
+    // The input box has to be bounded
+    _inputLowerBounds.clear();
+    _inputUpperBounds.clear();
+    for ( const auto &variable : inputVariables )
+    {
+        double lb = inputQuery.getLowerBound( variable );
+        double ub = inputQuery.getUpperBound( variable );
+        if ( !FloatUtils::isFinite( lb ) || !FloatUtils::isFinite( ub ) || FloatUtils::gt( lb, ub ) )
+            return false;
+
+        _inputLowerBounds.append( lb );
+        _inputUpperBounds.append( ub );
+    }
+
+    // Flatten the bounds and equations
+    _lowerBounds.clear();
+    _upperBounds.clear();
+    for ( unsigned i = 0; i < _numberOfVariables; ++i )
+    {
+        _lowerBounds.append( inputQuery.getLowerBound( i ) );
+        _upperBounds.append( inputQuery.getUpperBound( i ) );
+    }
+
+    _equationStart.clear();
+    _addendVariables.clear();
+    _addendCoefficients.clear();
+    _scalars.clear();
+    _equationTypes.clear();
+    for ( const auto &equation : inputQuery.getEquations() )
+    {
+        _equationStart.append( _addendVariables.size() );
+        for ( const auto &addend : equation._addends )
+        {
+            _addendVariables.append( addend._variable );
+            _addendCoefficients.append( addend._coefficient );
+        }
+        _scalars.append( equation._scalar );
+        _equationTypes.append( equation._type );
+    }
+    _equationStart.append( _addendVariables.size() );
+
+    // Stage 1: uniform random sampling of the input box
+    std::mt19937 generator( _seed );
+    std::uniform_real_distribution<double> uniform( 0, 1 );
+
+    Vector<double> samples( _numSamples * _numInputs );
+    for ( unsigned sample = 0; sample < _numSamples; ++sample )
+    {
+        for ( unsigned i = 0; i < _numInputs; ++i )
+        {
+            samples[sample * _numInputs + i] = _inputLowerBounds[i] +
+                uniform( generator ) * ( _inputUpperBounds[i] - _inputLowerBounds[i] );
+        }
+    }
+
+    Vector<double> violations;
+    unsigned satisfying = evaluate( samples, _numSamples, violations );
+    if ( satisfying < _numSamples && verifyAndStore( samples.data() + satisfying * _numInputs ) )
+        return true;
+
+    // Stage 2: gradient search, starting from the least violating samples
+    unsigned numStarts = std::min( _numGradientStarts, _numSamples );
+    if ( numStarts == 0 || _numGradientSteps == 0 )
+        return false;
+
+    Vector<unsigned> order;
+    for ( unsigned i = 0; i < _numSamples; ++i )
+        order.append( i );
+    std::partial_sort( order.begin(), order.begin() + numStarts, order.end(),
+                       [&]( unsigned a, unsigned b ) { return violations[a] < violations[b]; } );
+
+    Vector<double> starts( numStarts * _numInputs );
+    for ( unsigned i = 0; i < numStarts; ++i )
+        memcpy( starts.data() + i * _numInputs, samples.data() + order[i] * _numInputs, sizeof(double) * _numInputs );
+
+    return gradientSearch( starts, numStarts );
+}
+
+unsigned Falsifier::evaluate( const Vector<double> &inputs, unsigned batchSize, Vector<double> &violations )
+{
+    _outputs = Vector<double>( batchSize * _nlr->getLayerSize( _nlr->getNumberOfLayers() - 1 ) );
+    _activationResults = Vector<double>( batchSize * _numberOfNeurons );
+    _weightedSums = Vector<double>( batchSize * _numberOfNeurons );
+
+    _nlr->evaluateBatch( inputs.data(), batchSize, _outputs.data(), _weightedSums.data(), _activationResults.data() );
+    _numEvaluations += batchSize;
+
+    violations = Vector<double>( batchSize );
+    unsigned firstSatisfying = batchSize;
+    for ( unsigned i = 0; i < batchSize; ++i )
+    {
+        bool satisfied;
+        violations[i] = computeViolation( _activationResults.data() + i * _numberOfNeurons,
+                                          _weightedSums.data() + i * _numberOfNeurons,
+                                          satisfied );
+        if ( satisfied && firstSatisfying == batchSize )
+            firstSatisfying = i;
+    }
+
+    return firstSatisfying;
+}
+
+double Falsifier::valueOf( unsigned variable, const double *activationResults, const double *weightedSums ) const
+{
+    unsigned value = _variableToValue[variable];
+    return value < _numberOfNeurons ? activationResults[value] : weightedSums[value - _numberOfNeurons];
+}
+
+double Falsifier::computeViolation( const double *activationResults, const double *weightedSums,
+                                    bool &satisfied ) const
+{
+    double tolerance = GlobalConfiguration::FALSIFIER_TOLERANCE;
+    double total = 0;
+    satisfied = true;
+
+    for ( unsigned i = 0; i < _numberOfVariables; ++i )
+    {
+        double value = valueOf( i, activationResults, weightedSums );
+
+        double violation = 0;
+        if ( value < _lowerBounds[i] )
+            violation = _lowerBounds[i] - value;
+        else if ( value > _upperBounds[i] )
+            violation = value - _upperBounds[i];
+
+        if ( violation > tolerance )
+            satisfied = false;
+        total += violation;
+    }
+
+    for ( unsigned i = 0; i < _scalars.size(); ++i )
+    {
+        double sum = 0;
+        for ( unsigned j = _equationStart[i]; j < _equationStart[i + 1]; ++j )
+            sum += _addendCoefficients[j] * valueOf( _addendVariables[j], activationResults, weightedSums );
+
+        double violation = 0;
+        switch ( _equationTypes[i] )
+        {
+        case Equation::EQ:
+            violation = FloatUtils::abs( sum - _scalars[i] );
+            break;
+
+        case Equation::LE:
+            violation = std::max( 0.0, sum - _scalars[i] );
+            break;
+
+        case Equation::GE:
+            violation = std::max( 0.0, _scalars[i] - sum );
+            break;
+        }
+
+        if ( violation > tolerance )
+            satisfied = false;
+        total += violation;
+    }
+
+    return total;
+}
+
+bool Falsifier::gradientSearch( Vector<double> &points, unsigned numPoints )
+{
+    enum {
+        // The finite-difference step, relative to the width of the input box
+        DIFFERENCE_STEP_DIVISOR = 10000,
+        // The initial descent step, relative to the width of the input box
+        INITIAL_STEP_DIVISOR = 10,
+    };
+
+    /*
+      Every point is evaluated together with one perturbation per
+      input dimension, to estimate the gradient of the violation.
+      A trial step is accepted if it reduces the violation; otherwise,
+      the step size is halved and a new trial is made from the last
+      accepted point.
+    */
+    unsigned rowsPerPoint = _numInputs + 1;
+    Vector<double> accepted( points );
+    Vector<double> acceptedViolation( numPoints, FloatUtils::infinity() );
+    Vector<double> acceptedGradient( numPoints * _numInputs, 0 );
+    Vector<double> stepSize( numPoints, 1.0 / INITIAL_STEP_DIVISOR );
+
+    Vector<double> trials( points );
+    Vector<double> batch( numPoints * rowsPerPoint * _numInputs );
+    Vector<double> violations;
+
+    for ( unsigned step = 0; step < _numGradientSteps; ++step )
+    {
+        for ( unsigned p = 0; p < numPoints; ++p )
+        {
+            const double *trial = trials.data() + p * _numInputs;
+            for ( unsigned row = 0; row < rowsPerPoint; ++row )
+            {
+                double *point = batch.data() + ( p * rowsPerPoint + row ) * _numInputs;
+                memcpy( point, trial, sizeof(double) * _numInputs );
+
+                if ( row == 0 )
+                    continue;
+
+                // Perturb input row - 1, staying inside the box
+                unsigned i = row - 1;
+                double h = ( _inputUpperBounds[i] - _inputLowerBounds[i] ) / DIFFERENCE_STEP_DIVISOR;
+                point[i] = ( point[i] + h <= _inputUpperBounds[i] ) ? point[i] + h : point[i] - h;
+            }
+        }
+
+        unsigned satisfying = evaluate( batch, numPoints * rowsPerPoint, violations );
+        if ( satisfying < numPoints * rowsPerPoint )
+        {
+            const double *point = batch.data() + satisfying * _numInputs;
+            if ( verifyAndStore( point ) )
+            {
+                memcpy( points.data(), point, sizeof(double) * _numInputs );
+                return true;
+            }
+        }
+
+        for ( unsigned p = 0; p < numPoints; ++p )
+        {
+            double trialViolation = violations[p * rowsPerPoint];
+            double *trial = trials.data() + p * _numInputs;
+            double *acceptedPoint = accepted.data() + p * _numInputs;
+            double *gradient = acceptedGradient.data() + p * _numInputs;
+
+            if ( trialViolation < acceptedViolation[p] )
+            {
+                // Accept the trial, and estimate the gradient there
+                memcpy( acceptedPoint, trial, sizeof(double) * _numInputs );
+                acceptedViolation[p] = trialViolation;
+
+                for ( unsigned i = 0; i < _numInputs; ++i )
+                {
+                    const double *perturbed = batch.data() + ( p * rowsPerPoint + i + 1 ) * _numInputs;
+                    double h = perturbed[i] - trial[i];
+                    gradient[i] = ( violations[p * rowsPerPoint + i + 1] - trialViolation ) / h;
+                }
+            }
+            else
+                stepSize[p] /= 2;
+
+            // Take a projected sign-gradient step from the accepted point
+            for ( unsigned i = 0; i < _numInputs; ++i )
+            {
+                double width = _inputUpperBounds[i] - _inputLowerBounds[i];
+                double direction = gradient[i] > 0 ? -1 : ( gradient[i] < 0 ? 1 : 0 );
+                double value = acceptedPoint[i] + direction * stepSize[p] * width;
+                trial[i] = std::min( _inputUpperBounds[i], std::max( _inputLowerBounds[i], value ) );
+            }
+        }
+    }
+
+    return false;
+}
+
+bool Falsifier::verifyAndStore( const double *input )
+{
+    Vector<double> inputs( _numInputs );
+    memcpy( inputs.data(), input, sizeof(double) * _numInputs );
+
+    Vector<double> violations;
+    if ( evaluate( inputs, 1, violations ) != 0 )
+        return false;
+
+    Vector<double> values( _numberOfVariables );
+    for ( unsigned i = 0; i < _numberOfVariables; ++i )
+        values[i] = valueOf( i, _activationResults.data(), _weightedSums.data() );
+
+    // Check the piecewise-linear constraints on copies, to leave the query intact
+    for ( const auto &constraint : _inputQuery->getPiecewiseLinearConstraints() )
+    {
+        PiecewiseLinearConstraint *copy = constraint->duplicateConstraint();
+        for ( const auto &variable : copy->getParticipatingVariables() )
+            copy->notifyVariableValue( variable, values[variable] );
+
+        bool satisfied = copy->satisfied();
+        delete copy;
+
+        if ( !satisfied )
+            return false;
+    }
+
+    for ( unsigned i = 0; i < _numberOfVariables; ++i )
+        _inputQuery->setSolutionValue( i, values[i] );
+
+    return true;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,137 @@
+/*********************                                                        */
+/*! \file Falsifier.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The falsifier searches for a counterexample to a query before it is
+ ** handed to the engine. Candidate inputs are drawn uniformly from the
+ ** input box and evaluated, as a batch, by the query's network-level
+ ** reasoner; the most promising ones are then improved by a projected
+ ** (sign-)gradient descent on the total violation of the query's
+ ** equations and bounds, with gradients estimated by finite differences.
+
+**/
+
+#ifndef __Falsifier_h__
+#define __Falsifier_h__
+
+#include "InputQuery.h"
+#include "Vector.h"
+
+class Falsifier
+{
+public:
+    Falsifier();
+
+    /*
+      Search for an assignment that satisfies the query. The query
+      must have a network-level reasoner that determines the values of
+      all its variables, and a bounded input box. If a satisfying
+      assignment is found, it is stored as the query's solution and
+      true is returned.
+    */
+    bool falsify( InputQuery &inputQuery );
+
+    /*
+      Set the search parameters (the defaults are taken from
+      GlobalConfiguration) and the seed for the random sampling.
+    */
+    void setNumSamples( unsigned numSamples );
+    void setNumGradientStarts( unsigned numGradientStarts );
+    void setNumGradientSteps( unsigned numGradientSteps );
+    void setSeed( unsigned seed );
+
+    /*
+      The number of network evaluations performed by the last call
+      to falsify()
+    */
+    unsigned long long getNumEvaluations() const;
+
+private:
+    unsigned _numSamples;
+    unsigned _numGradientStarts;
+    unsigned _numGradientSteps;
+    unsigned _seed;
+    unsigned long long _numEvaluations;
+
+    InputQuery *_inputQuery;
+    NetworkLevelReasoner *_nlr;
+    unsigned _numberOfVariables;
+    unsigned _numInputs;
+    unsigned _numberOfNeurons;
+
+    /*
+      The input box, and the location of every variable's value in the
+      reasoner's batch output (see
+      NetworkLevelReasoner::mapVariablesToNeuronValues)
+    */
+    Vector<double> _inputLowerBounds;
+    Vector<double> _inputUpperBounds;
+    Vector<unsigned> _variableToValue;
+
+    /*
+      The bounds of all variables, and the query's equations in a
+      flat form: the addends of equation i are those in positions
+      _equationStart[i] to _equationStart[i+1] - 1.
+    */
+    Vector<double> _lowerBounds;
+    Vector<double> _upperBounds;
+    Vector<unsigned> _equationStart;
+    Vector<unsigned> _addendVariables;
+    Vector<double> _addendCoefficients;
+    Vector<double> _scalars;
+    Vector<Equation::EquationType> _equationTypes;
+
+    /*
+      Buffers for batch evaluation
+    */
+    Vector<double> _outputs;
+    Vector<double> _activationResults;
+    Vector<double> _weightedSums;
+
+    /*
+      Evaluate a batch of inputs, and compute the violation of every
+      point. Returns the index of the first point that satisfies the
+      query, or batchSize if there is none.
+    */
+    unsigned evaluate( const Vector<double> &inputs, unsigned batchSize, Vector<double> &violations );
+
+    /*
+      The total violation of the equations and bounds by the given
+      values of all neurons, and whether all of them are satisfied
+      (up to GlobalConfiguration::FALSIFIER_TOLERANCE)
+    */
+    double computeViolation( const double *activationResults, const double *weightedSums,
+                             bool &satisfied ) const;
+
+    double valueOf( unsigned variable, const double *activationResults, const double *weightedSums ) const;
+
+    /*
+      Improve the given starting points by projected gradient
+      descent. Returns true if a satisfying point was found, in which
+      case it is stored in the first row of the starting points.
+    */
+    bool gradientSearch( Vector<double> &points, unsigned numPoints );
+
+    /*
+      Verify the input point against the query, including its
+      piecewise-linear constraints, and store it as the solution
+    */
+    bool verifyAndStore( const double *input );
+};
+
+#endif // __Falsifier_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -20,6 +20,7 @@
 #include "Set.h"
 
 class SparseMatrix;
+class SparseUnsortedList;
 
 class IConstraintMatrixAnalyzer
 {
@@ -28,6 +29,7 @@ public:
 
     virtual void analyze( const double *matrix, unsigned m, unsigned n ) = 0;
     virtual void analyze( const SparseMatrix *matrix, unsigned m, unsigned n ) = 0;
+    virtual void analyze( const SparseUnsortedList * const *rows, unsigned m, unsigned n ) = 0;
     virtual unsigned getRank() const = 0;
     virtual List<unsigned> getIndependentColumns() const = 0;
     virtual Set<unsigned> getRedundantRows() const = 0;
@@ -26,6 +26,8 @@ class EngineState;
 class Equation;
 class PiecewiseLinearCaseSplit;
 class PiecewiseLinearConstraint;
+struct SubQueryWarmStart;
+
 class IEngine
 {
 public:
@@ -46,6 +48,36 @@ public:
     */
     virtual void applySplit( const PiecewiseLinearCaseSplit &split ) = 0;
 
+    /*
+      Restrict the search to a subquery (as part of DnC mode): apply the
+      split, and remember it as the region being searched.
+    */
+    virtual void applySubQuerySplit( const PiecewiseLinearCaseSplit &split ) = 0;
+
+    /*
+      An object that accepts case splits that the engine has not yet
+      explored, so that they can be explored elsewhere (e.g., by an idle
+      DnC worker). The split describes the entire path in the search
+      tree, and is relative to the region being searched.
+    */
+    class SplitDonationReceiver
+    {
+    public:
+        virtual ~SplitDonationReceiver() {}
+        virtual bool wantsSplit() const = 0;
+        virtual void receiveSplit( const PiecewiseLinearCaseSplit &split ) = 0;
+    };
+
+    virtual void setSplitDonationReceiver( SplitDonationReceiver *receiver ) = 0;
+
+    /*
+      Methods for passing information from a subquery that timed out to
+      the subqueries it is divided into (as part of DnC mode). The warm
+      start should be applied before the subquery split.
+    */
+    virtual void extractWarmStart( SubQueryWarmStart &warmStart ) const = 0;
+    virtual void applyWarmStart( const SubQueryWarmStart &warmStart ) = 0;
+
     /*
       Methods for storing and restoring the state of the engine.
     */
@@ -53,6 +85,12 @@ public:
     virtual void restoreState( const EngineState &state ) = 0;
     virtual void setNumPlConstraintsDisabledByValidSplits( unsigned numConstraints ) = 0;
 
+    /*
+      Restore only the activity status of the PL constraints, as
+      recorded in a stored state.
+    */
+    virtual void restorePlConstraintActivity( const EngineState &state ) = 0;
+
     /*
       Solve the encoded query.
     */
@@ -95,6 +95,7 @@ public:
 
     virtual void setDimensions( unsigned m, unsigned n ) = 0;
     virtual void setConstraintMatrix( const double *A ) = 0;
+    virtual void setConstraintMatrix( const SparseUnsortedList * const *rows ) = 0;
     virtual void setRightHandSide( const double *b ) = 0;
     virtual void setRightHandSide( unsigned index, double value ) = 0;
     virtual void markAsBasic( unsigned variable ) = 0;
@@ -140,6 +141,7 @@ public:
     virtual void computePivotRow() = 0;
     virtual const TableauRow *getPivotRow() const = 0;
     virtual void computeAssignment() = 0;
+    virtual void computeRefinedAssignment( unsigned refinementSteps ) = 0;
     virtual bool checkValueWithinBounds( unsigned variable, double value ) = 0;
     virtual void dump() const = 0;
     virtual void dumpAssignment() = 0;
@@ -149,8 +151,11 @@ public:
     virtual void assignIndexToBasicVariable( unsigned variable, unsigned index ) = 0;
     virtual unsigned variableToIndex( unsigned index ) const = 0;
     virtual unsigned addEquation( const Equation &equation ) = 0;
+    virtual void addEquations( const List<Equation> &equations, List<unsigned> &auxVariables ) = 0;
     virtual unsigned getM() const = 0;
     virtual unsigned getN() const = 0;
+    virtual unsigned getMCapacity() const = 0;
+    virtual unsigned getNCapacity() const = 0;
     virtual void getTableauRow( unsigned index, TableauRow *row ) = 0;
     virtual const double *getAColumn( unsigned variable ) const = 0;
     virtual void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const = 0;
@@ -35,23 +35,36 @@ void LargestIntervalDivider::createSubQueries( unsigned numNewSubqueries,
 
     List<InputRegion> inputRegions;
 
-    // Create the first input region from the previous case split
+    // Create the first input region from the previous case split. Any
+    // bounds on other variables, and any equations (e.g., from a split
+    // donated by another worker) are kept as they are in all new splits.
     InputRegion region;
-    List<Tightening> bounds = previousSplit.getBoundTightenings();
+    PiecewiseLinearCaseSplit otherConstraints;
+    const Vector<Tightening> &bounds( previousSplit.getBoundTightenings() );
     for ( const auto &bound : bounds )
     {
-        if ( bound._type == Tightening::LB )
+        if ( !_inputVariables.exists( bound._variable ) )
+            otherConstraints.storeBoundTightening( bound );
+        else if ( bound._type == Tightening::LB )
         {
-            region._lowerBounds[bound._variable] = bound._value;
+            // Keep the tightest bound, if there are several
+            if ( !region._lowerBounds.exists( bound._variable ) ||
+                 region._lowerBounds[bound._variable] < bound._value )
+                region._lowerBounds[bound._variable] = bound._value;
         }
         else
         {
             ASSERT( bound._type == Tightening::UB );
-            region._upperBounds[bound._variable] = bound._value;
+            if ( !region._upperBounds.exists( bound._variable ) ||
+                 region._upperBounds[bound._variable] > bound._value )
+                region._upperBounds[bound._variable] = bound._value;
         }
     }
     inputRegions.append( region );
 
+    for ( const auto &equation : previousSplit.getEquations() )
+        otherConstraints.addEquation( equation );
+
     // Repeatedly bisect the dimension with the largest interval
     for ( unsigned i = 0; i < numBisects; ++i )
     {
@@ -88,6 +101,7 @@ void LargestIntervalDivider::createSubQueries( unsigned numNewSubqueries,
             split->storeBoundTightening( Tightening( variable, ub,
                                                      Tightening::UB ) );
         }
+        split->addSplit( otherConstraints );
 
         // Construct the new subquery and add it to subqueries
         SubQuery *subQuery = new SubQuery;
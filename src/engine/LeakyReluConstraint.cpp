@@ -0,0 +1,442 @@
+/*********************                                                        */
+/*! \file LeakyReluConstraint.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "IConstraintBoundTightener.h"
+#include "ITableau.h"
+#include "InputQuery.h"
+#include "LeakyReluConstraint.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "Statistics.h"
+
+#ifdef _WIN32
+#define __attribute__(x)
+#endif
+
+LeakyReluConstraint::LeakyReluConstraint( unsigned b, unsigned f, double slope )
+    : _b( b )
+    , _f( f )
+    , _slope( slope )
+    , _phaseStatus( PHASE_NOT_FIXED )
+    , _haveEliminatedVariables( false )
+{
+    if ( !( slope > 0 && slope < 1 ) )
+        throw MarabouError( MarabouError::INVALID_LEAKY_RELU_SLOPE,
+                            Stringf( "Slope: %lf", slope ).ascii() );
+}
+
+LeakyReluConstraint::LeakyReluConstraint( const String &serializedLeakyRelu )
+    : _phaseStatus( PHASE_NOT_FIXED )
+    , _haveEliminatedVariables( false )
+{
+    String constraintType = serializedLeakyRelu.substring( 0, 10 );
+    ASSERT( constraintType == String( "leaky_relu" ) );
+
+    // Remove the constraint type in serialized form
+    String serializedValues = serializedLeakyRelu.substring( 11, serializedLeakyRelu.length() - 11 );
+    List<String> values = serializedValues.tokenize( "," );
+
+    ASSERT( values.size() == 3 );
+
+    auto var = values.begin();
+    _f = atoi( var->ascii() );
+    ++var;
+    _b = atoi( var->ascii() );
+    ++var;
+    _slope = atof( var->ascii() );
+
+    if ( !( _slope > 0 && _slope < 1 ) )
+        throw MarabouError( MarabouError::INVALID_LEAKY_RELU_SLOPE,
+                            Stringf( "Slope: %lf", _slope ).ascii() );
+}
+
+PiecewiseLinearConstraint *LeakyReluConstraint::duplicateConstraint() const
+{
+    LeakyReluConstraint *clone = new LeakyReluConstraint( _b, _f, _slope );
+    *clone = *this;
+    return clone;
+}
+
+void LeakyReluConstraint::restoreState( const PiecewiseLinearConstraint *state )
+{
+    const LeakyReluConstraint *leakyRelu = dynamic_cast<const LeakyReluConstraint *>( state );
+    *this = *leakyRelu;
+}
+
+void LeakyReluConstraint::registerAsWatcher( ITableau *tableau )
+{
+    tableau->registerToWatchVariable( this, _b );
+    tableau->registerToWatchVariable( this, _f );
+}
+
+void LeakyReluConstraint::unregisterAsWatcher( ITableau *tableau )
+{
+    tableau->unregisterToWatchVariable( this, _b );
+    tableau->unregisterToWatchVariable( this, _f );
+}
+
+void LeakyReluConstraint::notifyVariableValue( unsigned variable, double value )
+{
+    _assignment[variable] = value;
+    reportStateChange();
+}
+
+void LeakyReluConstraint::notifyLowerBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incNumBoundNotificationsPlConstraints();
+
+    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+        return;
+
+    _lowerBounds[variable] = bound;
+    updatePhaseStatus();
+    reportStateChange();
+
+    propagateEntailedTightenings();
+}
+
+void LeakyReluConstraint::notifyUpperBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incNumBoundNotificationsPlConstraints();
+
+    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+        return;
+
+    _upperBounds[variable] = bound;
+    updatePhaseStatus();
+    reportStateChange();
+
+    propagateEntailedTightenings();
+}
+
+void LeakyReluConstraint::propagateEntailedTightenings()
+{
+    if ( !isActive() || !_constraintBoundTightener )
+        return;
+
+    List<Tightening> tightenings;
+    getEntailedTightenings( tightenings );
+    for ( const auto &tightening : tightenings )
+    {
+        if ( tightening._type == Tightening::LB )
+            _constraintBoundTightener->registerTighterLowerBound( tightening._variable, tightening._value );
+        else if ( tightening._type == Tightening::UB )
+            _constraintBoundTightener->registerTighterUpperBound( tightening._variable, tightening._value );
+    }
+}
+
+bool LeakyReluConstraint::participatingVariable( unsigned variable ) const
+{
+    return ( variable == _b ) || ( variable == _f );
+}
+
+List<unsigned> LeakyReluConstraint::getParticipatingVariables() const
+{
+    return List<unsigned>( { _b, _f } );
+}
+
+bool LeakyReluConstraint::satisfied() const
+{
+    if ( !( _assignment.exists( _b ) && _assignment.exists( _f ) ) )
+        throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
+
+    return FloatUtils::areEqual( leakyRelu( _assignment.get( _b ) ), _assignment.get( _f ) );
+}
+
+List<PiecewiseLinearConstraint::Fix> LeakyReluConstraint::getPossibleFixes() const
+{
+    ASSERT( !satisfied() );
+
+    double bValue = _assignment.get( _b );
+    double fValue = _assignment.get( _f );
+
+    // The function is invertible, so either variable can be fixed
+    List<PiecewiseLinearConstraint::Fix> fixes;
+    fixes.append( PiecewiseLinearConstraint::Fix( _f, leakyRelu( bValue ) ) );
+    fixes.append( PiecewiseLinearConstraint::Fix( _b, inverse( fValue ) ) );
+    return fixes;
+}
+
+List<PiecewiseLinearConstraint::Fix> LeakyReluConstraint::getSmartFixes( ITableau * ) const
+{
+    return getPossibleFixes();
+}
+
+List<PiecewiseLinearCaseSplit> LeakyReluConstraint::getCaseSplits() const
+{
+    if ( _phaseStatus != PHASE_NOT_FIXED )
+        throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
+
+    List<PiecewiseLinearCaseSplit> splits;
+
+    // Start with the phase that matches the current assignment of b
+    if ( _assignment.exists( _b ) && FloatUtils::isNegative( _assignment.get( _b ) ) )
+    {
+        splits.append( getInactiveSplit() );
+        splits.append( getActiveSplit() );
+    }
+    else
+    {
+        splits.append( getActiveSplit() );
+        splits.append( getInactiveSplit() );
+    }
+
+    return splits;
+}
+
+PiecewiseLinearCaseSplit LeakyReluConstraint::getActiveSplit() const
+{
+    // Active phase: b >= 0, b - f = 0
+    PiecewiseLinearCaseSplit activePhase;
+    activePhase.storeBoundTightening( Tightening( _b, 0.0, Tightening::LB ) );
+    activePhase.storeBoundTightening( Tightening( _f, 0.0, Tightening::LB ) );
+    Equation activeEquation( Equation::EQ );
+    activeEquation.addAddend( 1, _b );
+    activeEquation.addAddend( -1, _f );
+    activeEquation.setScalar( 0 );
+    activePhase.addEquation( activeEquation );
+    return activePhase;
+}
+
+PiecewiseLinearCaseSplit LeakyReluConstraint::getInactiveSplit() const
+{
+    // Inactive phase: b <= 0, slope * b - f = 0
+    PiecewiseLinearCaseSplit inactivePhase;
+    inactivePhase.storeBoundTightening( Tightening( _b, 0.0, Tightening::UB ) );
+    inactivePhase.storeBoundTightening( Tightening( _f, 0.0, Tightening::UB ) );
+    Equation inactiveEquation( Equation::EQ );
+    inactiveEquation.addAddend( _slope, _b );
+    inactiveEquation.addAddend( -1, _f );
+    inactiveEquation.setScalar( 0 );
+    inactivePhase.addEquation( inactiveEquation );
+    return inactivePhase;
+}
+
+bool LeakyReluConstraint::phaseFixed() const
+{
+    return _phaseStatus != PHASE_NOT_FIXED;
+}
+
+PiecewiseLinearCaseSplit LeakyReluConstraint::getValidCaseSplit() const
+{
+    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+
+    if ( _phaseStatus == PHASE_ACTIVE )
+        return getActiveSplit();
+
+    return getInactiveSplit();
+}
+
+void LeakyReluConstraint::updatePhaseStatus()
+{
+    if ( _phaseStatus != PHASE_NOT_FIXED )
+        return;
+
+    // b and f always have the same sign
+    if ( !FloatUtils::isNegative( getLowerBound( _b ) ) || !FloatUtils::isNegative( getLowerBound( _f ) ) )
+        _phaseStatus = PHASE_ACTIVE;
+    else if ( !FloatUtils::isPositive( getUpperBound( _b ) ) || !FloatUtils::isPositive( getUpperBound( _f ) ) )
+        _phaseStatus = PHASE_INACTIVE;
+}
+
+void LeakyReluConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
+{
+    double bLowerBound = getLowerBound( _b );
+    double bUpperBound = getUpperBound( _b );
+    double fLowerBound = getLowerBound( _f );
+    double fUpperBound = getUpperBound( _f );
+
+    // The function is monotone and invertible, so bounds are propagated exactly
+    tightenings.append( Tightening( _f, leakyRelu( bLowerBound ), Tightening::LB ) );
+    tightenings.append( Tightening( _f, leakyRelu( bUpperBound ), Tightening::UB ) );
+    tightenings.append( Tightening( _b, inverse( fLowerBound ), Tightening::LB ) );
+    tightenings.append( Tightening( _b, inverse( fUpperBound ), Tightening::UB ) );
+
+    if ( _phaseStatus == PHASE_ACTIVE )
+    {
+        tightenings.append( Tightening( _b, 0, Tightening::LB ) );
+        tightenings.append( Tightening( _f, 0, Tightening::LB ) );
+    }
+    else if ( _phaseStatus == PHASE_INACTIVE )
+    {
+        tightenings.append( Tightening( _b, 0, Tightening::UB ) );
+        tightenings.append( Tightening( _f, 0, Tightening::UB ) );
+    }
+}
+
+void LeakyReluConstraint::dump( String &output ) const
+{
+    output = Stringf( "LeakyReluConstraint: x%u = LeakyReLU( x%u ), slope %lf. Active? %s. PhaseStatus = %u (%s).\n",
+                      _f, _b, _slope,
+                      _constraintActive ? "Yes" : "No",
+                      _phaseStatus, phaseToString( _phaseStatus ).ascii() );
+
+    output += Stringf( "b in [%lf, %lf], f in [%lf, %lf]",
+                       getLowerBound( _b ), getUpperBound( _b ), getLowerBound( _f ), getUpperBound( _f ) );
+}
+
+void LeakyReluConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
+{
+    ASSERT( oldIndex == _b || oldIndex == _f );
+    ASSERT( newIndex != _b && newIndex != _f );
+
+    if ( _assignment.exists( oldIndex ) )
+    {
+        _assignment[newIndex] = _assignment.get( oldIndex );
+        _assignment.erase( oldIndex );
+    }
+
+    if ( _lowerBounds.exists( oldIndex ) )
+    {
+        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
+        _lowerBounds.erase( oldIndex );
+    }
+
+    if ( _upperBounds.exists( oldIndex ) )
+    {
+        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
+        _upperBounds.erase( oldIndex );
+    }
+
+    if ( oldIndex == _b )
+        _b = newIndex;
+    else
+        _f = newIndex;
+}
+
+void LeakyReluConstraint::eliminateVariable( __attribute__((unused)) unsigned variable,
+                                             __attribute__((unused)) double fixedValue )
+{
+    ASSERT( variable == _b || variable == _f );
+
+    // The partner variable has been fixed by the entailed tightenings
+    _haveEliminatedVariables = true;
+}
+
+bool LeakyReluConstraint::constraintObsolete() const
+{
+    return _haveEliminatedVariables;
+}
+
+void LeakyReluConstraint::addAuxiliaryEquations( InputQuery &inputQuery )
+{
+    /*
+      We want to add the equations
+
+          f >= b, f >= slope * b
+
+      Which actually become
+
+          f - b - aux1 = 0, f - slope * b - aux2 = 0
+
+      for non-negative aux1 and aux2.
+    */
+    for ( double coefficient : { 1.0, _slope } )
+    {
+        unsigned aux = inputQuery.getNumberOfVariables();
+        inputQuery.setNumberOfVariables( aux + 1 );
+
+        Equation equation( Equation::EQ );
+        equation.addAddend( 1.0, _f );
+        equation.addAddend( -coefficient, _b );
+        equation.addAddend( -1.0, aux );
+        equation.setScalar( 0 );
+        inputQuery.addEquation( equation );
+
+        inputQuery.setLowerBound( aux, 0 );
+    }
+}
+
+String LeakyReluConstraint::serializeToString() const
+{
+    // Output format is: leaky_relu,f,b,slope
+    return Stringf( "leaky_relu,%u,%u,%.15lf", _f, _b, _slope );
+}
+
+unsigned LeakyReluConstraint::getB() const
+{
+    return _b;
+}
+
+unsigned LeakyReluConstraint::getF() const
+{
+    return _f;
+}
+
+double LeakyReluConstraint::getSlope() const
+{
+    return _slope;
+}
+
+LeakyReluConstraint::PhaseStatus LeakyReluConstraint::getPhaseStatus() const
+{
+    return _phaseStatus;
+}
+
+bool LeakyReluConstraint::supportsSymbolicBoundTightening() const
+{
+    return true;
+}
+
+double LeakyReluConstraint::getLowerBound( unsigned variable ) const
+{
+    return _lowerBounds.exists( variable ) ? _lowerBounds.get( variable ) : FloatUtils::negativeInfinity();
+}
+
+double LeakyReluConstraint::getUpperBound( unsigned variable ) const
+{
+    return _upperBounds.exists( variable ) ? _upperBounds.get( variable ) : FloatUtils::infinity();
+}
+
+double LeakyReluConstraint::leakyRelu( double value ) const
+{
+    return value >= 0 ? value : _slope * value;
+}
+
+double LeakyReluConstraint::inverse( double value ) const
+{
+    return value >= 0 ? value : value / _slope;
+}
+
+String LeakyReluConstraint::phaseToString( PhaseStatus phase )
+{
+    switch ( phase )
+    {
+    case PHASE_NOT_FIXED:
+        return "PHASE_NOT_FIXED";
+
+    case PHASE_ACTIVE:
+        return "PHASE_ACTIVE";
+
+    case PHASE_INACTIVE:
+        return "PHASE_INACTIVE";
+
+    default:
+        return "UNKNOWN";
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
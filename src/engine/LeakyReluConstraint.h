@@ -0,0 +1,186 @@
+/*********************                                                        */
+/*! \file LeakyReluConstraint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The constraint f = LeakyReLU( b ), i.e. f = b for non-negative b and
+ ** f = slope * b for negative b, for a slope strictly between 0 and 1.
+ ** It has two phases: the active phase (b >= 0, f = b) and the
+ ** inactive phase (b <= 0, f = slope * b).
+
+ **/
+
+#ifndef __LeakyReluConstraint_h__
+#define __LeakyReluConstraint_h__
+
+#include "Map.h"
+#include "PiecewiseLinearConstraint.h"
+
+class LeakyReluConstraint : public PiecewiseLinearConstraint
+{
+public:
+    enum PhaseStatus {
+        PHASE_NOT_FIXED = 0,
+        PHASE_ACTIVE = 1,
+        PHASE_INACTIVE = 2,
+    };
+
+    LeakyReluConstraint( unsigned b, unsigned f, double slope );
+    LeakyReluConstraint( const String &serializedLeakyRelu );
+
+    /*
+      Return a clone of the constraint.
+    */
+    PiecewiseLinearConstraint *duplicateConstraint() const;
+
+    /*
+      Restore the state of this constraint from the given one.
+    */
+    void restoreState( const PiecewiseLinearConstraint *state );
+
+    /*
+      Register/unregister the constraint with a talbeau.
+     */
+    void registerAsWatcher( ITableau *tableau );
+    void unregisterAsWatcher( ITableau *tableau );
+
+    /*
+      These callbacks are invoked when a watched variable's value
+      changes, or when its bounds change.
+    */
+    void notifyVariableValue( unsigned variable, double value );
+    void notifyLowerBound( unsigned variable, double bound );
+    void notifyUpperBound( unsigned variable, double bound );
+
+    /*
+      Returns true iff the variable participates in this piecewise
+      linear constraint
+    */
+    bool participatingVariable( unsigned variable ) const;
+
+    /*
+      Get the list of variables participating in this constraint.
+    */
+    List<unsigned> getParticipatingVariables() const;
+
+    /*
+      Returns true iff the assignment satisfies the constraint
+    */
+    bool satisfied() const;
+
+    /*
+      Returns a list of possible fixes for the violated constraint.
+    */
+    List<PiecewiseLinearConstraint::Fix> getPossibleFixes() const;
+
+    /*
+      Return a list of smart fixes for violated constraint.
+    */
+    List<PiecewiseLinearConstraint::Fix> getSmartFixes( ITableau *tableau ) const;
+
+    /*
+      Returns the list of case splits that this piecewise linear
+      constraint breaks into: the active and the inactive phase.
+     */
+    List<PiecewiseLinearCaseSplit> getCaseSplits() const;
+
+    /*
+      Check if the constraint's phase has been fixed.
+    */
+    bool phaseFixed() const;
+
+    /*
+      If the constraint's phase has been fixed, get the (valid) case split.
+    */
+    PiecewiseLinearCaseSplit getValidCaseSplit() const;
+
+    /*
+      Preprocessing related functions, to inform that a variable has been eliminated completely
+      because it was fixed to some value, or that a variable's index has changed (e.g., x4 is now
+      called x2). As the leaky ReLU is invertible, fixing either variable fixes the other, and
+      the constraint becomes obsolete.
+    */
+    void eliminateVariable( unsigned variable, double fixedValue );
+    void updateVariableIndex( unsigned oldIndex, unsigned newIndex );
+    bool constraintObsolete() const;
+
+    /*
+      Get the tightenings entailed by the constraint.
+    */
+    void getEntailedTightenings( List<Tightening> &tightenings ) const;
+
+    /*
+      Dump the current state of the constraint.
+    */
+    void dump( String &output ) const;
+
+    /*
+      For preprocessing: add the equations f - b - aux1 = 0 and
+      f - slope * b - aux2 = 0, for non-negative aux1 and aux2 (i.e.,
+      f >= b and f >= slope * b).
+    */
+    void addAuxiliaryEquations( InputQuery &inputQuery );
+
+    /*
+      Returns string with shape: leaky_relu,_f,_b,_slope
+    */
+    String serializeToString() const;
+
+    unsigned getB() const;
+    unsigned getF() const;
+    double getSlope() const;
+    PhaseStatus getPhaseStatus() const;
+
+    /*
+      Return true if and only if this piecewise linear constraint supports
+      symbolic bound tightening.
+    */
+    bool supportsSymbolicBoundTightening() const;
+
+private:
+    unsigned _b, _f;
+    double _slope;
+    PhaseStatus _phaseStatus;
+    bool _haveEliminatedVariables;
+
+    double getLowerBound( unsigned variable ) const;
+    double getUpperBound( unsigned variable ) const;
+
+    /*
+      The leaky ReLU function and its inverse
+    */
+    double leakyRelu( double value ) const;
+    double inverse( double value ) const;
+
+    PiecewiseLinearCaseSplit getActiveSplit() const;
+    PiecewiseLinearCaseSplit getInactiveSplit() const;
+
+    /*
+      Fix the phase, if the bounds rule out one of the phases.
+    */
+    void updatePhaseStatus();
+
+    /*
+      Inform the constraint bound tightener, if one is registered, of
+      the currently entailed tightenings.
+    */
+    void propagateEntailedTightenings();
+
+    static String phaseToString( PhaseStatus phase );
+};
+
+#endif // __LeakyReluConstraint_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
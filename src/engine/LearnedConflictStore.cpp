@@ -0,0 +1,104 @@
+/*********************                                                        */
+/*! \file LearnedConflictStore.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "LearnedConflictStore.h"
+#include "MarabouError.h"
+
+void LearnedConflict::addSplit( const PiecewiseLinearCaseSplit &split )
+{
+    _bounds += split.getBoundTightenings();
+
+    if ( !split.getEquations().empty() )
+        _splitsWithEquations.append( split );
+}
+
+LearnedConflictStore::LearnedConflictStore( unsigned capacity )
+    : _capacity( capacity )
+    , _slots( NULL )
+    , _numReservedSlots( 0 )
+{
+    _slots = new std::atomic<LearnedConflict *>[_capacity];
+    if ( !_slots )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "LearnedConflictStore::slots" );
+
+    for ( unsigned i = 0; i < _capacity; ++i )
+        _slots[i].store( NULL );
+}
+
+LearnedConflictStore::~LearnedConflictStore()
+{
+    if ( _slots )
+    {
+        for ( unsigned i = 0; i < _capacity; ++i )
+        {
+            LearnedConflict *conflict = _slots[i].load();
+            if ( conflict )
+                delete conflict;
+        }
+
+        delete[] _slots;
+        _slots = NULL;
+    }
+}
+
+bool LearnedConflictStore::publish( LearnedConflict *conflict )
+{
+    // Avoid growing the counter once the store is full
+    if ( _numReservedSlots.load() >= _capacity )
+    {
+        delete conflict;
+        return false;
+    }
+
+    unsigned slot = _numReservedSlots.fetch_add( 1 );
+    if ( slot >= _capacity )
+    {
+        delete conflict;
+        return false;
+    }
+
+    _slots[slot].store( conflict, std::memory_order_release );
+    return true;
+}
+
+void LearnedConflictStore::importConflicts( unsigned &cursor, List<const LearnedConflict *> &conflicts ) const
+{
+    unsigned end = size();
+    while ( cursor < end )
+    {
+        // A slot may have been reserved but not yet filled; if so,
+        // stop here and resume from it next time
+        const LearnedConflict *conflict = _slots[cursor].load( std::memory_order_acquire );
+        if ( !conflict )
+            return;
+
+        conflicts.append( conflict );
+        ++cursor;
+    }
+}
+
+unsigned LearnedConflictStore::size() const
+{
+    unsigned reserved = _numReservedSlots.load();
+    return reserved < _capacity ? reserved : _capacity;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,99 @@
+/*********************                                                        */
+/*! \file LearnedConflictStore.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A store of learned conflicts, shared by the engines of the
+ ** divide-and-conquer workers. Workers publish the conflicts they
+ ** learn, and periodically import the conflicts published by others.
+ **
+ ** The store is append-only and lock-free: publishing reserves a slot
+ ** with an atomic counter and then fills it, and readers scan the
+ ** slots from their own cursor. Conflicts are immutable once they are
+ ** published, and are only deleted when the store itself is deleted.
+
+**/
+
+#ifndef __LearnedConflictStore_h__
+#define __LearnedConflictStore_h__
+
+#include "List.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "Tightening.h"
+#include "Vector.h"
+
+#include <atomic>
+
+/*
+  A learned conflict: a conjunction of case splits, within a region of
+  the input space, that has been proven infeasible. A conflict with no
+  case splits means that the entire region is infeasible.
+*/
+class LearnedConflict
+{
+public:
+    /*
+      Add a case split to the conflict. The bounds of the split are
+      added to the bounds of the conflict; only splits that also add
+      equations are stored as a whole.
+    */
+    void addSplit( const PiecewiseLinearCaseSplit &split );
+
+    /*
+      Bounds that must be implied by the current bounds for the
+      conflict to apply: the bounds of the region, and the bound
+      tightenings of the case splits.
+    */
+    Vector<Tightening> _bounds;
+
+    /*
+      Case splits that add equations, which must have been applied
+      for the conflict to apply.
+    */
+    List<PiecewiseLinearCaseSplit> _splitsWithEquations;
+};
+
+class LearnedConflictStore
+{
+public:
+    LearnedConflictStore( unsigned capacity );
+    ~LearnedConflictStore();
+
+    /*
+      Publish a conflict. The store takes ownership of the conflict.
+      Return false (and delete the conflict) if the store is full.
+    */
+    bool publish( LearnedConflict *conflict );
+
+    /*
+      Append to the list all the conflicts that were published since
+      the given cursor, and advance the cursor.
+    */
+    void importConflicts( unsigned &cursor, List<const LearnedConflict *> &conflicts ) const;
+
+    /*
+      The number of published conflicts.
+    */
+    unsigned size() const;
+
+private:
+    unsigned _capacity;
+    std::atomic<LearnedConflict *> *_slots;
+    std::atomic_uint _numReservedSlots;
+};
+
+#endif // __LearnedConflictStore_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -17,6 +17,7 @@
 #include "AcasParser.h"
 #include "GlobalConfiguration.h"
 #include "File.h"
+#include "Falsifier.h"
 #include "MStringf.h"
 #include "Marabou.h"
 #include "Options.h"
@@ -31,6 +32,7 @@
 Marabou::Marabou( unsigned verbosity )
     : _acasParser( NULL )
     , _engine( verbosity )
+    , _falsified( false )
 {
 }
 
@@ -121,6 +123,18 @@ void Marabou::prepareInputQuery()
 
 void Marabou::solveQuery()
 {
+    if ( Options::get()->getBool( Options::FALSIFY ) )
+    {
+        Falsifier falsifier;
+        _falsified = falsifier.falsify( _inputQuery );
+        printf( "Falsifier: %s after %llu network evaluations\n\n",
+                _falsified ? "found a satisfying assignment" : "no satisfying assignment found",
+                falsifier.getNumEvaluations() );
+
+        if ( _falsified )
+            return;
+    }
+
     if ( _engine.processInputQuery( _inputQuery ) )
         _engine.solve( Options::get()->getInt( Options::TIMEOUT ) );
 
@@ -130,7 +144,7 @@ void Marabou::solveQuery()
 
 void Marabou::displayResults( unsigned long long microSecondsElapsed ) const
 {
-    Engine::ExitCode result = _engine.getExitCode();
+    Engine::ExitCode result = _falsified ? Engine::SAT : _engine.getExitCode();
     String resultString;
 
     if ( result == Engine::UNSAT )
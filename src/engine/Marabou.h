@@ -59,6 +59,12 @@ private:
       The solver
     */
     Engine _engine;
+
+    /*
+      Whether the query was solved by the falsifier, before the
+      engine was invoked
+    */
+    bool _falsified;
 };
 
 #endif // __Marabou_h__
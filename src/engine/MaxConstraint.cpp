@@ -100,6 +100,7 @@ void MaxConstraint::notifyVariableValue( unsigned variable, double value )
         _maxIndexSet = true;
 	  }
     _assignment[variable] = value;
+    reportStateChange();
 }
 
 void MaxConstraint::notifyLowerBound( unsigned variable, double value )
@@ -111,33 +112,14 @@ void MaxConstraint::notifyLowerBound( unsigned variable, double value )
         return;
 
     _lowerBounds[variable] = value;
-
-    bool maxErased = false;
+    reportStateChange();
 
     if ( _elements.exists( variable ) && FloatUtils::gt( value, _maxLowerBound ) )
-    {
         _maxLowerBound = value;
-        List<unsigned> toRemove;
-        for ( auto element : _elements )
-        {
-			if ( element == variable )
-				continue;
-            if ( _upperBounds.exists( element ) &&
-                 FloatUtils::lt( _upperBounds[element], value ) )
-            {
-                toRemove.append( element );
-            }
-        }
-        for ( unsigned removeVar : toRemove )
-        {
-            _elements.erase( removeVar );
-            if ( _maxIndex == removeVar )
-                maxErased = true;
-        }
-    }
 
-	if ( maxErased )
-		resetMaxIndex();
+    // A higher lower bound for f or for an element may dominate other elements
+    if ( variable == _f || _elements.exists( variable ) )
+        removeDominatedElements();
 
     if ( isActive() && _constraintBoundTightener )
     {
@@ -164,13 +146,18 @@ void MaxConstraint::notifyUpperBound( unsigned variable, double value )
         return;
 
     _upperBounds[variable] = value;
+    reportStateChange();
 
-    if ( _elements.exists( variable ) && FloatUtils::lt( value, _maxLowerBound ) )
+    // Only the element whose upper bound has changed may have become dominated
+    if ( _elements.exists( variable ) && _elements.size() > 1 &&
+         FloatUtils::lt( value, getDominationThreshold() ) )
     {
         _elements.erase( variable );
+        if ( _maxIndexSet && _maxIndex == variable )
+            resetMaxIndex();
     }
 
-    // There is no need to recompute the max lower bound and max index here.
+    // There is no need to recompute the max lower bound here.
 
     if ( isActive() && _constraintBoundTightener )
     {
@@ -239,6 +226,60 @@ void MaxConstraint::getEntailedTightenings( List<Tightening> &tightenings ) cons
     // TODO: can we derive additional bounds?
 }
 
+double MaxConstraint::getDominationThreshold() const
+{
+    // The maximum is at least the largest lower bound of any element, and at least f's lower bound
+    if ( _lowerBounds.exists( _f ) )
+        return FloatUtils::max( _maxLowerBound, _lowerBounds.get( _f ) );
+    return _maxLowerBound;
+}
+
+void MaxConstraint::removeDominatedElements()
+{
+    double threshold = getDominationThreshold();
+    if ( !FloatUtils::isFinite( threshold ) )
+        return;
+
+    List<unsigned> toRemove;
+    unsigned largestUpperBoundElement = 0;
+    double largestUpperBound = FloatUtils::negativeInfinity();
+    for ( auto element : _elements )
+    {
+        if ( !_upperBounds.exists( element ) )
+            continue;
+
+        double upperBound = _upperBounds[element];
+        if ( FloatUtils::lt( upperBound, threshold ) )
+        {
+            toRemove.append( element );
+            if ( upperBound > largestUpperBound )
+            {
+                largestUpperBound = upperBound;
+                largestUpperBoundElement = element;
+            }
+        }
+    }
+
+    /*
+      If every element is dominated (by f's lower bound), the bounds
+      are infeasible. Keep one element, so that the entailed bound on f
+      exposes the infeasibility.
+    */
+    if ( toRemove.size() == _elements.size() )
+        toRemove.erase( largestUpperBoundElement );
+
+    bool maxErased = false;
+    for ( unsigned element : toRemove )
+    {
+        _elements.erase( element );
+        if ( _maxIndexSet && _maxIndex == element )
+            maxErased = true;
+    }
+
+    if ( maxErased )
+        resetMaxIndex();
+}
+
 bool MaxConstraint::participatingVariable( unsigned variable ) const
 {
     return ( variable == _f ) || _elements.exists( variable );
@@ -375,18 +416,24 @@ PiecewiseLinearCaseSplit MaxConstraint::getSplit( unsigned argMax ) const
     // store bound tightenings as well
     // go over all other elements;
     // their upper bound cannot exceed upper bound of argmax
+    double argMaxLowerBound = _lowerBounds.exists( argMax ) ?
+        _lowerBounds.get( argMax ) : FloatUtils::negativeInfinity();
+
     for ( unsigned other : _elements )
 	{
 	    if ( argMax == other )
             continue;
 
-	    Equation gtEquation( Equation::GE );
-
-	    // argMax >= other
-	    gtEquation.addAddend( -1, other );
-	    gtEquation.addAddend( 1, argMax );
-	    gtEquation.setScalar( 0 );
-	    maxPhase.addEquation( gtEquation );
+        // argMax >= other. No need for an equation if the bounds already imply it.
+        if ( !( _upperBounds.exists( other ) &&
+                FloatUtils::lte( _upperBounds[other], argMaxLowerBound ) ) )
+        {
+            Equation gtEquation( Equation::GE );
+            gtEquation.addAddend( -1, other );
+            gtEquation.addAddend( 1, argMax );
+            gtEquation.setScalar( 0 );
+            maxPhase.addEquation( gtEquation );
+        }
 
         if ( _upperBounds.exists( argMax ) )
         {
@@ -132,6 +132,14 @@ class MaxConstraint : public PiecewiseLinearConstraint
 
     void resetMaxIndex();
 
+    /*
+      An element whose upper bound is below the threshold (the largest
+      lower bound of f and of the elements) can never be the maximum.
+      Remove such elements, keeping at least one.
+    */
+    double getDominationThreshold() const;
+    void removeDominatedElements();
+
     /*
       Returns the phase where variable argMax has maximum value.
     */
@@ -17,10 +17,21 @@
 #include "MStringf.h"
 #include "NetworkLevelReasoner.h"
 #include "MarabouError.h"
+#include <algorithm>
 #include <cstring>
 
+const unsigned NetworkLevelReasoner::NO_VARIABLE = (unsigned)-1;
+
+enum {
+    // The number of batch rows that are propagated through the network together
+    BATCH_BLOCK_SIZE = 64,
+    // The number of source neurons whose outgoing weights are applied together
+    SOURCE_BLOCK_SIZE = 128,
+};
+
 NetworkLevelReasoner::NetworkLevelReasoner()
-    : _weights( NULL )
+    : _numberOfLayers( 0 )
+    , _numberOfNeurons( 0 )
     , _maxLayerSize( 0 )
     , _work1( NULL )
     , _work2( NULL )
@@ -34,20 +45,16 @@ NetworkLevelReasoner::~NetworkLevelReasoner()
 
 void NetworkLevelReasoner::freeMemoryIfNeeded()
 {
-    if ( _weights )
+    for ( unsigned i = 0; i < _denseWeights.size(); ++i )
     {
-        for ( unsigned i = 0; i < _numberOfLayers - 1; ++i )
+        if ( _denseWeights[i] )
         {
-            if ( _weights[i] )
-            {
-                delete[] _weights[i];
-                _weights[i] = NULL;
-            }
+            delete[] _denseWeights[i];
+            _denseWeights[i] = NULL;
         }
-
-        delete[] _weights;
-        _weights = NULL;
     }
+    _denseWeights.clear();
+    _incomingWeights.clear();
 
     if ( _work1 )
     {
@@ -65,6 +72,14 @@ void NetworkLevelReasoner::freeMemoryIfNeeded()
 void NetworkLevelReasoner::setNumberOfLayers( unsigned numberOfLayers )
 {
     _numberOfLayers = numberOfLayers;
+    _layerSizes = Vector<unsigned>( numberOfLayers, 0 );
+    _weightStorage = Vector<WeightStorage>( numberOfLayers, DENSE );
+    _maxLayerSize = 0;
+}
+
+unsigned NetworkLevelReasoner::getNumberOfLayers() const
+{
+    return _numberOfLayers;
 }
 
 void NetworkLevelReasoner::setLayerSize( unsigned layer, unsigned size )
@@ -76,256 +91,378 @@ void NetworkLevelReasoner::setLayerSize( unsigned layer, unsigned size )
         _maxLayerSize = size;
 }
 
+unsigned NetworkLevelReasoner::getLayerSize( unsigned layer ) const
+{
+    ASSERT( layer < _numberOfLayers );
+    return _layerSizes[layer];
+}
+
+void NetworkLevelReasoner::setWeightStorage( unsigned sourceLayer, WeightStorage storage )
+{
+    ASSERT( sourceLayer + 1 < _numberOfLayers );
+    _weightStorage[sourceLayer] = storage;
+}
+
 void NetworkLevelReasoner::allocateWeightMatrices()
 {
     freeMemoryIfNeeded();
 
-    _weights = new double*[_numberOfLayers - 1];
-    if ( !_weights )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "NetworkLevelReasoner::weights" );
+    _layerOffsets = Vector<unsigned>( _numberOfLayers, 0 );
+    _numberOfNeurons = 0;
+    for ( unsigned i = 0; i < _numberOfLayers; ++i )
+    {
+        _layerOffsets[i] = _numberOfNeurons;
+        _numberOfNeurons += _layerSizes[i];
+    }
 
-    for ( unsigned i = 0; i < _numberOfLayers - 1; ++i )
+    for ( unsigned i = 0; i + 1 < _numberOfLayers; ++i )
     {
-        _weights[i] = new double[_layerSizes[i] * _layerSizes[i+1]];
-        if ( !_weights[i] )
+        if ( _weightStorage[i] == SPARSE )
+        {
+            _denseWeights.append( NULL );
+            continue;
+        }
+
+        unsigned size = _layerSizes[i] * _layerSizes[i+1];
+        double *weights = new double[size];
+        if ( !weights )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "NetworkLevelReasoner::weights[i]" );
-        std::fill_n( _weights[i], _layerSizes[i] * _layerSizes[i+1], 0 );
+        std::fill_n( weights, size, 0 );
+        _denseWeights.append( weights );
     }
 
-    _work1 = new double[_maxLayerSize];
+    _incomingWeights = Vector<Vector<SparseWeight>>( _numberOfNeurons );
+
+    _bias = Vector<double>( _numberOfNeurons, 0 );
+    _activationFunction = Vector<ActivationFunction>( _numberOfNeurons, Identity );
+    _weightedSumVariable = Vector<unsigned>( _numberOfNeurons, NO_VARIABLE );
+    _activationResultVariable = Vector<unsigned>( _numberOfNeurons, NO_VARIABLE );
+    _weightedSumAssignment = Vector<double>( _numberOfNeurons, 0 );
+    _activationResultAssignment = Vector<double>( _numberOfNeurons, 0 );
+
+    _work1 = new double[BATCH_BLOCK_SIZE * _maxLayerSize];
     if ( !_work1 )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "NetworkLevelReasoner::work1" );
 
-    _work2 = new double[_maxLayerSize];
+    _work2 = new double[BATCH_BLOCK_SIZE * _maxLayerSize];
     if ( !_work2 )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "NetworkLevelReasoner::work2" );
 }
 
+unsigned NetworkLevelReasoner::flatIndex( unsigned layer, unsigned neuron ) const
+{
+    ASSERT( layer < _numberOfLayers && neuron < _layerSizes[layer] );
+    return _layerOffsets[layer] + neuron;
+}
+
 void NetworkLevelReasoner::setNeuronActivationFunction( unsigned layer, unsigned neuron, ActivationFunction activationFuction )
 {
-    _neuronToActivationFunction[Index( layer, neuron )] = activationFuction;
+    _activationFunction[flatIndex( layer, neuron )] = activationFuction;
 }
 
 void NetworkLevelReasoner::setWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron, double weight )
 {
-    ASSERT( _weights );
+    ASSERT( sourceLayer + 1 < _numberOfLayers );
+    ASSERT( sourceNeuron < _layerSizes[sourceLayer] && targetNeuron < _layerSizes[sourceLayer + 1] );
 
-    unsigned targetLayerSize = _layerSizes[sourceLayer + 1];
-    _weights[sourceLayer][sourceNeuron * targetLayerSize + targetNeuron] = weight;
+    if ( _weightStorage[sourceLayer] == DENSE )
+    {
+        unsigned targetLayerSize = _layerSizes[sourceLayer + 1];
+        _denseWeights[sourceLayer][sourceNeuron * targetLayerSize + targetNeuron] = weight;
+        return;
+    }
+
+    Vector<SparseWeight> &incoming = _incomingWeights[flatIndex( sourceLayer + 1, targetNeuron )];
+    for ( unsigned i = 0; i < incoming.size(); ++i )
+    {
+        if ( incoming[i]._source == sourceNeuron )
+        {
+            incoming[i]._weight = weight;
+            return;
+        }
+    }
+
+    incoming.append( SparseWeight( sourceNeuron, weight ) );
 }
 
 void NetworkLevelReasoner::setBias( unsigned layer, unsigned neuron, double bias )
 {
-    _bias[Index( layer, neuron )] = bias;
+    _bias[flatIndex( layer, neuron )] = bias;
 }
 
 void NetworkLevelReasoner::evaluate( double *input, double *output )
 {
-    memcpy( _work1, input, sizeof(double) * _layerSizes[0] );
+    evaluateBatch( input, 1, output, _weightedSumAssignment.data(), _activationResultAssignment.data() );
+}
 
-    for ( unsigned targetLayer = 1; targetLayer < _numberOfLayers; ++targetLayer )
+void NetworkLevelReasoner::evaluateBatch( const double *inputs, unsigned batchSize, double *outputs,
+                                          double *weightedSums, double *activationResults )
+{
+    unsigned inputLayerSize = _layerSizes[0];
+    unsigned outputLayerSize = _layerSizes[_numberOfLayers - 1];
+
+    for ( unsigned firstRow = 0; firstRow < batchSize; firstRow += BATCH_BLOCK_SIZE )
     {
-        unsigned sourceLayer = targetLayer - 1;
-        unsigned sourceLayerSize = _layerSizes[sourceLayer];
-        unsigned targetLayerSize = _layerSizes[targetLayer];
+        unsigned numRows = std::min( (unsigned)BATCH_BLOCK_SIZE, batchSize - firstRow );
+
+        double *sources = _work1;
+        double *targets = _work2;
+        memcpy( sources, inputs + firstRow * inputLayerSize, sizeof(double) * numRows * inputLayerSize );
 
-        for ( unsigned targetNeuron = 0; targetNeuron < targetLayerSize; ++targetNeuron )
+        for ( unsigned row = 0; row < numRows; ++row )
         {
-            Index index( targetLayer, targetNeuron );
-            _work2[targetNeuron] = _bias.exists( index ) ? _bias[index] : 0;
+            const double *input = sources + row * inputLayerSize;
+            if ( weightedSums )
+                memcpy( weightedSums + ( firstRow + row ) * _numberOfNeurons, input, sizeof(double) * inputLayerSize );
+            if ( activationResults )
+                memcpy( activationResults + ( firstRow + row ) * _numberOfNeurons, input, sizeof(double) * inputLayerSize );
+        }
 
-            for ( unsigned sourceNeuron = 0; sourceNeuron < sourceLayerSize; ++sourceNeuron )
-            {
-                double weight = _weights[sourceLayer][sourceNeuron * targetLayerSize + targetNeuron];
-                _work2[targetNeuron] += _work1[sourceNeuron] * weight;
-            }
+        for ( unsigned targetLayer = 1; targetLayer < _numberOfLayers; ++targetLayer )
+        {
+            unsigned targetLayerSize = _layerSizes[targetLayer];
+            unsigned targetOffset = _layerOffsets[targetLayer];
 
-            // Store weighted sum if needed
-            if ( _indexToWeightedSumVariable.exists( index ) )
-                _indexToWeightedSumAssignment[index] = _work2[targetNeuron];
+            computeWeightedSums( targetLayer, numRows, sources, targets );
 
-            // Apply activation function
-            if ( _neuronToActivationFunction.exists( index ) )
+            // Apply the activation functions, and store the values if needed
+            for ( unsigned row = 0; row < numRows; ++row )
             {
-                switch ( _neuronToActivationFunction[index] )
+                double *target = targets + row * targetLayerSize;
+
+                if ( weightedSums )
+                    memcpy( weightedSums + ( firstRow + row ) * _numberOfNeurons + targetOffset,
+                            target, sizeof(double) * targetLayerSize );
+
+                for ( unsigned neuron = 0; neuron < targetLayerSize; ++neuron )
                 {
-                case ReLU:
-                    if ( _work2[targetNeuron] < 0 )
-                        _work2[targetNeuron] = 0;
-                    break;
-
-                default:
-                    ASSERT( false );
-                    break;
+                    switch ( _activationFunction[targetOffset + neuron] )
+                    {
+                    case ReLU:
+                        if ( target[neuron] < 0 )
+                            target[neuron] = 0;
+                        break;
+
+                    case Identity:
+                        break;
+
+                    default:
+                        ASSERT( false );
+                        break;
+                    }
                 }
+
+                if ( activationResults )
+                    memcpy( activationResults + ( firstRow + row ) * _numberOfNeurons + targetOffset,
+                            target, sizeof(double) * targetLayerSize );
             }
 
-            // Store activation result if needed
-            if ( _indexToActivationResultVariable.exists( index ) )
-                _indexToActivationResultAssignment[index] = _work2[targetNeuron];
+            std::swap( sources, targets );
         }
 
-        memcpy( _work1, _work2, sizeof(double) * targetLayerSize );
+        memcpy( outputs + firstRow * outputLayerSize, sources, sizeof(double) * numRows * outputLayerSize );
     }
-
-    memcpy( output, _work1, sizeof(double) * _layerSizes[_numberOfLayers - 1] );
 }
 
-void NetworkLevelReasoner::setWeightedSumVariable( unsigned layer, unsigned neuron, unsigned variable )
+void NetworkLevelReasoner::computeWeightedSums( unsigned targetLayer, unsigned numRows,
+                                                const double *sources, double *targets ) const
 {
-    _indexToWeightedSumVariable[Index( layer, neuron )] = variable;
-}
+    unsigned sourceLayer = targetLayer - 1;
+    unsigned sourceLayerSize = _layerSizes[sourceLayer];
+    unsigned targetLayerSize = _layerSizes[targetLayer];
+    const double *bias = _bias.data() + _layerOffsets[targetLayer];
 
-unsigned NetworkLevelReasoner::getWeightedSumVariable( unsigned layer, unsigned neuron ) const
-{
-    Index index( layer, neuron );
-    if ( !_indexToWeightedSumVariable.exists( index ) )
-        throw MarabouError( MarabouError::INVALID_WEIGHTED_SUM_INDEX, Stringf( "weighted sum: <%u,%u>", layer, neuron ).ascii() );
+    for ( unsigned row = 0; row < numRows; ++row )
+        memcpy( targets + row * targetLayerSize, bias, sizeof(double) * targetLayerSize );
+
+    if ( _weightStorage[sourceLayer] == SPARSE )
+    {
+        const Vector<SparseWeight> *incomingWeights = _incomingWeights.data() + _layerOffsets[targetLayer];
+        for ( unsigned row = 0; row < numRows; ++row )
+        {
+            const double *source = sources + row * sourceLayerSize;
+            double *target = targets + row * targetLayerSize;
 
-    return _indexToWeightedSumVariable[index];
+            for ( unsigned neuron = 0; neuron < targetLayerSize; ++neuron )
+            {
+                const Vector<SparseWeight> &incoming = incomingWeights[neuron];
+                for ( unsigned i = 0; i < incoming.size(); ++i )
+                    target[neuron] += source[incoming[i]._source] * incoming[i]._weight;
+            }
+        }
+
+        return;
+    }
+
+    /*
+      Dense layers: targets += sources * weights, where the weight
+      matrix is stored row by row. The source neurons are processed in
+      blocks, so that the block's weights stay in the cache while they
+      are applied to all rows.
+    */
+    const double *weights = _denseWeights[sourceLayer];
+    for ( unsigned firstSource = 0; firstSource < sourceLayerSize; firstSource += SOURCE_BLOCK_SIZE )
+    {
+        unsigned lastSource = std::min( firstSource + (unsigned)SOURCE_BLOCK_SIZE, sourceLayerSize );
+
+        for ( unsigned row = 0; row < numRows; ++row )
+        {
+            const double *source = sources + row * sourceLayerSize;
+            double *target = targets + row * targetLayerSize;
+
+            for ( unsigned sourceNeuron = firstSource; sourceNeuron < lastSource; ++sourceNeuron )
+            {
+                double sourceValue = source[sourceNeuron];
+                if ( sourceValue == 0 )
+                    continue;
+
+                const double *weightRow = weights + sourceNeuron * targetLayerSize;
+                for ( unsigned targetNeuron = 0; targetNeuron < targetLayerSize; ++targetNeuron )
+                    target[targetNeuron] += sourceValue * weightRow[targetNeuron];
+            }
+        }
+    }
 }
 
-void NetworkLevelReasoner::setActivationResultVariable( unsigned layer, unsigned neuron, unsigned variable )
+unsigned NetworkLevelReasoner::getNumberOfNeurons() const
 {
-    _indexToActivationResultVariable[Index( layer, neuron )] = variable;
+    return _numberOfNeurons;
 }
 
-unsigned NetworkLevelReasoner::getActivationResultVariable( unsigned layer, unsigned neuron ) const
+bool NetworkLevelReasoner::mapVariablesToNeuronValues( unsigned numberOfVariables,
+                                                       const Vector<unsigned> &inputVariables,
+                                                       const Vector<unsigned> &outputVariables,
+                                                       Vector<unsigned> &variableToValue ) const
 {
-    Index index( layer, neuron );
-    if ( !_indexToActivationResultVariable.exists( index ) )
-        throw MarabouError( MarabouError::INVALID_WEIGHTED_SUM_INDEX, Stringf( "activation result: <%u,%u>", layer, neuron ).ascii() );
+    if ( _numberOfLayers < 2 ||
+         inputVariables.size() != _layerSizes[0] ||
+         outputVariables.size() != _layerSizes[_numberOfLayers - 1] )
+        return false;
 
-    return _indexToActivationResultVariable[index];
-}
+    unsigned unmapped = 2 * _numberOfNeurons;
+    variableToValue = Vector<unsigned>( numberOfVariables, unmapped );
 
-void NetworkLevelReasoner::storeIntoOther( NetworkLevelReasoner &other ) const
-{
-    other.freeMemoryIfNeeded();
+    auto map = [&]( unsigned variable, unsigned value )
+    {
+        if ( variable < numberOfVariables )
+            variableToValue[variable] = value;
+    };
 
-    other.setNumberOfLayers( _numberOfLayers );
-    for ( const auto &pair : _layerSizes )
-        other.setLayerSize( pair.first, pair.second );
-    other.allocateWeightMatrices();
+    unsigned outputOffset = _layerOffsets[_numberOfLayers - 1];
+    for ( unsigned i = 0; i < inputVariables.size(); ++i )
+        map( inputVariables[i], i );
+    for ( unsigned i = 0; i < outputVariables.size(); ++i )
+        map( outputVariables[i], outputOffset + i );
 
-    for ( const auto &pair : _neuronToActivationFunction )
-        other.setNeuronActivationFunction( pair.first._layer, pair.first._neuron, pair.second );
+    for ( unsigned i = 0; i < _numberOfNeurons; ++i )
+    {
+        if ( _activationResultVariable[i] != NO_VARIABLE )
+            map( _activationResultVariable[i], i );
+        if ( _weightedSumVariable[i] != NO_VARIABLE )
+            map( _weightedSumVariable[i], _numberOfNeurons + i );
+    }
 
-    for ( unsigned i = 0; i < _numberOfLayers - 1; ++i )
-        memcpy( other._weights[i], _weights[i], sizeof(double) * _layerSizes[i] * _layerSizes[i+1] );
+    for ( unsigned i = 0; i < numberOfVariables; ++i )
+    {
+        if ( variableToValue[i] == unmapped )
+            return false;
+    }
 
-    for ( const auto &pair : _bias )
-        other.setBias( pair.first._layer, pair.first._neuron, pair.second );
+    return true;
+}
 
-    other._indexToWeightedSumVariable = _indexToWeightedSumVariable;
-    other._indexToActivationResultVariable = _indexToActivationResultVariable;
-    other._indexToWeightedSumAssignment = _indexToWeightedSumAssignment;
-    other._indexToActivationResultAssignment = _indexToActivationResultAssignment;
+void NetworkLevelReasoner::setWeightedSumVariable( unsigned layer, unsigned neuron, unsigned variable )
+{
+    _weightedSumVariable[flatIndex( layer, neuron )] = variable;
 }
 
-const Map<NetworkLevelReasoner::Index, unsigned> &NetworkLevelReasoner::getIndexToWeightedSumVariable()
+bool NetworkLevelReasoner::hasWeightedSumVariable( unsigned layer, unsigned neuron ) const
 {
-    return _indexToWeightedSumVariable;
+    return _weightedSumVariable[flatIndex( layer, neuron )] != NO_VARIABLE;
 }
 
-const Map<NetworkLevelReasoner::Index, unsigned> &NetworkLevelReasoner::getIndexToActivationResultVariable()
+unsigned NetworkLevelReasoner::getWeightedSumVariable( unsigned layer, unsigned neuron ) const
 {
-    return _indexToActivationResultVariable;
+    if ( layer >= _numberOfLayers || neuron >= _layerSizes[layer] ||
+         !hasWeightedSumVariable( layer, neuron ) )
+        throw MarabouError( MarabouError::INVALID_WEIGHTED_SUM_INDEX, Stringf( "weighted sum: <%u,%u>", layer, neuron ).ascii() );
+
+    return _weightedSumVariable[flatIndex( layer, neuron )];
 }
 
-const Map<NetworkLevelReasoner::Index, double> &NetworkLevelReasoner::getIndexToWeightedSumAssignment()
+void NetworkLevelReasoner::setActivationResultVariable( unsigned layer, unsigned neuron, unsigned variable )
 {
-    return _indexToWeightedSumAssignment;
+    _activationResultVariable[flatIndex( layer, neuron )] = variable;
 }
 
-const Map<NetworkLevelReasoner::Index, double> &NetworkLevelReasoner::getIndexToActivationResultAssignment()
+bool NetworkLevelReasoner::hasActivationResultVariable( unsigned layer, unsigned neuron ) const
 {
-    return _indexToActivationResultAssignment;
+    return _activationResultVariable[flatIndex( layer, neuron )] != NO_VARIABLE;
 }
 
-void NetworkLevelReasoner::updateVariableIndices( const Map<unsigned, unsigned> &oldIndexToNewIndex,
-                                                  const Map<unsigned, unsigned> &mergedVariables )
+unsigned NetworkLevelReasoner::getActivationResultVariable( unsigned layer, unsigned neuron ) const
 {
-    // First, do a pass to handle any merged variables
-    auto bIt = _indexToWeightedSumVariable.begin();
-    while ( bIt != _indexToWeightedSumVariable.end() )
-    {
-        unsigned b = bIt->second;
+    if ( layer >= _numberOfLayers || neuron >= _layerSizes[layer] ||
+         !hasActivationResultVariable( layer, neuron ) )
+        throw MarabouError( MarabouError::INVALID_WEIGHTED_SUM_INDEX, Stringf( "activation result: <%u,%u>", layer, neuron ).ascii() );
 
-        while ( mergedVariables.exists( b ) )
-        {
-            bIt->second = mergedVariables[b];
-            b = bIt->second;
-        }
+    return _activationResultVariable[flatIndex( layer, neuron )];
+}
 
-        ++bIt;
-    }
+double NetworkLevelReasoner::getWeightedSumAssignment( unsigned layer, unsigned neuron ) const
+{
+    return _weightedSumAssignment[flatIndex( layer, neuron )];
+}
 
-    auto fIt = _indexToActivationResultVariable.begin();
-    while ( fIt != _indexToActivationResultVariable.end() )
-    {
-        unsigned f = fIt->second;
+double NetworkLevelReasoner::getActivationResultAssignment( unsigned layer, unsigned neuron ) const
+{
+    return _activationResultAssignment[flatIndex( layer, neuron )];
+}
 
-        while ( mergedVariables.exists( f ) )
-        {
-            fIt->second = mergedVariables[f];
-            f = fIt->second;
-        }
+void NetworkLevelReasoner::storeIntoOther( NetworkLevelReasoner &other ) const
+{
+    other.freeMemoryIfNeeded();
 
-        ++fIt;
-    }
+    other.setNumberOfLayers( _numberOfLayers );
+    for ( unsigned i = 0; i < _numberOfLayers; ++i )
+        other.setLayerSize( i, _layerSizes[i] );
+    other._weightStorage = _weightStorage;
+    other.allocateWeightMatrices();
 
-    // Now handle re-indexing
-    bIt = _indexToWeightedSumVariable.begin();
-    while ( bIt != _indexToWeightedSumVariable.end() )
+    for ( unsigned i = 0; i + 1 < _numberOfLayers; ++i )
     {
-        unsigned b = bIt->second;
-
-        if ( !oldIndexToNewIndex.exists( b ) )
-        {
-            // This variable has been eliminated, remove from map
-            bIt = _indexToWeightedSumVariable.erase( bIt );
-        }
-        else
-        {
-            if ( oldIndexToNewIndex[b] == b )
-            {
-                // Index hasn't changed, skip
-            }
-            else
-            {
-                // Index has changed
-                bIt->second = oldIndexToNewIndex[b];
-            }
-
-            ++bIt;
-            continue;
-        }
+        if ( _weightStorage[i] == DENSE )
+            memcpy( other._denseWeights[i], _denseWeights[i], sizeof(double) * _layerSizes[i] * _layerSizes[i+1] );
     }
+    other._incomingWeights = _incomingWeights;
+
+    other._bias = _bias;
+    other._activationFunction = _activationFunction;
+    other._weightedSumVariable = _weightedSumVariable;
+    other._activationResultVariable = _activationResultVariable;
+    other._weightedSumAssignment = _weightedSumAssignment;
+    other._activationResultAssignment = _activationResultAssignment;
+}
 
-    fIt = _indexToActivationResultVariable.begin();
-    while ( fIt != _indexToActivationResultVariable.end() )
+void NetworkLevelReasoner::updateVariableIndices( const Map<unsigned, unsigned> &oldIndexToNewIndex,
+                                                  const Map<unsigned, unsigned> &mergedVariables )
+{
+    for ( unsigned i = 0; i < _numberOfNeurons; ++i )
     {
-        unsigned f = fIt->second;
-        if ( !oldIndexToNewIndex.exists( f ) )
-        {
-            // This variable has been eliminated, remove from map
-            fIt = _indexToActivationResultVariable.erase( fIt );
-        }
-        else
+        for ( unsigned *variable : { &_weightedSumVariable[i], &_activationResultVariable[i] } )
         {
-            if ( oldIndexToNewIndex[f] == f )
-            {
-                // Index hasn't changed, skip
-            }
-            else
-            {
-                // Index has changed
-                fIt->second = oldIndexToNewIndex[f];
-            }
+            if ( *variable == NO_VARIABLE )
+                continue;
 
-            ++fIt;
-            continue;
+            // First, handle any merged variables
+            while ( mergedVariables.exists( *variable ) )
+                *variable = mergedVariables[*variable];
+
+            // Now handle re-indexing. Eliminated variables are removed
+            if ( !oldIndexToNewIndex.exists( *variable ) )
+                *variable = NO_VARIABLE;
+            else
+                *variable = oldIndexToNewIndex[*variable];
         }
     }
 }
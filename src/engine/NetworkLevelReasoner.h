@@ -17,10 +17,19 @@
 #define __NetworkLevelReasoner_h__
 
 #include "Map.h"
+#include "Vector.h"
 
 /*
   A class for performing operations that require knowledge of network
   level structure and topology.
+
+  The network is a sequence of fully connected layers, where each
+  layer only feeds into the next one. All per-neuron data (biases,
+  activation functions, variables and assignments) is stored in flat
+  vectors, indexed by the neuron's position in the network. The
+  weights between two consecutive layers are stored either as a dense
+  matrix or, for sparsely connected layers, as per-neuron lists of
+  incoming weights.
 */
 
 class NetworkLevelReasoner
@@ -60,14 +69,26 @@ public:
     /*
       Interface methods for populating the network: settings its
       number of layers and the layer sizes, kinds of activation
-      functions, weights and biases, etc.
+      functions, weights and biases, etc. The number of layers and
+      the layer sizes must be set before allocateWeightMatrices() is
+      invoked; everything else must be set afterwards. Neurons
+      without an activation function are treated as Identity.
     */
     enum ActivationFunction {
         ReLU,
+        Identity,
+    };
+
+    enum WeightStorage {
+        DENSE,
+        SPARSE,
     };
 
     void setNumberOfLayers( unsigned numberOfLayers );
+    unsigned getNumberOfLayers() const;
     void setLayerSize( unsigned layer, unsigned size );
+    unsigned getLayerSize( unsigned layer ) const;
+    void setWeightStorage( unsigned sourceLayer, WeightStorage storage );
     void allocateWeightMatrices();
     void setNeuronActivationFunction( unsigned layer, unsigned neuron, ActivationFunction activationFuction );
     void setWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron, double weight );
@@ -78,24 +99,53 @@ public:
       weighted sum values and activation result values.
     */
     void setWeightedSumVariable( unsigned layer, unsigned neuron, unsigned variable );
+    bool hasWeightedSumVariable( unsigned layer, unsigned neuron ) const;
     unsigned getWeightedSumVariable( unsigned layer, unsigned neuron ) const;
     void setActivationResultVariable( unsigned layer, unsigned neuron, unsigned variable );
+    bool hasActivationResultVariable( unsigned layer, unsigned neuron ) const;
     unsigned getActivationResultVariable( unsigned layer, unsigned neuron ) const;
-    const Map<Index, unsigned> &getIndexToWeightedSumVariable();
-    const Map<Index, unsigned> &getIndexToActivationResultVariable();
 
     /*
-      Mapping from node indices to the nodes' assignments, as computed
-      by evaluate()
+      The nodes' assignments, as computed by the last call to
+      evaluate(). The weighted sum of an input neuron is its input
+      value.
     */
-    const Map<Index, double> &getIndexToWeightedSumAssignment();
-    const Map<Index, double> &getIndexToActivationResultAssignment();
+    double getWeightedSumAssignment( unsigned layer, unsigned neuron ) const;
+    double getActivationResultAssignment( unsigned layer, unsigned neuron ) const;
 
     /*
       Interface methods for performing operations on the network.
     */
     void evaluate( double *input, double *output );
 
+    /*
+      Evaluate the network on a batch of inputs, given as a row-major
+      (batchSize x input layer size) matrix. The outputs are written
+      as a row-major (batchSize x output layer size) matrix. If
+      provided, weightedSums and activationResults receive the values
+      of all neurons as row-major (batchSize x getNumberOfNeurons())
+      matrices, with the neurons ordered by layer and then by index.
+      Unlike evaluate(), this does not change the stored assignment.
+    */
+    void evaluateBatch( const double *inputs, unsigned batchSize, double *outputs,
+                        double *weightedSums = NULL, double *activationResults = NULL );
+
+    unsigned getNumberOfNeurons() const;
+
+    /*
+      Find, for each of the given number of variables, where its value
+      appears in the matrices produced by evaluateBatch(): index i <
+      getNumberOfNeurons() refers to neuron i's activation result, and
+      getNumberOfNeurons() + i to its weighted sum. The i'th input and
+      output variables are matched to the i'th neurons of the first
+      and last layers. Returns false if some variable is not
+      represented in the network.
+    */
+    bool mapVariablesToNeuronValues( unsigned numberOfVariables,
+                                     const Vector<unsigned> &inputVariables,
+                                     const Vector<unsigned> &outputVariables,
+                                     Vector<unsigned> &variableToValue ) const;
+
     /*
       Duplicate the reasoner
     */
@@ -109,30 +159,75 @@ public:
                                 const Map<unsigned, unsigned> &mergedVariables );
 
 private:
+    /*
+      An incoming weight of a neuron in a sparsely connected layer
+    */
+    struct SparseWeight
+    {
+        SparseWeight( unsigned source, double weight )
+            : _source( source )
+            , _weight( weight )
+        {
+        }
+
+        unsigned _source;
+        double _weight;
+    };
+
+    /*
+      Marks a neuron that has no corresponding variable
+    */
+    static const unsigned NO_VARIABLE;
+
     unsigned _numberOfLayers;
-    Map<unsigned, unsigned> _layerSizes;
-    Map<Index, ActivationFunction> _neuronToActivationFunction;
-    double **_weights;
-    Map<Index, double> _bias;
+    Vector<unsigned> _layerSizes;
+
+    /*
+      The flat index of the first neuron of every layer, and the total
+      number of neurons
+    */
+    Vector<unsigned> _layerOffsets;
+    unsigned _numberOfNeurons;
+
+    /*
+      The weights, per source layer. Dense matrices are stored row by
+      row, i.e. all weights leaving a source neuron are consecutive.
+      For sparse layers, the incoming weights are stored per (flat)
+      target neuron.
+    */
+    Vector<WeightStorage> _weightStorage;
+    Vector<double *> _denseWeights;
+    Vector<Vector<SparseWeight>> _incomingWeights;
+
+    /*
+      Per-neuron data, indexed by the flat neuron index
+    */
+    Vector<double> _bias;
+    Vector<ActivationFunction> _activationFunction;
+    Vector<unsigned> _weightedSumVariable;
+    Vector<unsigned> _activationResultVariable;
+    Vector<double> _weightedSumAssignment;
+    Vector<double> _activationResultAssignment;
 
     unsigned _maxLayerSize;
 
+    /*
+      Work memory for a block of batch rows, each of size
+      _maxLayerSize
+    */
     double *_work1;
     double *_work2;
 
     void freeMemoryIfNeeded();
 
     /*
-      Mappings of indices to weighted sum and activation result variables
+      Compute the weighted sums of a target layer for a block of
+      batch rows, from the activation results of the previous layer.
     */
-    Map<Index, unsigned> _indexToWeightedSumVariable;
-    Map<Index, unsigned> _indexToActivationResultVariable;
+    void computeWeightedSums( unsigned targetLayer, unsigned numRows,
+                              const double *sources, double *targets ) const;
 
-    /*
-      Store the assignment to all variables when evaluate() is called
-    */
-    Map<Index, double> _indexToWeightedSumAssignment;
-    Map<Index, double> _indexToActivationResultAssignment;
+    unsigned flatIndex( unsigned layer, unsigned neuron ) const;
 };
 
 #endif // __NetworkLevelReasoner_h__
@@ -22,7 +22,7 @@ void PiecewiseLinearCaseSplit::storeBoundTightening( const Tightening &tightenin
     _bounds.append( tightening );
 }
 
-List<Tightening> PiecewiseLinearCaseSplit::getBoundTightenings() const
+const Vector<Tightening> &PiecewiseLinearCaseSplit::getBoundTightenings() const
 {
     return _bounds;
 }
@@ -32,11 +32,17 @@ void PiecewiseLinearCaseSplit::addEquation( const Equation &equation )
 	_equations.append( equation );
 }
 
-List<Equation> PiecewiseLinearCaseSplit::getEquations() const
+const List<Equation> &PiecewiseLinearCaseSplit::getEquations() const
 {
 	return _equations;
 }
 
+void PiecewiseLinearCaseSplit::addSplit( const PiecewiseLinearCaseSplit &other )
+{
+    _bounds += other._bounds;
+    _equations.append( other._equations );
+}
+
 void PiecewiseLinearCaseSplit::dump( String &output ) const
 {
     output = String( "\nDumping piecewise linear case split\n" );
@@ -64,7 +70,18 @@ void PiecewiseLinearCaseSplit::dump() const
 
 bool PiecewiseLinearCaseSplit::operator==( const PiecewiseLinearCaseSplit &other ) const
 {
-    return ( _bounds == other._bounds ) && ( _equations == other._equations );
+    // Vector's equality ignores the order of the elements, so the
+    // bounds are compared in order here
+    if ( _bounds.size() != other._bounds.size() )
+        return false;
+
+    for ( unsigned i = 0; i < _bounds.size(); ++i )
+    {
+        if ( !( _bounds[i] == other._bounds[i] ) )
+            return false;
+    }
+
+    return _equations == other._equations;
 }
 
 void PiecewiseLinearCaseSplit::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
@@ -21,21 +21,30 @@
 #include "MString.h"
 #include "Pair.h"
 #include "Tightening.h"
+#include "Vector.h"
 
 class PiecewiseLinearCaseSplit
 {
 public:
     /*
-      Store information regarding a bound tightening.
+      Store information regarding a bound tightening. The stored
+      tightenings are kept contiguously, and are returned by reference
+      to avoid copying them whenever the split is inspected or applied.
     */
     void storeBoundTightening( const Tightening &tightening );
-    List<Tightening> getBoundTightenings() const;
+    const Vector<Tightening> &getBoundTightenings() const;
 
     /*
       Store information regarding a new equation to be added.
     */
     void addEquation( const Equation &equation );
-  	List<Equation> getEquations() const;
+    const List<Equation> &getEquations() const;
+
+    /*
+      Store all the bound tightenings and equations of another split,
+      so that this split represents the conjunction of both.
+    */
+    void addSplit( const PiecewiseLinearCaseSplit &other );
 
     /*
       Dump the case split - for debugging purposes.
@@ -57,7 +66,7 @@ private:
     /*
       Bound tightening information.
     */
-    List<Tightening> _bounds;
+    Vector<Tightening> _bounds;
 
     /*
       The equation that needs to be added.
@@ -14,12 +14,15 @@
 **/
 
 #include "PiecewiseLinearConstraint.h"
+#include "PlConstraintTracker.h"
 #include "Statistics.h"
 
 PiecewiseLinearConstraint::PiecewiseLinearConstraint()
     : _constraintActive( true )
     , _score( -1 )
     , _constraintBoundTightener( NULL )
+    , _tracker( NULL )
+    , _trackerIndex( 0 )
     , _statistics( NULL )
 {
 }
@@ -34,6 +37,18 @@ void PiecewiseLinearConstraint::registerConstraintBoundTightener( IConstraintBou
     _constraintBoundTightener = tightener;
 }
 
+void PiecewiseLinearConstraint::registerTracker( PlConstraintTracker *tracker, unsigned index )
+{
+    _tracker = tracker;
+    _trackerIndex = index;
+}
+
+void PiecewiseLinearConstraint::reportStateChange()
+{
+    if ( _tracker )
+        _tracker->notifyConstraintChanged( _trackerIndex );
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
@@ -28,6 +28,7 @@ class Equation;
 class IConstraintBoundTightener;
 class ITableau;
 class InputQuery;
+class PlConstraintTracker;
 class String;
 
 class PiecewiseLinearConstraint : public ITableau::VariableWatcher
@@ -96,6 +97,7 @@ public:
     virtual void setActiveConstraint( bool active )
     {
         _constraintActive = active;
+        reportStateChange();
     }
 
     virtual bool isActive() const
@@ -199,6 +201,13 @@ public:
     */
     void registerConstraintBoundTightener( IConstraintBoundTightener *tightener );
 
+    /*
+      Register a constraint tracker. If a tracker is registered, this
+      piecewise linear constraint will inform the tracker (using the
+      given index) whenever its assignment, bounds or activity change.
+    */
+    void registerTracker( PlConstraintTracker *tracker, unsigned index );
+
     /*
       Return true if and only if this piecewise linear constraint supports
       symbolic bound tightening.
@@ -236,6 +245,11 @@ public:
         _score = score;
     }
 
+    double getScore() const
+    {
+        return _score;
+    }
+
 protected:
     bool _constraintActive;
 	Map<unsigned, double> _assignment;
@@ -251,6 +265,19 @@ protected:
 
     IConstraintBoundTightener *_constraintBoundTightener;
 
+    /*
+      The tracker of violated constraints and split candidates, and
+      the index of this constraint within it.
+    */
+    PlConstraintTracker *_tracker;
+    unsigned _trackerIndex;
+
+    /*
+      Inform the tracker, if one is registered, that the state of
+      this constraint has changed.
+    */
+    void reportStateChange();
+
     /*
       Statistics collection
     */
@@ -0,0 +1,237 @@
+/*********************                                                        */
+/*! \file PlConstraintTracker.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "MarabouError.h"
+#include "PiecewiseLinearConstraint.h"
+#include "PlConstraintTracker.h"
+
+PlConstraintTracker::PlConstraintTracker()
+    : _numConstraints( 0 )
+    , _pendingViolationCheck( NULL )
+    , _pendingCandidateUpdate( NULL )
+    , _isViolated( NULL )
+    , _isCandidate( NULL )
+    , _candidateScore( NULL )
+{
+}
+
+PlConstraintTracker::~PlConstraintTracker()
+{
+    freeMemoryIfNeeded();
+}
+
+void PlConstraintTracker::initialize( const List<PiecewiseLinearConstraint *> &constraints )
+{
+    clear();
+
+    _numConstraints = constraints.size();
+    if ( _numConstraints == 0 )
+        return;
+
+    _pendingViolationCheck = new bool[_numConstraints];
+    if ( !_pendingViolationCheck )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "PlConstraintTracker::pendingViolationCheck" );
+
+    _pendingCandidateUpdate = new bool[_numConstraints];
+    if ( !_pendingCandidateUpdate )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "PlConstraintTracker::pendingCandidateUpdate" );
+
+    _isViolated = new bool[_numConstraints];
+    if ( !_isViolated )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "PlConstraintTracker::isViolated" );
+
+    _isCandidate = new bool[_numConstraints];
+    if ( !_isCandidate )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "PlConstraintTracker::isCandidate" );
+
+    _candidateScore = new double[_numConstraints];
+    if ( !_candidateScore )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "PlConstraintTracker::candidateScore" );
+
+    std::fill_n( _pendingViolationCheck, _numConstraints, false );
+    std::fill_n( _pendingCandidateUpdate, _numConstraints, false );
+    std::fill_n( _isViolated, _numConstraints, false );
+    std::fill_n( _isCandidate, _numConstraints, false );
+    std::fill_n( _candidateScore, _numConstraints, 0.0 );
+
+    unsigned index = 0;
+    for ( const auto &constraint : constraints )
+    {
+        _constraints.append( constraint );
+        constraint->registerTracker( this, index );
+        ++index;
+    }
+
+    markAllChanged();
+}
+
+void PlConstraintTracker::clear()
+{
+    _constraints.clear();
+    _changedSinceViolationCheck.clear();
+    _changedSinceCandidateUpdate.clear();
+    _violated.clear();
+    _candidates.clear();
+    _numConstraints = 0;
+
+    freeMemoryIfNeeded();
+}
+
+void PlConstraintTracker::notifyConstraintChanged( unsigned index )
+{
+    ASSERT( index < _numConstraints );
+
+    if ( !_pendingViolationCheck[index] )
+    {
+        _pendingViolationCheck[index] = true;
+        _changedSinceViolationCheck.append( index );
+    }
+
+    if ( !_pendingCandidateUpdate[index] )
+    {
+        _pendingCandidateUpdate[index] = true;
+        _changedSinceCandidateUpdate.append( index );
+    }
+}
+
+void PlConstraintTracker::markAllChanged()
+{
+    for ( unsigned i = 0; i < _numConstraints; ++i )
+        notifyConstraintChanged( i );
+}
+
+void PlConstraintTracker::updateViolatedConstraints()
+{
+    for ( unsigned i = 0; i < _changedSinceViolationCheck.size(); ++i )
+    {
+        unsigned index = _changedSinceViolationCheck[i];
+        _pendingViolationCheck[index] = false;
+
+        PiecewiseLinearConstraint *constraint = _constraints[index];
+        if ( constraint->isActive() && !constraint->satisfied() )
+            notifyViolated( index );
+        else
+            notifySatisfied( index );
+    }
+
+    _changedSinceViolationCheck.clear();
+}
+
+const Map<unsigned, PiecewiseLinearConstraint *> &PlConstraintTracker::getViolatedConstraints() const
+{
+    return _violated;
+}
+
+void PlConstraintTracker::notifyViolated( unsigned index )
+{
+    if ( _isViolated[index] )
+        return;
+
+    _violated.insert( index, _constraints[index] );
+    _isViolated[index] = true;
+}
+
+void PlConstraintTracker::notifySatisfied( unsigned index )
+{
+    if ( !_isViolated[index] )
+        return;
+
+    _violated.erase( index );
+    _isViolated[index] = false;
+}
+
+void PlConstraintTracker::updateSplitCandidates()
+{
+    for ( unsigned i = 0; i < _changedSinceCandidateUpdate.size(); ++i )
+    {
+        unsigned index = _changedSinceCandidateUpdate[i];
+        _pendingCandidateUpdate[index] = false;
+
+        if ( _isCandidate[index] )
+        {
+            _candidates.erase( CandidateEntry( _candidateScore[index], index ) );
+            _isCandidate[index] = false;
+        }
+
+        PiecewiseLinearConstraint *constraint = _constraints[index];
+        if ( constraint->isActive() && !constraint->phaseFixed() )
+        {
+            constraint->updateScore();
+            _candidateScore[index] = constraint->getScore();
+            _candidates.insert( CandidateEntry( _candidateScore[index], index ) );
+            _isCandidate[index] = true;
+        }
+    }
+
+    _changedSinceCandidateUpdate.clear();
+}
+
+PiecewiseLinearConstraint *PlConstraintTracker::topSplitCandidate()
+{
+    updateSplitCandidates();
+
+    if ( _candidates.empty() )
+        return NULL;
+
+    return _constraints[_candidates.begin()->_index];
+}
+
+unsigned PlConstraintTracker::getNumSplitCandidates()
+{
+    updateSplitCandidates();
+    return _candidates.size();
+}
+
+void PlConstraintTracker::freeMemoryIfNeeded()
+{
+    if ( _pendingViolationCheck )
+    {
+        delete[] _pendingViolationCheck;
+        _pendingViolationCheck = NULL;
+    }
+
+    if ( _pendingCandidateUpdate )
+    {
+        delete[] _pendingCandidateUpdate;
+        _pendingCandidateUpdate = NULL;
+    }
+
+    if ( _isViolated )
+    {
+        delete[] _isViolated;
+        _isViolated = NULL;
+    }
+
+    if ( _isCandidate )
+    {
+        delete[] _isCandidate;
+        _isCandidate = NULL;
+    }
+
+    if ( _candidateScore )
+    {
+        delete[] _candidateScore;
+        _candidateScore = NULL;
+    }
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
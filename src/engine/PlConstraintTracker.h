@@ -0,0 +1,155 @@
+/*********************                                                        */
+/*! \file PlConstraintTracker.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The tracker maintains, incrementally, the set of violated piecewise
+ ** linear constraints and a priority queue of candidates for splitting.
+ ** Constraints report any change in their state (assignment, bounds or
+ ** activity) to the tracker, and only the constraints that changed since
+ ** the previous query are re-examined.
+
+**/
+
+#ifndef __PlConstraintTracker_h__
+#define __PlConstraintTracker_h__
+
+#include "List.h"
+#include "Map.h"
+#include "Set.h"
+#include "Vector.h"
+
+class PiecewiseLinearConstraint;
+
+class PlConstraintTracker
+{
+public:
+    PlConstraintTracker();
+    ~PlConstraintTracker();
+
+    /*
+      Start tracking the given constraints. Each constraint is
+      assigned an index according to its position in the list. All
+      constraints are initially considered changed.
+    */
+    void initialize( const List<PiecewiseLinearConstraint *> &constraints );
+
+    /*
+      Stop tracking all constraints.
+    */
+    void clear();
+
+    /*
+      Callback from the constraints: the state of the constraint with
+      the given index has changed.
+    */
+    void notifyConstraintChanged( unsigned index );
+
+    /*
+      Mark all constraints as changed, e.g. when the engine's state is
+      restored wholesale.
+    */
+    void markAllChanged();
+
+    /*
+      Re-examine the constraints that changed since the previous
+      call, and update the violated constraints accordingly.
+    */
+    void updateViolatedConstraints();
+
+    /*
+      The violated constraints as of the last update, keyed by their
+      indices, i.e. in the order in which they were originally given.
+    */
+    const Map<unsigned, PiecewiseLinearConstraint *> &getViolatedConstraints() const;
+
+    /*
+      Re-score the constraints that changed since the previous call,
+      and update the split candidates accordingly. A candidate is an
+      active constraint whose phase has not been fixed.
+    */
+    void updateSplitCandidates();
+
+    /*
+      Return the split candidate with the highest score (ties are
+      broken by index), or NULL if there are no candidates.
+    */
+    PiecewiseLinearConstraint *topSplitCandidate();
+
+    unsigned getNumSplitCandidates();
+
+private:
+    /*
+      An entry in the split candidate queue. Entries with a higher
+      score come first.
+    */
+    struct CandidateEntry
+    {
+    public:
+        CandidateEntry( double score, unsigned index )
+            : _score( score )
+            , _index( index )
+        {
+        }
+
+        bool operator<( const CandidateEntry &other ) const
+        {
+            if ( _score != other._score )
+                return _score > other._score;
+
+            return _index < other._index;
+        }
+
+        double _score;
+        unsigned _index;
+    };
+
+    Vector<PiecewiseLinearConstraint *> _constraints;
+    unsigned _numConstraints;
+
+    /*
+      Constraints that changed since the violated set/the candidate
+      queue were last updated. The flags prevent duplicates in the
+      lists.
+    */
+    Vector<unsigned> _changedSinceViolationCheck;
+    Vector<unsigned> _changedSinceCandidateUpdate;
+    bool *_pendingViolationCheck;
+    bool *_pendingCandidateUpdate;
+
+    /*
+      The currently violated constraints, and for every constraint
+      whether it is among them.
+    */
+    Map<unsigned, PiecewiseLinearConstraint *> _violated;
+    bool *_isViolated;
+
+    /*
+      The split candidate queue. For every constraint, we remember
+      whether it is in the queue and under which score.
+    */
+    Set<CandidateEntry> _candidates;
+    bool *_isCandidate;
+    double *_candidateScore;
+
+    void notifyViolated( unsigned index );
+    void notifySatisfied( unsigned index );
+
+    void freeMemoryIfNeeded();
+};
+
+#endif // __PlConstraintTracker_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
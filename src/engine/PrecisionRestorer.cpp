@@ -114,8 +114,7 @@ void PrecisionRestorer::restorePrecision( IEngine &engine,
         }
 
         // Restore constraint status
-        for ( const auto &pair : targetEngineState._plConstraintToState )
-            pair.first->setActiveConstraint( pair.second->isActive() );
+        engine.restorePlConstraintActivity( targetEngineState );
 
         engine.setNumPlConstraintsDisabledByValidSplits
             ( targetEngineState._numPlConstraintsDisabledByValidSplits );
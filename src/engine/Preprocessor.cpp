@@ -632,10 +632,7 @@ void Preprocessor::eliminateVariables()
                 if ( !(*constraint)->supportsSymbolicBoundTightening() )
                     throw MarabouError( MarabouError::SYMBOLIC_BOUND_TIGHTENER_UNSUPPORTED_CONSTRAINT_TYPE );
 
-                ReluConstraint *relu = (ReluConstraint *)(*constraint);
-                unsigned b = relu->getB();
-                SymbolicBoundTightener::NodeIndex nodeIndex = _preprocessed._sbt->nodeIndexFromB( b );
-                _preprocessed._sbt->setEliminatedRelu( nodeIndex._layer, nodeIndex._neuron, relu->getPhaseStatus() );
+                _preprocessed._sbt->setEliminatedConstraint( *constraint );
             }
 
             if ( _statistics )
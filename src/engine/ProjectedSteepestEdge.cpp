@@ -28,6 +28,10 @@ ProjectedSteepestEdgeRule::ProjectedSteepestEdgeRule()
     , _work1( NULL )
     , _work2( NULL )
     , _AColumn( NULL )
+    , _m( 0 )
+    , _n( 0 )
+    , _mCapacity( 0 )
+    , _nCapacity( 0 )
     , _iterationsUntilReset( GlobalConfiguration::PSE_ITERATIONS_BEFORE_RESET )
     , _errorInGamma( 0.0 )
 {
@@ -67,26 +71,38 @@ void ProjectedSteepestEdgeRule::freeIfNeeded()
 
 void ProjectedSteepestEdgeRule::initialize( const ITableau &tableau )
 {
-    freeIfNeeded();
+    unsigned n = tableau.getN();
+    unsigned m = tableau.getM();
+
+    // Reuse the existing memory, if it is large enough
+    bool reallocate = !_referenceSpace || ( n > _nCapacity ) || ( m > _mCapacity ) || ( n - m != _n - _m );
 
-    _n = tableau.getN();
-    _m = tableau.getM();
+    _n = n;
+    _m = m;
 
-    _referenceSpace = new char[_n];
-    if ( !_referenceSpace )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::referenceSpace" );
+    if ( reallocate )
+    {
+        freeIfNeeded();
+
+        _nCapacity = std::max( _n, tableau.getNCapacity() );
+        _mCapacity = std::max( _m, tableau.getMCapacity() );
 
-    _gamma = new double[_n - _m];
-    if ( !_gamma )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::gamma" );
+        _referenceSpace = new char[_nCapacity];
+        if ( !_referenceSpace )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::referenceSpace" );
 
-    _work1 = new double[_m];
-    if ( !_work1 )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::work1" );
+        _gamma = new double[_n - _m];
+        if ( !_gamma )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::gamma" );
 
-    _work2 = new double[_m];
-    if ( !_work2 )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::work2" );
+        _work1 = new double[_mCapacity];
+        if ( !_work1 )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::work1" );
+
+        _work2 = new double[_mCapacity];
+        if ( !_work2 )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "ProjectedSteepestEdgeRule::work2" );
+    }
 
     resetReferenceSpace( tableau );
 }
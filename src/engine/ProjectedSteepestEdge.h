@@ -82,6 +82,14 @@ private:
     unsigned _m;
     unsigned _n;
 
+    /*
+      The dimensions for which memory is allocated. These follow the
+      tableau's capacity, so that memory is not reallocated every time
+      a row is added to the tableau.
+    */
+    unsigned _mCapacity;
+    unsigned _nCapacity;
+
     /*
       Remaining iterations before resetting the reference space.
     */
@@ -112,7 +112,10 @@ void ReluConstraint::notifyVariableValue( unsigned variable, double value )
     if ( FloatUtils::isZero( value, GlobalConfiguration::RELU_CONSTRAINT_COMPARISON_TOLERANCE ) )
         value = 0.0;
 
-    _assignment[variable] = value;
+    VariableState &state = getVariableState( variable );
+    state._value = value;
+    state._hasValue = true;
+    reportStateChange();
 }
 
 void ReluConstraint::notifyLowerBound( unsigned variable, double bound )
@@ -120,10 +123,13 @@ void ReluConstraint::notifyLowerBound( unsigned variable, double bound )
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+    VariableState &state = getVariableState( variable );
+    if ( state._hasLowerBound && !FloatUtils::gt( bound, state._lowerBound ) )
         return;
 
-    _lowerBounds[variable] = bound;
+    state._lowerBound = bound;
+    state._hasLowerBound = true;
+    reportStateChange();
 
     if ( variable == _f && FloatUtils::isPositive( bound ) )
         setPhaseStatus( PhaseStatus::PHASE_ACTIVE );
@@ -179,10 +185,13 @@ void ReluConstraint::notifyUpperBound( unsigned variable, double bound )
     if ( _statistics )
         _statistics->incNumBoundNotificationsPlConstraints();
 
-    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+    VariableState &state = getVariableState( variable );
+    if ( state._hasUpperBound && !FloatUtils::lt( bound, state._upperBound ) )
         return;
 
-    _upperBounds[variable] = bound;
+    state._upperBound = bound;
+    state._hasUpperBound = true;
+    reportStateChange();
 
     if ( ( variable == _f || variable == _b ) && !FloatUtils::isPositive( bound ) )
         setPhaseStatus( PhaseStatus::PHASE_INACTIVE );
@@ -237,11 +246,11 @@ List<unsigned> ReluConstraint::getParticipatingVariables() const
 
 bool ReluConstraint::satisfied() const
 {
-    if ( !( _assignment.exists( _b ) && _assignment.exists( _f ) ) )
+    if ( !( _bState._hasValue && _fState._hasValue ) )
         throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
 
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = _bState._value;
+    double fValue = _fState._value;
 
     if ( FloatUtils::isNegative( fValue ) )
         return false;
@@ -255,11 +264,11 @@ bool ReluConstraint::satisfied() const
 List<PiecewiseLinearConstraint::Fix> ReluConstraint::getPossibleFixes() const
 {
     ASSERT( !satisfied() );
-    ASSERT( _assignment.exists( _b ) );
-    ASSERT( _assignment.exists( _f ) );
+    ASSERT( _bState._hasValue );
+    ASSERT( _fState._hasValue );
 
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = _bState._value;
+    double fValue = _fState._value;
 
     ASSERT( !FloatUtils::isNegative( fValue ) );
 
@@ -310,7 +319,7 @@ List<PiecewiseLinearConstraint::Fix> ReluConstraint::getPossibleFixes() const
 List<PiecewiseLinearConstraint::Fix> ReluConstraint::getSmartFixes( ITableau *tableau ) const
 {
     ASSERT( !satisfied() );
-    ASSERT( _assignment.exists( _f ) && _assignment.size() > 1 );
+    ASSERT( _bState._hasValue && _fState._hasValue );
 
     double bDeltaToFDelta;
     double fDeltaToBDelta;
@@ -364,8 +373,8 @@ List<PiecewiseLinearConstraint::Fix> ReluConstraint::getSmartFixes( ITableau *ta
       by 4, repairing the violation. Of course, there may be multiple options for repair.
     */
 
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = _bState._value;
+    double fValue = _fState._value;
 
     /*
       Repair option number 1: the active fix. We want to set f = b > 0.
@@ -449,9 +458,9 @@ List<PiecewiseLinearCaseSplit> ReluConstraint::getCaseSplits() const
 
     // If we have existing knowledge about the assignment, use it to
     // influence the order of splits
-    if ( _assignment.exists( _f ) )
+    if ( _fState._hasValue )
     {
-        if ( FloatUtils::isPositive( _assignment[_f] ) )
+        if ( FloatUtils::isPositive( _fState._value ) )
         {
             splits.append( getActiveSplit() );
             splits.append( getInactiveSplit() );
@@ -519,48 +528,28 @@ void ReluConstraint::dump( String &output ) const
                       );
 
     output += Stringf( "b in [%s, %s], ",
-                       _lowerBounds.exists( _b ) ? Stringf( "%lf", _lowerBounds[_b] ).ascii() : "-inf",
-                       _upperBounds.exists( _b ) ? Stringf( "%lf", _upperBounds[_b] ).ascii() : "inf" );
+                       _bState._hasLowerBound ? Stringf( "%lf", _bState._lowerBound ).ascii() : "-inf",
+                       _bState._hasUpperBound ? Stringf( "%lf", _bState._upperBound ).ascii() : "inf" );
 
     output += Stringf( "f in [%s, %s]",
-                       _lowerBounds.exists( _f ) ? Stringf( "%lf", _lowerBounds[_f] ).ascii() : "-inf",
-                       _upperBounds.exists( _f ) ? Stringf( "%lf", _upperBounds[_f] ).ascii() : "inf" );
+                       _fState._hasLowerBound ? Stringf( "%lf", _fState._lowerBound ).ascii() : "-inf",
+                       _fState._hasUpperBound ? Stringf( "%lf", _fState._upperBound ).ascii() : "inf" );
 
     if ( _auxVarInUse )
     {
         output += Stringf( ". Aux var: %u. Range: [%s, %s]\n",
                            _aux,
-                           _lowerBounds.exists( _aux ) ? Stringf( "%lf", _lowerBounds[_aux] ).ascii() : "-inf",
-                           _upperBounds.exists( _aux ) ? Stringf( "%lf", _upperBounds[_aux] ).ascii() : "inf" );
+                           _auxState._hasLowerBound ? Stringf( "%lf", _auxState._lowerBound ).ascii() : "-inf",
+                           _auxState._hasUpperBound ? Stringf( "%lf", _auxState._upperBound ).ascii() : "inf" );
     }
 }
 
 void ReluConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
 {
 	ASSERT( oldIndex == _b || oldIndex == _f || ( _auxVarInUse && oldIndex == _aux ) );
-    ASSERT( !_assignment.exists( newIndex ) &&
-            !_lowerBounds.exists( newIndex ) &&
-            !_upperBounds.exists( newIndex ) &&
-            newIndex != _b && newIndex != _f && ( !_auxVarInUse || newIndex != _aux ) );
-
-    if ( _assignment.exists( oldIndex ) )
-    {
-        _assignment[newIndex] = _assignment.get( oldIndex );
-        _assignment.erase( oldIndex );
-    }
-
-    if ( _lowerBounds.exists( oldIndex ) )
-    {
-        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
-        _lowerBounds.erase( oldIndex );
-    }
-
-    if ( _upperBounds.exists( oldIndex ) )
-    {
-        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
-        _upperBounds.erase( oldIndex );
-    }
+    ASSERT( newIndex != _b && newIndex != _f && ( !_auxVarInUse || newIndex != _aux ) );
 
+    // The variable states are kept per role, so only the index changes
     if ( oldIndex == _b )
         _b = newIndex;
     else if ( oldIndex == _f )
@@ -612,24 +601,24 @@ bool ReluConstraint::constraintObsolete() const
 
 void ReluConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
 {
-    ASSERT( _lowerBounds.exists( _b ) && _lowerBounds.exists( _f ) &&
-            _upperBounds.exists( _b ) && _upperBounds.exists( _f ) );
+    ASSERT( _bState._hasLowerBound && _fState._hasLowerBound &&
+            _bState._hasUpperBound && _fState._hasUpperBound );
 
-    ASSERT( !_auxVarInUse || ( _lowerBounds.exists( _aux ) && _upperBounds.exists( _aux ) ) );
+    ASSERT( !_auxVarInUse || ( _auxState._hasLowerBound && _auxState._hasUpperBound ) );
 
-    double bLowerBound = _lowerBounds[_b];
-    double fLowerBound = _lowerBounds[_f];
+    double bLowerBound = _bState._lowerBound;
+    double fLowerBound = _fState._lowerBound;
 
-    double bUpperBound = _upperBounds[_b];
-    double fUpperBound = _upperBounds[_f];
+    double bUpperBound = _bState._upperBound;
+    double fUpperBound = _fState._upperBound;
 
     double auxLowerBound = 0;
     double auxUpperBound = 0;
 
     if ( _auxVarInUse )
     {
-        auxLowerBound = _lowerBounds[_aux];
-        auxUpperBound = _upperBounds[_aux];
+        auxLowerBound = _auxState._lowerBound;
+        auxUpperBound = _auxState._upperBound;
     }
 
     // Determine if we are in the active phase, inactive phase or unknown phase
@@ -754,13 +743,13 @@ void ReluConstraint::addAuxiliaryEquations( InputQuery &inputQuery )
     inputQuery.addEquation( equation );
 
     // Adjust the bounds for the new variable
-    ASSERT( _lowerBounds.exists( _b ) );
+    ASSERT( _bState._hasLowerBound );
     inputQuery.setLowerBound( _aux, 0 );
 
     // Generally, aux.ub = -b.lb. However, if b.lb is positive (active
     // phase), then aux.ub needs to be 0
     double auxUpperBound =
-        _lowerBounds[_b] > 0 ? 0 : -_lowerBounds[_b];
+        _bState._lowerBound > 0 ? 0 : -_bState._lowerBound;
     inputQuery.setUpperBound( _aux, auxUpperBound );
 
     // We now care about the auxiliary variable, as well
@@ -779,8 +768,8 @@ void ReluConstraint::getCostFunctionComponent( Map<unsigned, double> &cost ) con
 
     // Both variables are within bounds and the constraint is not
     // satisfied or fixed.
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = _bState._value;
+    double fValue = _fState._value;
 
     if ( !cost.exists( _f ) )
         cost[_f] = 0;
@@ -815,13 +804,13 @@ void ReluConstraint::getCostFunctionComponent( Map<unsigned, double> &cost ) con
 
 bool ReluConstraint::haveOutOfBoundVariables() const
 {
-    double bValue = _assignment.get( _b );
-    double fValue = _assignment.get( _f );
+    double bValue = _bState._value;
+    double fValue = _fState._value;
 
-    if ( FloatUtils::gt( _lowerBounds[_b], bValue ) || FloatUtils::lt( _upperBounds[_b], bValue ) )
+    if ( FloatUtils::gt( _bState._lowerBound, bValue ) || FloatUtils::lt( _bState._upperBound, bValue ) )
         return true;
 
-    if ( FloatUtils::gt( _lowerBounds[_f], fValue ) || FloatUtils::lt( _upperBounds[_f], fValue ) )
+    if ( FloatUtils::gt( _fState._lowerBound, fValue ) || FloatUtils::lt( _fState._upperBound, fValue ) )
         return true;
 
     return false;
@@ -868,8 +857,8 @@ unsigned ReluConstraint::getAux() const
 
 double ReluConstraint::computePolarity() const
 {
-    double currentLb = _lowerBounds[_b];
-    double currentUb = _upperBounds[_b];
+    double currentLb = _bState._lowerBound;
+    double currentUb = _bState._upperBound;
     if ( currentLb >= 0 ) return 1;
     if ( currentUb <= 0 ) return -1;
     double width = currentUb - currentLb;
@@ -887,6 +876,32 @@ ReluConstraint::PhaseStatus ReluConstraint::getDirection() const
     return _direction;
 }
 
+ReluConstraint::VariableState &ReluConstraint::getVariableState( unsigned variable )
+{
+    if ( variable == _b )
+        return _bState;
+    if ( variable == _f )
+        return _fState;
+    if ( _auxVarInUse && variable == _aux )
+        return _auxState;
+
+    throw MarabouError( MarabouError::VARIABLE_INDEX_OUT_OF_RANGE,
+                        Stringf( "Variable = %u (ReluConstraint::getVariableState)", variable ).ascii() );
+}
+
+const ReluConstraint::VariableState &ReluConstraint::getVariableState( unsigned variable ) const
+{
+    if ( variable == _b )
+        return _bState;
+    if ( variable == _f )
+        return _fState;
+    if ( _auxVarInUse && variable == _aux )
+        return _auxState;
+
+    throw MarabouError( MarabouError::VARIABLE_INDEX_OUT_OF_RANGE,
+                        Stringf( "Variable = %u (ReluConstraint::getVariableState)", variable ).ascii() );
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
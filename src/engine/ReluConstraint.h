@@ -19,6 +19,8 @@
 #include "Map.h"
 #include "PiecewiseLinearConstraint.h"
 
+class ReluConstraintStore;
+
 class ReluConstraint : public PiecewiseLinearConstraint
 {
 public:
@@ -186,11 +188,55 @@ public:
     PhaseStatus getDirection() const;
 
 private:
+    /*
+      The batch store of ReLU states accesses the state of the
+      constraint directly.
+    */
+    friend class ReluConstraintStore;
+
+    /*
+      The assignment and bounds of one of the participating
+      variables. These are kept in plain fields, rather than in the
+      maps of the base class, so that the frequent bound and value
+      notifications do not require any map lookups.
+    */
+    struct VariableState
+    {
+    public:
+        VariableState()
+            : _value( 0 )
+            , _lowerBound( 0 )
+            , _upperBound( 0 )
+            , _hasValue( false )
+            , _hasLowerBound( false )
+            , _hasUpperBound( false )
+        {
+        }
+
+        double _value;
+        double _lowerBound;
+        double _upperBound;
+        bool _hasValue;
+        bool _hasLowerBound;
+        bool _hasUpperBound;
+    };
+
     unsigned _b, _f;
     PhaseStatus _phaseStatus;
     bool _auxVarInUse;
     unsigned _aux;
 
+    VariableState _bState;
+    VariableState _fState;
+    VariableState _auxState;
+
+    /*
+      Get the state of a participating variable. Throws if the
+      variable does not participate in the constraint.
+    */
+    VariableState &getVariableState( unsigned variable );
+    const VariableState &getVariableState( unsigned variable ) const;
+
     /*
       Denotes which case split to handle first.
       And which phase status to repair a relu into.
@@ -0,0 +1,147 @@
+/*********************                                                        */
+/*! \file ReluConstraintStore.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "MarabouError.h"
+#include "ReluConstraintStore.h"
+
+ReluConstraintStore::ReluConstraintStore()
+{
+}
+
+bool ReluConstraintStore::canStore( const List<PiecewiseLinearConstraint *> &constraints )
+{
+    for ( const auto &constraint : constraints )
+    {
+        if ( !dynamic_cast<ReluConstraint *>( constraint ) )
+            return false;
+    }
+
+    return true;
+}
+
+void ReluConstraintStore::initialize( const List<PiecewiseLinearConstraint *> &constraints )
+{
+    clear();
+
+    for ( const auto &constraint : constraints )
+    {
+        ReluConstraint *relu = dynamic_cast<ReluConstraint *>( constraint );
+        if ( !relu )
+            throw MarabouError( MarabouError::UNSUPPORTED_PIECEWISE_CONSTRAINT,
+                                "ReluConstraintStore can only hold ReLU constraints" );
+
+        _constraints.append( relu );
+        _b.append( relu->_b );
+        _f.append( relu->_f );
+    }
+}
+
+void ReluConstraintStore::clear()
+{
+    _constraints.clear();
+    _b.clear();
+    _f.clear();
+}
+
+unsigned ReluConstraintStore::size() const
+{
+    return _constraints.size();
+}
+
+bool ReluConstraintStore::empty() const
+{
+    return _constraints.empty();
+}
+
+void ReluConstraintStore::storeState( State &state ) const
+{
+    unsigned n = _constraints.size();
+
+    // A state that was stored before already has the right size
+    if ( state.size() != n )
+    {
+        state._phaseStatus = Vector<unsigned>( n );
+        state._direction = Vector<unsigned>( n );
+        state._active = Vector<unsigned>( n );
+        state._score = Vector<double>( n );
+        state._bState = Vector<ReluConstraint::VariableState>( n );
+        state._fState = Vector<ReluConstraint::VariableState>( n );
+        state._auxState = Vector<ReluConstraint::VariableState>( n );
+    }
+
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        const ReluConstraint *relu = _constraints[i];
+
+        state._phaseStatus[i] = relu->_phaseStatus;
+        state._direction[i] = relu->_direction;
+        state._active[i] = relu->_constraintActive;
+        state._score[i] = relu->_score;
+        state._bState[i] = relu->_bState;
+        state._fState[i] = relu->_fState;
+        state._auxState[i] = relu->_auxState;
+    }
+}
+
+void ReluConstraintStore::restoreState( const State &state )
+{
+    unsigned n = _constraints.size();
+    if ( state.size() != n )
+        throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
+
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        ReluConstraint *relu = _constraints[i];
+
+        relu->_phaseStatus = (ReluConstraint::PhaseStatus)state._phaseStatus[i];
+        relu->_direction = (ReluConstraint::PhaseStatus)state._direction[i];
+        relu->_constraintActive = state._active[i];
+        relu->_score = state._score[i];
+        relu->_bState = state._bState[i];
+        relu->_fState = state._fState[i];
+        relu->_auxState = state._auxState[i];
+    }
+}
+
+void ReluConstraintStore::restoreActivity( const State &state )
+{
+    unsigned n = _constraints.size();
+    if ( state.size() != n )
+        throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
+
+    for ( unsigned i = 0; i < n; ++i )
+        _constraints[i]->setActiveConstraint( state._active[i] );
+}
+
+unsigned ReluConstraintStore::countActive() const
+{
+    unsigned result = 0;
+    for ( unsigned i = 0; i < _constraints.size(); ++i )
+    {
+        if ( _constraints[i]->_constraintActive )
+            ++result;
+    }
+
+    return result;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file ReluConstraintStore.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The store keeps the ReLU constraints of a query in one contiguous
+ ** collection. It is used by the engine when all of its piecewise
+ ** linear constraints are ReLUs: saving and restoring the states of
+ ** the constraints is then done by copying plain arrays (one array
+ ** per field), instead of duplicating every constraint on the heap,
+ ** and whole-collection scans avoid virtual calls.
+
+**/
+
+#ifndef __ReluConstraintStore_h__
+#define __ReluConstraintStore_h__
+
+#include "List.h"
+#include "ReluConstraint.h"
+#include "Vector.h"
+
+class ReluConstraintStore
+{
+public:
+    /*
+      A snapshot of the states of all the ReLUs in a store.
+    */
+    struct State
+    {
+    public:
+        Vector<unsigned> _phaseStatus;
+        Vector<unsigned> _direction;
+        Vector<unsigned> _active;
+        Vector<double> _score;
+        Vector<ReluConstraint::VariableState> _bState;
+        Vector<ReluConstraint::VariableState> _fState;
+        Vector<ReluConstraint::VariableState> _auxState;
+
+        unsigned size() const
+        {
+            return _phaseStatus.size();
+        }
+
+        unsigned long long getStorageSize() const
+        {
+            return (unsigned long long)size() *
+                ( 3 * sizeof(unsigned) + sizeof(double) + 3 * sizeof(ReluConstraint::VariableState) );
+        }
+    };
+
+    ReluConstraintStore();
+
+    /*
+      Return true iff the given constraints can be placed in a store,
+      i.e. they are all ReLUs.
+    */
+    static bool canStore( const List<PiecewiseLinearConstraint *> &constraints );
+
+    /*
+      Start managing the given constraints, in the order they are
+      given. The store does not take ownership of the constraints.
+    */
+    void initialize( const List<PiecewiseLinearConstraint *> &constraints );
+    void clear();
+
+    unsigned size() const;
+    bool empty() const;
+
+    /*
+      Save/restore the states of all the constraints in the store.
+    */
+    void storeState( State &state ) const;
+    void restoreState( const State &state );
+
+    /*
+      Restore only the activity status of the constraints.
+    */
+    void restoreActivity( const State &state );
+
+    /*
+      Whole-collection queries.
+    */
+    unsigned countActive() const;
+
+    /*
+      Access to individual constraints.
+    */
+    inline ReluConstraint *getConstraint( unsigned index ) const
+    {
+        return _constraints[index];
+    }
+
+    inline unsigned getB( unsigned index ) const
+    {
+        return _b[index];
+    }
+
+    inline bool hasValidSplit( unsigned index ) const
+    {
+        const ReluConstraint *relu = _constraints[index];
+        return relu->_constraintActive &&
+            ( relu->_phaseStatus != ReluConstraint::PHASE_NOT_FIXED );
+    }
+
+private:
+    Vector<ReluConstraint *> _constraints;
+
+    /*
+      The indices of the participating variables. These do not change
+      once the search begins.
+    */
+    Vector<unsigned> _b;
+    Vector<unsigned> _f;
+};
+
+#endif // __ReluConstraintStore_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -22,6 +22,10 @@
 
 RowBoundTightener::RowBoundTightener( const ITableau &tableau )
     : _tableau( tableau )
+    , _n( 0 )
+    , _m( 0 )
+    , _nCapacity( 0 )
+    , _mCapacity( 0 )
     , _lowerBounds( NULL )
     , _upperBounds( NULL )
     , _tightenedLower( NULL )
@@ -37,49 +41,62 @@ RowBoundTightener::RowBoundTightener( const ITableau &tableau )
 
 void RowBoundTightener::setDimensions()
 {
-    freeMemoryIfNeeded();
+    unsigned n = _tableau.getN();
+    unsigned m = _tableau.getM();
 
-    _n = _tableau.getN();
-    _m = _tableau.getM();
+    // The existing work space can be reused if it is large enough, and
+    // if the rows are of the right length
+    bool reallocate = ( n > _nCapacity ) || ( m > _mCapacity ) || ( n - m != _n - _m );
 
-    _lowerBounds = new double[_n];
-    if ( !_lowerBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::lowerBounds" );
+    _n = n;
+    _m = m;
 
-    _upperBounds = new double[_n];
-    if ( !_upperBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::upperBounds" );
+    if ( reallocate )
+    {
+        freeMemoryIfNeeded();
 
-    _tightenedLower = new bool[_n];
-    if ( !_tightenedLower )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::tightenedLower" );
+        _nCapacity = std::max( _n, _tableau.getNCapacity() );
+        _mCapacity = std::max( _m, _tableau.getMCapacity() );
 
-    _tightenedUpper = new bool[_n];
-    if ( !_tightenedUpper )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::tightenedUpper" );
+        _lowerBounds = new double[_nCapacity];
+        if ( !_lowerBounds )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::lowerBounds" );
 
-    resetBounds();
+        _upperBounds = new double[_nCapacity];
+        if ( !_upperBounds )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::upperBounds" );
 
-    if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
-         GlobalConfiguration::COMPUTE_INVERTED_BASIS_MATRIX )
-    {
-        _rows = new TableauRow *[_m];
-        for ( unsigned i = 0; i < _m; ++i )
-            _rows[i] = new TableauRow( _n - _m );
-    }
-    else if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
-              GlobalConfiguration::USE_IMPLICIT_INVERTED_BASIS_MATRIX )
-    {
-        _rows = new TableauRow *[_m];
-        for ( unsigned i = 0; i < _m; ++i )
-            _rows[i] = new TableauRow( _n - _m );
+        _tightenedLower = new bool[_nCapacity];
+        if ( !_tightenedLower )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::tightenedLower" );
 
-        _z = new double[_m];
+        _tightenedUpper = new bool[_nCapacity];
+        if ( !_tightenedUpper )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "RowBoundTightener::tightenedUpper" );
+
+        if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
+             GlobalConfiguration::COMPUTE_INVERTED_BASIS_MATRIX )
+        {
+            _rows = new TableauRow *[_mCapacity];
+            for ( unsigned i = 0; i < _mCapacity; ++i )
+                _rows[i] = new TableauRow( _n - _m );
+        }
+        else if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
+                  GlobalConfiguration::USE_IMPLICIT_INVERTED_BASIS_MATRIX )
+        {
+            _rows = new TableauRow *[_mCapacity];
+            for ( unsigned i = 0; i < _mCapacity; ++i )
+                _rows[i] = new TableauRow( _n - _m );
+
+            _z = new double[_mCapacity];
+        }
+
+        _ciTimesLb = new double[_nCapacity];
+        _ciTimesUb = new double[_nCapacity];
+        _ciSign = new char[_nCapacity];
     }
 
-    _ciTimesLb = new double[_n];
-    _ciTimesUb = new double[_n];
-    _ciSign = new char[_n];
+    resetBounds();
 }
 
 void RowBoundTightener::resetBounds()
@@ -139,7 +156,7 @@ void RowBoundTightener::freeMemoryIfNeeded()
 
     if ( _rows )
     {
-        for ( unsigned i = 0; i < _m; ++i )
+        for ( unsigned i = 0; i < _mCapacity; ++i )
             delete _rows[i];
         delete[] _rows;
         _rows = NULL;
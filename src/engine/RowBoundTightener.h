@@ -103,6 +103,14 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The dimensions for which the work space is allocated. These
+      follow the tableau's capacity, so that the work space is not
+      reallocated every time a row is added to the tableau.
+    */
+    unsigned _nCapacity;
+    unsigned _mCapacity;
+
     /*
       Work space for the tightener to derive tighter bounds. These
       represent the tightest bounds currently known, either taken
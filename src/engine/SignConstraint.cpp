@@ -0,0 +1,407 @@
+/*********************                                                        */
+/*! \file SignConstraint.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "IConstraintBoundTightener.h"
+#include "ITableau.h"
+#include "MStringf.h"
+#include "MarabouError.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "SignConstraint.h"
+#include "Statistics.h"
+
+#ifdef _WIN32
+#define __attribute__(x)
+#endif
+
+SignConstraint::SignConstraint( unsigned b, unsigned f )
+    : _b( b )
+    , _f( f )
+    , _phaseStatus( PHASE_NOT_FIXED )
+    , _haveEliminatedVariables( false )
+    , _bEliminated( false )
+{
+}
+
+SignConstraint::SignConstraint( const String &serializedSign )
+    : _phaseStatus( PHASE_NOT_FIXED )
+    , _haveEliminatedVariables( false )
+    , _bEliminated( false )
+{
+    String constraintType = serializedSign.substring( 0, 4 );
+    ASSERT( constraintType == String( "sign" ) );
+
+    // Remove the constraint type in serialized form
+    String serializedValues = serializedSign.substring( 5, serializedSign.length() - 5 );
+    List<String> values = serializedValues.tokenize( "," );
+
+    ASSERT( values.size() == 2 );
+
+    auto var = values.begin();
+    _f = atoi( var->ascii() );
+    ++var;
+    _b = atoi( var->ascii() );
+}
+
+PiecewiseLinearConstraint *SignConstraint::duplicateConstraint() const
+{
+    SignConstraint *clone = new SignConstraint( _b, _f );
+    *clone = *this;
+    return clone;
+}
+
+void SignConstraint::restoreState( const PiecewiseLinearConstraint *state )
+{
+    const SignConstraint *sign = dynamic_cast<const SignConstraint *>( state );
+    *this = *sign;
+}
+
+void SignConstraint::registerAsWatcher( ITableau *tableau )
+{
+    for ( unsigned variable : getParticipatingVariables() )
+        tableau->registerToWatchVariable( this, variable );
+}
+
+void SignConstraint::unregisterAsWatcher( ITableau *tableau )
+{
+    for ( unsigned variable : getParticipatingVariables() )
+        tableau->unregisterToWatchVariable( this, variable );
+}
+
+void SignConstraint::notifyVariableValue( unsigned variable, double value )
+{
+    _assignment[variable] = value;
+    reportStateChange();
+}
+
+void SignConstraint::notifyLowerBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incNumBoundNotificationsPlConstraints();
+
+    if ( _lowerBounds.exists( variable ) && !FloatUtils::gt( bound, _lowerBounds[variable] ) )
+        return;
+
+    _lowerBounds[variable] = bound;
+    updatePhaseStatus();
+    reportStateChange();
+
+    propagateEntailedTightenings();
+}
+
+void SignConstraint::notifyUpperBound( unsigned variable, double bound )
+{
+    if ( _statistics )
+        _statistics->incNumBoundNotificationsPlConstraints();
+
+    if ( _upperBounds.exists( variable ) && !FloatUtils::lt( bound, _upperBounds[variable] ) )
+        return;
+
+    _upperBounds[variable] = bound;
+    updatePhaseStatus();
+    reportStateChange();
+
+    propagateEntailedTightenings();
+}
+
+void SignConstraint::propagateEntailedTightenings()
+{
+    if ( !isActive() || !_constraintBoundTightener )
+        return;
+
+    List<Tightening> tightenings;
+    getEntailedTightenings( tightenings );
+    for ( const auto &tightening : tightenings )
+    {
+        if ( tightening._type == Tightening::LB )
+            _constraintBoundTightener->registerTighterLowerBound( tightening._variable, tightening._value );
+        else if ( tightening._type == Tightening::UB )
+            _constraintBoundTightener->registerTighterUpperBound( tightening._variable, tightening._value );
+    }
+}
+
+bool SignConstraint::participatingVariable( unsigned variable ) const
+{
+    return ( !_bEliminated && variable == _b ) || ( variable == _f );
+}
+
+List<unsigned> SignConstraint::getParticipatingVariables() const
+{
+    return _bEliminated ?
+        List<unsigned>( { _f } ) :
+        List<unsigned>( { _b, _f } );
+}
+
+bool SignConstraint::satisfied() const
+{
+    if ( !_assignment.exists( _f ) || ( !_bEliminated && !_assignment.exists( _b ) ) )
+        throw MarabouError( MarabouError::PARTICIPATING_VARIABLES_ABSENT );
+
+    double bValue = _bEliminated ? 0 : _assignment.get( _b );
+    double fValue = _assignment.get( _f );
+
+    if ( FloatUtils::areEqual( fValue, 1 ) )
+        return !FloatUtils::isNegative( bValue );
+    if ( FloatUtils::areEqual( fValue, -1 ) )
+        return !FloatUtils::isPositive( bValue );
+    return false;
+}
+
+List<PiecewiseLinearConstraint::Fix> SignConstraint::getPossibleFixes() const
+{
+    ASSERT( !satisfied() );
+
+    double bValue = _bEliminated ? 0 : _assignment.get( _b );
+    double fValue = _assignment.get( _f );
+
+    List<PiecewiseLinearConstraint::Fix> fixes;
+
+    // Move f to the sign of b
+    fixes.append( PiecewiseLinearConstraint::Fix( _f, FloatUtils::isNegative( bValue ) ? -1 : 1 ) );
+
+    // If f is already +-1 (but of the wrong sign), b = 0 also repairs the violation
+    if ( !_bEliminated &&
+         ( FloatUtils::areEqual( fValue, 1 ) || FloatUtils::areEqual( fValue, -1 ) ) )
+        fixes.append( PiecewiseLinearConstraint::Fix( _b, 0 ) );
+
+    return fixes;
+}
+
+List<PiecewiseLinearConstraint::Fix> SignConstraint::getSmartFixes( ITableau * ) const
+{
+    return getPossibleFixes();
+}
+
+List<PiecewiseLinearCaseSplit> SignConstraint::getCaseSplits() const
+{
+    if ( _phaseStatus != PHASE_NOT_FIXED )
+        throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
+
+    List<PiecewiseLinearCaseSplit> splits;
+
+    // Start with the phase that matches the current assignment of b
+    if ( !_bEliminated && _assignment.exists( _b ) && FloatUtils::isNegative( _assignment.get( _b ) ) )
+    {
+        splits.append( getNegativeSplit() );
+        splits.append( getPositiveSplit() );
+    }
+    else
+    {
+        splits.append( getPositiveSplit() );
+        splits.append( getNegativeSplit() );
+    }
+
+    return splits;
+}
+
+PiecewiseLinearCaseSplit SignConstraint::getPositiveSplit() const
+{
+    // Positive phase: b >= 0, f = 1
+    PiecewiseLinearCaseSplit positivePhase;
+    if ( !_bEliminated )
+        positivePhase.storeBoundTightening( Tightening( _b, 0.0, Tightening::LB ) );
+    positivePhase.storeBoundTightening( Tightening( _f, 1.0, Tightening::LB ) );
+    positivePhase.storeBoundTightening( Tightening( _f, 1.0, Tightening::UB ) );
+    return positivePhase;
+}
+
+PiecewiseLinearCaseSplit SignConstraint::getNegativeSplit() const
+{
+    // Negative phase: b <= 0, f = -1
+    PiecewiseLinearCaseSplit negativePhase;
+    if ( !_bEliminated )
+        negativePhase.storeBoundTightening( Tightening( _b, 0.0, Tightening::UB ) );
+    negativePhase.storeBoundTightening( Tightening( _f, -1.0, Tightening::LB ) );
+    negativePhase.storeBoundTightening( Tightening( _f, -1.0, Tightening::UB ) );
+    return negativePhase;
+}
+
+bool SignConstraint::phaseFixed() const
+{
+    return _phaseStatus != PHASE_NOT_FIXED;
+}
+
+PiecewiseLinearCaseSplit SignConstraint::getValidCaseSplit() const
+{
+    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+
+    if ( _phaseStatus == PHASE_POSITIVE )
+        return getPositiveSplit();
+
+    return getNegativeSplit();
+}
+
+void SignConstraint::updatePhaseStatus()
+{
+    if ( _phaseStatus != PHASE_NOT_FIXED )
+        return;
+
+    if ( FloatUtils::gt( getLowerBound( _f ), -1 ) ||
+         ( !_bEliminated && FloatUtils::isPositive( getLowerBound( _b ) ) ) )
+        _phaseStatus = PHASE_POSITIVE;
+    else if ( FloatUtils::lt( getUpperBound( _f ), 1 ) ||
+              ( !_bEliminated && FloatUtils::isNegative( getUpperBound( _b ) ) ) )
+        _phaseStatus = PHASE_NEGATIVE;
+}
+
+void SignConstraint::getEntailedTightenings( List<Tightening> &tightenings ) const
+{
+    // f is always in [-1, 1]
+    tightenings.append( Tightening( _f, -1, Tightening::LB ) );
+    tightenings.append( Tightening( _f, 1, Tightening::UB ) );
+
+    if ( _phaseStatus == PHASE_POSITIVE )
+    {
+        tightenings.append( Tightening( _f, 1, Tightening::LB ) );
+        if ( !_bEliminated )
+            tightenings.append( Tightening( _b, 0, Tightening::LB ) );
+    }
+    else if ( _phaseStatus == PHASE_NEGATIVE )
+    {
+        tightenings.append( Tightening( _f, -1, Tightening::UB ) );
+        if ( !_bEliminated )
+            tightenings.append( Tightening( _b, 0, Tightening::UB ) );
+    }
+}
+
+void SignConstraint::dump( String &output ) const
+{
+    output = Stringf( "SignConstraint: x%u = Sign( x%u ). Active? %s. PhaseStatus = %u (%s).\n",
+                      _f, _b,
+                      _constraintActive ? "Yes" : "No",
+                      _phaseStatus, phaseToString( _phaseStatus ).ascii() );
+
+    output += Stringf( "b in [%lf, %lf], f in [%lf, %lf]",
+                       getLowerBound( _b ), getUpperBound( _b ), getLowerBound( _f ), getUpperBound( _f ) );
+}
+
+void SignConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
+{
+    ASSERT( participatingVariable( oldIndex ) );
+    ASSERT( !participatingVariable( newIndex ) );
+
+    if ( _assignment.exists( oldIndex ) )
+    {
+        _assignment[newIndex] = _assignment.get( oldIndex );
+        _assignment.erase( oldIndex );
+    }
+
+    if ( _lowerBounds.exists( oldIndex ) )
+    {
+        _lowerBounds[newIndex] = _lowerBounds.get( oldIndex );
+        _lowerBounds.erase( oldIndex );
+    }
+
+    if ( _upperBounds.exists( oldIndex ) )
+    {
+        _upperBounds[newIndex] = _upperBounds.get( oldIndex );
+        _upperBounds.erase( oldIndex );
+    }
+
+    if ( oldIndex == _b )
+        _b = newIndex;
+    else
+        _f = newIndex;
+}
+
+void SignConstraint::eliminateVariable( unsigned variable, __attribute__((unused)) double fixedValue )
+{
+    ASSERT( participatingVariable( variable ) );
+
+    if ( variable == _f || _phaseStatus != PHASE_NOT_FIXED )
+    {
+        // The sign of b has already been entailed
+        _haveEliminatedVariables = true;
+        return;
+    }
+
+    // b = 0, so f is still either 1 or -1
+    ASSERT( FloatUtils::isZero( fixedValue ) );
+    _bEliminated = true;
+    if ( _assignment.exists( _b ) )
+        _assignment.erase( _b );
+    if ( _lowerBounds.exists( _b ) )
+        _lowerBounds.erase( _b );
+    if ( _upperBounds.exists( _b ) )
+        _upperBounds.erase( _b );
+}
+
+bool SignConstraint::constraintObsolete() const
+{
+    return _haveEliminatedVariables;
+}
+
+String SignConstraint::serializeToString() const
+{
+    // Output format is: sign,f,b
+    return Stringf( "sign,%u,%u", _f, _b );
+}
+
+unsigned SignConstraint::getB() const
+{
+    return _b;
+}
+
+unsigned SignConstraint::getF() const
+{
+    return _f;
+}
+
+SignConstraint::PhaseStatus SignConstraint::getPhaseStatus() const
+{
+    return _phaseStatus;
+}
+
+bool SignConstraint::supportsSymbolicBoundTightening() const
+{
+    return true;
+}
+
+double SignConstraint::getLowerBound( unsigned variable ) const
+{
+    return _lowerBounds.exists( variable ) ? _lowerBounds.get( variable ) : FloatUtils::negativeInfinity();
+}
+
+double SignConstraint::getUpperBound( unsigned variable ) const
+{
+    return _upperBounds.exists( variable ) ? _upperBounds.get( variable ) : FloatUtils::infinity();
+}
+
+String SignConstraint::phaseToString( PhaseStatus phase )
+{
+    switch ( phase )
+    {
+    case PHASE_NOT_FIXED:
+        return "PHASE_NOT_FIXED";
+
+    case PHASE_POSITIVE:
+        return "PHASE_POSITIVE";
+
+    case PHASE_NEGATIVE:
+        return "PHASE_NEGATIVE";
+
+    default:
+        return "UNKNOWN";
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
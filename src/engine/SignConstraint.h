@@ -0,0 +1,178 @@
+/*********************                                                        */
+/*! \file SignConstraint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The constraint f = Sign( b ): f = 1 for positive b, f = -1 for
+ ** negative b, and either value for b = 0 (as strict inequalities
+ ** cannot be expressed). It has two phases: the positive phase
+ ** (b >= 0, f = 1) and the negative phase (b <= 0, f = -1), both of
+ ** which consist of bounds only.
+
+ **/
+
+#ifndef __SignConstraint_h__
+#define __SignConstraint_h__
+
+#include "Map.h"
+#include "PiecewiseLinearConstraint.h"
+
+class SignConstraint : public PiecewiseLinearConstraint
+{
+public:
+    enum PhaseStatus {
+        PHASE_NOT_FIXED = 0,
+        PHASE_POSITIVE = 1,
+        PHASE_NEGATIVE = 2,
+    };
+
+    SignConstraint( unsigned b, unsigned f );
+    SignConstraint( const String &serializedSign );
+
+    /*
+      Return a clone of the constraint.
+    */
+    PiecewiseLinearConstraint *duplicateConstraint() const;
+
+    /*
+      Restore the state of this constraint from the given one.
+    */
+    void restoreState( const PiecewiseLinearConstraint *state );
+
+    /*
+      Register/unregister the constraint with a talbeau.
+     */
+    void registerAsWatcher( ITableau *tableau );
+    void unregisterAsWatcher( ITableau *tableau );
+
+    /*
+      These callbacks are invoked when a watched variable's value
+      changes, or when its bounds change.
+    */
+    void notifyVariableValue( unsigned variable, double value );
+    void notifyLowerBound( unsigned variable, double bound );
+    void notifyUpperBound( unsigned variable, double bound );
+
+    /*
+      Returns true iff the variable participates in this piecewise
+      linear constraint
+    */
+    bool participatingVariable( unsigned variable ) const;
+
+    /*
+      Get the list of variables participating in this constraint.
+    */
+    List<unsigned> getParticipatingVariables() const;
+
+    /*
+      Returns true iff the assignment satisfies the constraint
+    */
+    bool satisfied() const;
+
+    /*
+      Returns a list of possible fixes for the violated constraint.
+    */
+    List<PiecewiseLinearConstraint::Fix> getPossibleFixes() const;
+
+    /*
+      Return a list of smart fixes for violated constraint.
+    */
+    List<PiecewiseLinearConstraint::Fix> getSmartFixes( ITableau *tableau ) const;
+
+    /*
+      Returns the list of case splits that this piecewise linear
+      constraint breaks into: the positive and the negative phase.
+     */
+    List<PiecewiseLinearCaseSplit> getCaseSplits() const;
+
+    /*
+      Check if the constraint's phase has been fixed.
+    */
+    bool phaseFixed() const;
+
+    /*
+      If the constraint's phase has been fixed, get the (valid) case split.
+    */
+    PiecewiseLinearCaseSplit getValidCaseSplit() const;
+
+    /*
+      Preprocessing related functions. Eliminating f, or eliminating b
+      once the phase is fixed, makes the constraint obsolete. If b is
+      eliminated while the phase is not fixed (i.e., b = 0), the
+      constraint remains as a constraint over f alone: f is either 1
+      or -1.
+    */
+    void eliminateVariable( unsigned variable, double fixedValue );
+    void updateVariableIndex( unsigned oldIndex, unsigned newIndex );
+    bool constraintObsolete() const;
+
+    /*
+      Get the tightenings entailed by the constraint.
+    */
+    void getEntailedTightenings( List<Tightening> &tightenings ) const;
+
+    /*
+      Dump the current state of the constraint.
+    */
+    void dump( String &output ) const;
+
+    /*
+      Returns string with shape: sign,_f,_b
+    */
+    String serializeToString() const;
+
+    unsigned getB() const;
+    unsigned getF() const;
+    PhaseStatus getPhaseStatus() const;
+
+    /*
+      Return true if and only if this piecewise linear constraint supports
+      symbolic bound tightening.
+    */
+    bool supportsSymbolicBoundTightening() const;
+
+private:
+    unsigned _b, _f;
+    PhaseStatus _phaseStatus;
+    bool _haveEliminatedVariables;
+
+    /*
+      Whether b has been eliminated (its value was then 0)
+    */
+    bool _bEliminated;
+
+    double getLowerBound( unsigned variable ) const;
+    double getUpperBound( unsigned variable ) const;
+
+    PiecewiseLinearCaseSplit getPositiveSplit() const;
+    PiecewiseLinearCaseSplit getNegativeSplit() const;
+
+    /*
+      Fix the phase, if the bounds rule out one of the phases.
+    */
+    void updatePhaseStatus();
+
+    /*
+      Inform the constraint bound tightener, if one is registered, of
+      the currently entailed tightenings.
+    */
+    void propagateEntailedTightenings();
+
+    static String phaseToString( PhaseStatus phase );
+};
+
+#endif // __SignConstraint_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
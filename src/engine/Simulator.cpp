@@ -17,7 +17,9 @@
 #include "FloatUtils.h"
 #include "Preprocessor.h"
 #include "MarabouError.h"
+#include "NetworkLevelReasoner.h"
 #include "Simulator.h"
+#include "Vector.h"
 
 #ifdef _WIN32
 #include <time.h>
@@ -38,6 +40,9 @@ void Simulator::runSimulations( const InputQuery &inputQuery, unsigned numberOfS
     srand( seed );
 
     // Perform the actual simulations
+    if ( runBatchedSimulations( numberOfSimulations ) )
+        return;
+
     for ( unsigned i = 0; i < numberOfSimulations; ++i )
         runSingleSimulation();
 }
@@ -106,6 +111,72 @@ void Simulator::runSingleSimulation()
     _results.append( result );
 }
 
+bool Simulator::runBatchedSimulations( unsigned numberOfSimulations )
+{
+    NetworkLevelReasoner *nlr = _originalQuery.getNetworkLevelReasoner();
+    if ( !nlr || numberOfSimulations == 0 )
+        return false;
+
+    unsigned numInputs = _originalQuery.getNumInputVariables();
+    unsigned numOutputs = _originalQuery.getNumOutputVariables();
+
+    Vector<unsigned> inputVariables;
+    for ( unsigned i = 0; i < numInputs; ++i )
+        inputVariables.append( _originalQuery.inputVariableByIndex( i ) );
+
+    Vector<unsigned> outputVariables;
+    for ( unsigned i = 0; i < numOutputs; ++i )
+        outputVariables.append( _originalQuery.outputVariableByIndex( i ) );
+
+    // Find, for every variable, the neuron value that it represents
+    unsigned numberOfVariables = _originalQuery.getNumberOfVariables();
+    unsigned numberOfNeurons = nlr->getNumberOfNeurons();
+    Vector<unsigned> variableToValue;
+    if ( !nlr->mapVariablesToNeuronValues( numberOfVariables, inputVariables, outputVariables, variableToValue ) )
+        return false;
+
+    // Draw all inputs, and evaluate them together
+    Vector<double> inputs( numberOfSimulations * numInputs );
+    for ( unsigned simulation = 0; simulation < numberOfSimulations; ++simulation )
+    {
+        for ( unsigned i = 0; i < numInputs; ++i )
+        {
+            unsigned input = _originalQuery.inputVariableByIndex( i );
+            double lb = _originalQuery.getLowerBound( input );
+            double ub = _originalQuery.getUpperBound( input );
+
+            double factor = ((double)rand()) / RAND_MAX;
+            inputs[simulation * numInputs + i] = lb + factor * ( ub - lb );
+        }
+    }
+
+    Vector<double> outputs( numberOfSimulations * numOutputs );
+    Vector<double> weightedSums( numberOfSimulations * numberOfNeurons );
+    Vector<double> activationResults( numberOfSimulations * numberOfNeurons );
+    nlr->evaluateBatch( inputs.data(), numberOfSimulations, outputs.data(),
+                        weightedSums.data(), activationResults.data() );
+
+    // Extract the results
+    for ( unsigned simulation = 0; simulation < numberOfSimulations; ++simulation )
+    {
+        const double *simulationWeightedSums = weightedSums.data() + simulation * numberOfNeurons;
+        const double *simulationActivationResults = activationResults.data() + simulation * numberOfNeurons;
+
+        Simulator::Result result;
+        for ( unsigned i = 0; i < numberOfVariables; ++i )
+        {
+            unsigned value = variableToValue[i];
+            result[i] = value < numberOfNeurons ?
+                simulationActivationResults[value] :
+                simulationWeightedSums[value - numberOfNeurons];
+        }
+
+        _results.append( result );
+    }
+
+    return true;
+}
+
 const List<Simulator::Result> *Simulator::getResults()
 {
     return &_results;
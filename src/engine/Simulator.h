@@ -24,7 +24,10 @@
   and runs simulations of the neural network that it describes.
   The simulations are performed by selecting values for the
   input variables uniformly at random, evaluating the network,
-  and then storing the results.
+  and then storing the results. If the query has a network-level
+  reasoner that determines the values of all variables, all
+  simulations are evaluated together as a single batch; otherwise,
+  each simulation is propagated through the preprocessor.
 */
 
 class Simulator
@@ -60,6 +63,13 @@ private:
       query.
     */
     void runSingleSimulation();
+
+    /*
+      Run all simulations as a batch evaluation of the network-level
+      reasoner. Returns false, without running anything, if the query
+      has no reasoner or if some variable is not represented in it.
+    */
+    bool runBatchedSimulations( unsigned numberOfSimulations );
 };
 
 #endif // __Simulator_h__
@@ -19,6 +19,7 @@
 #include "FloatUtils.h"
 #include "GlobalConfiguration.h"
 #include "IEngine.h"
+#include "LearnedConflictStore.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "ReluConstraint.h"
@@ -29,6 +30,8 @@ SmtCore::SmtCore( IEngine *engine )
     , _engine( engine )
     , _needToSplit( false )
     , _constraintForSplitting( NULL )
+    , _learnedConflictStore( NULL )
+    , _splitsDonated( false )
     , _stateId( 0 )
     , _constraintViolationThreshold
       ( GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD )
@@ -42,15 +45,47 @@ SmtCore::~SmtCore()
 
 void SmtCore::freeMemory()
 {
-    for ( const auto &stackEntry : _stack )
+    for ( const auto &stackEntry : _stackEntryPool )
     {
         delete stackEntry->_engineState;
         delete stackEntry;
     }
 
+    _stackEntryPool.clear();
     _stack.clear();
 }
 
+SmtCore::StackEntry *SmtCore::acquireStackEntry()
+{
+    unsigned depth = _stack.size();
+    if ( depth < _stackEntryPool.size() )
+    {
+        if ( _statistics )
+            _statistics->incNumSearchNodesReused();
+        return _stackEntryPool[depth];
+    }
+
+    StackEntry *stackEntry = new StackEntry;
+    stackEntry->_engineState = new EngineState;
+    _stackEntryPool.append( stackEntry );
+
+    if ( _statistics )
+        _statistics->incNumSearchNodesAllocated();
+
+    return stackEntry;
+}
+
+void SmtCore::releaseStackEntry( StackEntry *stackEntry )
+{
+    // The engine state's arrays and constraint clones are kept, but the
+    // splits and the shared constraint matrix are not needed anymore
+    stackEntry->_activeSplit = PiecewiseLinearCaseSplit();
+    stackEntry->_impliedValidSplits.clear();
+    stackEntry->_alternativeSplits.clear();
+    stackEntry->_activeSplitSubtreeDonated = false;
+    stackEntry->_engineState->_tableauState._matrixData.reset();
+}
+
 void SmtCore::reportViolatedConstraint( PiecewiseLinearConstraint *constraint )
 {
     if ( !_constraintToViolationCount.exists( constraint ) )
@@ -115,23 +150,22 @@ void SmtCore::performSplit()
     _constraintForSplitting->setActiveConstraint( false );
 
     // Obtain the current state of the engine
-    EngineState *stateBeforeSplits = new EngineState;
+    StackEntry *stackEntry = acquireStackEntry();
+    EngineState *stateBeforeSplits = stackEntry->_engineState;
     stateBeforeSplits->_stateId = _stateId;
     ++_stateId;
     _engine->storeState( *stateBeforeSplits, true );
 
-    StackEntry *stackEntry = new StackEntry;
     // Perform the first split: add bounds and equations
     List<PiecewiseLinearCaseSplit>::iterator split = splits.begin();
     _engine->applySplit( *split );
-    stackEntry->_activeSplit = *split;
+    stackEntry->_activeSplit = std::move( *split );
 
     // Store the remaining splits on the stack, for later
-    stackEntry->_engineState = stateBeforeSplits;
     ++split;
     while ( split != splits.end() )
     {
-        stackEntry->_alternativeSplits.append( *split );
+        stackEntry->_alternativeSplits.append( std::move( *split ) );
         ++split;
     }
 
@@ -139,6 +173,7 @@ void SmtCore::performSplit()
     if ( _statistics )
     {
         _statistics->setCurrentStackDepth( getStackDepth() );
+        _statistics->setSearchNodeStorageBytes( stateBeforeSplits->getStorageSize() );
         struct timespec end = TimeUtils::sampleMicro();
         _statistics->addTimeSmtCore( TimeUtils::timePassed( start, end ) );
     }
@@ -149,12 +184,23 @@ unsigned SmtCore::getStackDepth() const
     return _stack.size();
 }
 
+const EngineState *SmtCore::getStateAtRoot() const
+{
+    if ( _stack.empty() )
+        return NULL;
+
+    return _stack.front()->_engineState;
+}
+
 bool SmtCore::popSplit()
 {
     log( "Performing a pop" );
 
     if ( _stack.empty() )
+    {
+        publishLearnedConflict();
         return false;
+    }
 
     struct timespec start = TimeUtils::sampleMicro();
 
@@ -177,14 +223,21 @@ bool SmtCore::popSplit()
             throw MarabouError( MarabouError::DEBUGGING_ERROR );
         }
 
-        delete _stack.back()->_engineState;
-        delete _stack.back();
+        releaseStackEntry( _stack.back() );
         _stack.popBack();
 
         if ( _stack.empty() )
+        {
+            if ( !_splitsDonated )
+                publishLearnedConflict();
             return false;
+        }
     }
 
+    // The active split of the current entry has failed
+    if ( !_stack.back()->_activeSplitSubtreeDonated )
+        publishLearnedConflict();
+
     if ( checkSkewFromDebuggingSolution() )
     {
         // Pops should not occur from a compliant stack!
@@ -209,8 +262,9 @@ bool SmtCore::popSplit()
     _engine->applySplit( *split );
     log( "\tApplying new split - DONE" );
 
-    stackEntry->_activeSplit = *split;
+    stackEntry->_activeSplit = std::move( *split );
     stackEntry->_alternativeSplits.erase( split );
+    stackEntry->_activeSplitSubtreeDonated = false;
 
     if ( _statistics )
     {
@@ -260,6 +314,83 @@ void SmtCore::setStatistics( Statistics *statistics )
     _statistics = statistics;
 }
 
+void SmtCore::setLearnedConflictStore( LearnedConflictStore *store )
+{
+    _learnedConflictStore = store;
+}
+
+void SmtCore::setSearchRegion( const PiecewiseLinearCaseSplit &region )
+{
+    _searchRegion = region;
+}
+
+bool SmtCore::donateAlternativeSplit( PiecewiseLinearCaseSplit &split )
+{
+    auto donor = _stack.begin();
+    while ( donor != _stack.end() && (*donor)->_alternativeSplits.empty() )
+        ++donor;
+
+    if ( donor == _stack.end() )
+        return false;
+
+    // The donated alternative lies in the subtrees of the active splits
+    // of all the levels below the donor
+    split = PiecewiseLinearCaseSplit();
+    for ( auto it = _stack.begin(); it != donor; ++it )
+    {
+        split.addSplit( (*it)->_activeSplit );
+        (*it)->_activeSplitSubtreeDonated = true;
+    }
+
+    // Donate the alternative that would have been explored last
+    split.addSplit( (*donor)->_alternativeSplits.back() );
+    (*donor)->_alternativeSplits.popBack();
+
+    _splitsDonated = true;
+    return true;
+}
+
+bool SmtCore::splitIsApplied( const PiecewiseLinearCaseSplit &split ) const
+{
+    for ( const auto &impliedSplit : _impliedValidSplitsAtRoot )
+        if ( impliedSplit == split )
+            return true;
+
+    for ( const auto &stackEntry : _stack )
+    {
+        if ( stackEntry->_activeSplit == split )
+            return true;
+
+        for ( const auto &impliedSplit : stackEntry->_impliedValidSplits )
+            if ( impliedSplit == split )
+                return true;
+    }
+
+    return false;
+}
+
+void SmtCore::publishLearnedConflict()
+{
+    if ( !_learnedConflictStore )
+        return;
+
+    if ( _stack.size() > GlobalConfiguration::MAX_LEARNED_CONFLICT_LENGTH )
+        return;
+
+    LearnedConflict *conflict = new LearnedConflict;
+    if ( !conflict )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "SmtCore::conflict" );
+
+    // The conflict holds within the search region, under the active
+    // splits. Implied valid splits follow from these, and are omitted.
+    conflict->addSplit( _searchRegion );
+    for ( const auto &stackEntry : _stack )
+        conflict->addSplit( stackEntry->_activeSplit );
+
+    if ( _learnedConflictStore->publish( conflict ) && _statistics )
+        _statistics->incNumLearnedConflictsPublished();
+}
+
 void SmtCore::log( const String &message )
 {
     if ( GlobalConfiguration::SMT_CORE_LOGGING )
@@ -330,7 +461,7 @@ bool SmtCore::splitAllowsStoredSolution( const PiecewiseLinearCaseSplit &split,
     if ( _debuggingSolution.empty() )
         return true;
 
-    for ( const auto bound : split.getBoundTightenings() )
+    for ( const auto &bound : split.getBoundTightenings() )
     {
         unsigned variable = bound._variable;
 
@@ -369,26 +500,26 @@ void SmtCore::setConstraintViolationThreshold( unsigned threshold )
     _constraintViolationThreshold = threshold;
 }
 
-PiecewiseLinearConstraint *SmtCore::chooseViolatedConstraintForFixing( List<PiecewiseLinearConstraint *> &_violatedPlConstraints ) const
+PiecewiseLinearConstraint *SmtCore::chooseViolatedConstraintForFixing( const Map<unsigned, PiecewiseLinearConstraint *> &_violatedPlConstraints ) const
 {
     ASSERT( !_violatedPlConstraints.empty() );
 
     if ( !GlobalConfiguration::USE_LEAST_FIX )
-        return *_violatedPlConstraints.begin();
+        return _violatedPlConstraints.begin()->second;
 
     PiecewiseLinearConstraint *candidate;
 
     // Apply the least fix heuristic
     auto it = _violatedPlConstraints.begin();
 
-    candidate = *it;
+    candidate = it->second;
     unsigned minFixes = getViolationCounts( candidate );
 
     PiecewiseLinearConstraint *contender;
     unsigned contenderFixes;
     while ( it != _violatedPlConstraints.end() )
     {
-        contender = *it;
+        contender = it->second;
         contenderFixes = getViolationCounts( contender );
         if ( contenderFixes < minFixes )
         {
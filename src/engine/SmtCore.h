@@ -16,13 +16,16 @@
 #ifndef __SmtCore_h__
 #define __SmtCore_h__
 
+#include "Map.h"
 #include "PiecewiseLinearCaseSplit.h"
 #include "PiecewiseLinearConstraint.h"
 #include "Stack.h"
 #include "Statistics.h"
+#include "Vector.h"
 
 class EngineState;
 class IEngine;
+class LearnedConflictStore;
 class String;
 
 class SmtCore
@@ -32,7 +35,7 @@ public:
     ~SmtCore();
 
     /*
-      Clear the stack.
+      Clear the stack, and release the stack entries kept for reuse.
     */
     void freeMemory();
 
@@ -74,6 +77,12 @@ public:
     */
     unsigned getStackDepth() const;
 
+    /*
+      The engine state stored before the first split on the stack was
+      performed, or NULL if the stack is empty.
+    */
+    const EngineState *getStateAtRoot() const;
+
     /*
       Let the smt core know of an implied valid case split that was discovered.
     */
@@ -91,10 +100,11 @@ public:
     void setStatistics( Statistics *statistics );
 
     /*
-      Have the SMT core choose, among a set of violated PL constraints, which
-      constraint should be repaired (without splitting)
+      Have the SMT core choose, among a set of violated PL constraints
+      (keyed by their indices), which constraint should be repaired
+      (without splitting)
     */
-    PiecewiseLinearConstraint *chooseViolatedConstraintForFixing( List<PiecewiseLinearConstraint *> &_violatedPlConstraints ) const;
+    PiecewiseLinearConstraint *chooseViolatedConstraintForFixing( const Map<unsigned, PiecewiseLinearConstraint *> &_violatedPlConstraints ) const;
 
     void setConstraintViolationThreshold( unsigned threshold );
 
@@ -103,6 +113,29 @@ public:
     */
     void pickSplitPLConstraint();
 
+    /*
+      Have the SMT core publish the conflicts it learns to a shared
+      store. Every conflict is learned within the search region, which
+      is given as bounds on the input variables.
+    */
+    void setLearnedConflictStore( LearnedConflictStore *store );
+    void setSearchRegion( const PiecewiseLinearCaseSplit &region );
+
+    /*
+      Remove an unexplored alternative split from the stack, so that it
+      can be explored elsewhere. The alternative is taken from the
+      lowest possible level of the stack, and the returned split
+      combines it with the active splits of the levels below it.
+      Return false if there are no unexplored alternatives.
+    */
+    bool donateAlternativeSplit( PiecewiseLinearCaseSplit &split );
+
+    /*
+      Return true iff the given split has been applied, either as an
+      SMT-originating split or as an implied valid split.
+    */
+    bool splitIsApplied( const PiecewiseLinearCaseSplit &split ) const;
+
     /*
       For debugging purposes only - store a correct possible solution
     */
@@ -119,10 +152,23 @@ private:
     struct StackEntry
     {
     public:
+        StackEntry()
+            : _engineState( NULL )
+            , _activeSplitSubtreeDonated( false )
+        {
+        }
+
         PiecewiseLinearCaseSplit _activeSplit;
         List<PiecewiseLinearCaseSplit> _impliedValidSplits;
         List<PiecewiseLinearCaseSplit> _alternativeSplits;
         EngineState *_engineState;
+
+        /*
+          Whether parts of the subtree below the active split were
+          donated, in which case failing to find a solution in this
+          subtree does not mean that the active split is infeasible.
+        */
+        bool _activeSplitSubtreeDonated;
     };
 
     /*
@@ -140,6 +186,24 @@ private:
     */
     List<StackEntry *> _stack;
 
+    /*
+      The stack entries, together with their engine states, are kept
+      for reuse: the entry at depth i is allocated the first time the
+      stack reaches that depth, and is recycled whenever the stack
+      returns to it. Storing a state at a visited depth thus reuses the
+      memory of the previous state stored there, and a pop frees
+      nothing. The entries on the stack are always a prefix of this
+      pool.
+    */
+    Vector<StackEntry *> _stackEntryPool;
+
+    /*
+      Get the entry for the next stack level, and release a popped
+      entry for reuse.
+    */
+    StackEntry *acquireStackEntry();
+    void releaseStackEntry( StackEntry *stackEntry );
+
     /*
       The engine.
     */
@@ -158,6 +222,23 @@ private:
 
     static void log( const String &message );
 
+    /*
+      The current search state is infeasible: publish the active
+      splits on the stack as a learned conflict, if it is short enough.
+    */
+    void publishLearnedConflict();
+
+    /*
+      Store for publishing learned conflicts, and the search region.
+    */
+    LearnedConflictStore *_learnedConflictStore;
+    PiecewiseLinearCaseSplit _searchRegion;
+
+    /*
+      Whether any alternative splits have been donated.
+    */
+    bool _splitsDonated;
+
     /*
       For debugging purposes only
     */
@@ -18,11 +18,34 @@
 
 #include "List.h"
 #include "MString.h"
+#include "Map.h"
 #include "PiecewiseLinearCaseSplit.h"
+#include "Vector.h"
 
 #include <boost/lockfree/queue.hpp>
+#include <memory>
 #include <utility>
 
+/*
+  Information that a subquery inherits from its parent, so that the
+  child engine does not need to redo the parent's work. Everything
+  here holds at the root of the parent's search, and hence also in
+  any of the parent's subregions. Variables are those of the
+  preprocessed query.
+*/
+struct SubQueryWarmStart
+{
+    // The basic variables at the root of the parent's search
+    List<unsigned> _basicVariables;
+
+    // The tightest bounds known for each variable
+    Vector<double> _lowerBounds;
+    Vector<double> _upperBounds;
+
+    // The ReLUs whose phases were fixed, keyed by their b variables
+    Map<unsigned, unsigned> _fixedReluPhases;
+};
+
 // Struct representing a subquery
 struct SubQuery
 {
@@ -40,6 +63,9 @@ struct SubQuery
     String _queryId;
     std::unique_ptr<PiecewiseLinearCaseSplit> _split;
     unsigned _timeoutInSeconds;
+
+    // Optional; shared by all the subqueries created from one parent
+    std::shared_ptr<const SubQueryWarmStart> _warmStart;
 };
 
 // Synchronized Queue containing the Sub-Queries shared by workers
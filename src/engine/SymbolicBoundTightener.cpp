@@ -13,10 +13,13 @@
 
  **/
 
+#include "AbsoluteValueConstraint.h"
 #include "Debug.h"
 #include "FloatUtils.h"
+#include "LeakyReluConstraint.h"
 #include "MStringf.h"
 #include "MarabouError.h"
+#include "SignConstraint.h"
 #include "SymbolicBoundTightener.h"
 
 SymbolicBoundTightener::SymbolicBoundTightener()
@@ -523,8 +526,17 @@ void SymbolicBoundTightener::run( bool useLinearConcretization )
                     reluPhase = _nodeIndexToReluState[reluIndex];
                 }
 
+                if ( _nodeIndexToActivation.exists( reluIndex ) &&
+                     _nodeIndexToActivation[reluIndex] != RELU )
+                {
+                    applyActivation( reluIndex, _nodeIndexToActivation[reluIndex], reluPhase,
+                                     useLinearConcretization, lbLb, lbUb, ubLb, ubUb );
+
+                    log( Stringf( "\tAfter activation: concrete lb: %lf, ub: %lf\n", lbLb, ubUb ) );
+                }
+
                 // If the ReLU phase is not fixed yet, do the usual propagation:
-                if ( reluPhase == ReluConstraint::PHASE_NOT_FIXED )
+                else if ( reluPhase == ReluConstraint::PHASE_NOT_FIXED )
                 {
                     if ( ubUb <= 0 )
                     {
@@ -670,6 +682,141 @@ void SymbolicBoundTightener::run( bool useLinearConcretization )
     }
 }
 
+void SymbolicBoundTightener::applyActivation( const NodeIndex &index,
+                                              ActivationFunction activation,
+                                              ReluConstraint::PhaseStatus phase,
+                                              bool useLinearConcretization,
+                                              double &lbLb, double &lbUb, double &ubLb, double &ubUb )
+{
+    unsigned neuron = index._neuron;
+    unsigned layerSize = _layerSizes[index._layer];
+
+    bool active = ( phase == ReluConstraint::PHASE_ACTIVE );
+    bool inactive = ( phase == ReluConstraint::PHASE_INACTIVE );
+    bool notFixed = ( phase == ReluConstraint::PHASE_NOT_FIXED );
+
+    if ( activation == LEAKY_RELU )
+    {
+        double slope = _nodeIndexToLeakyReluSlope[index];
+
+        if ( active || ( notFixed && lbLb >= 0 ) )
+        {
+            // The identity
+        }
+        else if ( inactive || ( notFixed && ubUb <= 0 ) )
+        {
+            // Multiplication by the slope
+            scaleSymbolicBound( false, neuron, layerSize, slope, 0 );
+            scaleSymbolicBound( true, neuron, layerSize, slope, 0 );
+            lbLb *= slope;
+            lbUb *= slope;
+            ubLb *= slope;
+            ubUb *= slope;
+        }
+        else
+        {
+            // lbLb < 0 < ubUb. The upper bound is concretized as for
+            // ReLUs, through the line from ( ubLb, slope * ubLb ) to
+            // ( ubUb, ubUb ).
+            if ( ubLb < 0 )
+            {
+                if ( useLinearConcretization )
+                {
+                    double width = ubUb - ubLb;
+                    scaleSymbolicBound( true, neuron, layerSize,
+                                        ( ubUb - slope * ubLb ) / width,
+                                        -( 1 - slope ) * ubUb * ubLb / width );
+                }
+                else
+                    scaleSymbolicBound( true, neuron, layerSize, 0, ubUb );
+            }
+
+            // Any line through the origin with a gradient between the
+            // slope and 1 is a lower bound
+            double lowerGradient = slope;
+            if ( useLinearConcretization && lbUb >= 0 )
+                lowerGradient = slope + ( 1 - slope ) * lbUb / ( lbUb - lbLb );
+            scaleSymbolicBound( false, neuron, layerSize, lowerGradient, 0 );
+
+            lbLb *= slope;
+        }
+    }
+    else if ( activation == ABSOLUTE_VALUE )
+    {
+        if ( active || ( notFixed && lbLb >= 0 ) )
+        {
+            // The identity
+        }
+        else if ( inactive || ( notFixed && ubUb <= 0 ) )
+        {
+            // Negation: the lower and upper bounds swap
+            negateSymbolicBounds( neuron, layerSize );
+
+            double oldLbLb = lbLb;
+            double oldLbUb = lbUb;
+            lbLb = -ubUb;
+            lbUb = -ubLb;
+            ubLb = -oldLbUb;
+            ubUb = -oldLbLb;
+        }
+        else
+        {
+            // lbLb < 0 < ubUb: the result is between 0 and the larger magnitude
+            double upper = FloatUtils::max( -lbLb, ubUb );
+            scaleSymbolicBound( false, neuron, layerSize, 0, 0 );
+            scaleSymbolicBound( true, neuron, layerSize, 0, upper );
+            lbLb = 0;
+            lbUb = 0;
+            ubLb = upper;
+            ubUb = upper;
+        }
+    }
+    else
+    {
+        ASSERT( activation == SIGN );
+
+        double lower = -1;
+        double upper = 1;
+        if ( active || ( notFixed && lbLb > 0 ) )
+            lower = 1;
+        else if ( inactive || ( notFixed && ubUb < 0 ) )
+            upper = -1;
+
+        scaleSymbolicBound( false, neuron, layerSize, 0, lower );
+        scaleSymbolicBound( true, neuron, layerSize, 0, upper );
+        lbLb = lower;
+        lbUb = lower;
+        ubLb = upper;
+        ubUb = upper;
+    }
+}
+
+void SymbolicBoundTightener::scaleSymbolicBound( bool upper, unsigned neuron, unsigned layerSize,
+                                                 double factor, double shift )
+{
+    double *coefficients = upper ? _currentLayerUpperBounds : _currentLayerLowerBounds;
+    double *bias = upper ? _currentLayerUpperBias : _currentLayerLowerBias;
+
+    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+        coefficients[j * layerSize + neuron] *= factor;
+
+    bias[neuron] = bias[neuron] * factor + shift;
+}
+
+void SymbolicBoundTightener::negateSymbolicBounds( unsigned neuron, unsigned layerSize )
+{
+    for ( unsigned j = 0; j < _inputLayerSize; ++j )
+    {
+        double lower = _currentLayerLowerBounds[j * layerSize + neuron];
+        _currentLayerLowerBounds[j * layerSize + neuron] = -_currentLayerUpperBounds[j * layerSize + neuron];
+        _currentLayerUpperBounds[j * layerSize + neuron] = -lower;
+    }
+
+    double lowerBias = _currentLayerLowerBias[neuron];
+    _currentLayerLowerBias[neuron] = -_currentLayerUpperBias[neuron];
+    _currentLayerUpperBias[neuron] = -lowerBias;
+}
+
 double SymbolicBoundTightener::getLowerBound( unsigned layer, unsigned neuron ) const
 {
     return _lowerBounds[layer][neuron];
@@ -696,6 +843,103 @@ void SymbolicBoundTightener::setReluStatus( unsigned layer, unsigned neuron, Rel
     _nodeIndexToReluState[NodeIndex( layer, neuron )] = status;
 }
 
+void SymbolicBoundTightener::setActivationFunction( unsigned layer, unsigned neuron,
+                                                    ActivationFunction activation, double slope )
+{
+    _nodeIndexToActivation[NodeIndex( layer, neuron )] = activation;
+    if ( activation == LEAKY_RELU )
+        _nodeIndexToLeakyReluSlope[NodeIndex( layer, neuron )] = slope;
+}
+
+bool SymbolicBoundTightener::getConstraintPhase( const PiecewiseLinearConstraint *constraint,
+                                                 unsigned &b,
+                                                 ActivationFunction &activation,
+                                                 double &slope,
+                                                 ReluConstraint::PhaseStatus &phase )
+{
+    phase = ReluConstraint::PHASE_NOT_FIXED;
+    slope = 0;
+
+    if ( const ReluConstraint *relu = dynamic_cast<const ReluConstraint *>( constraint ) )
+    {
+        b = relu->getB();
+        activation = RELU;
+        phase = relu->getPhaseStatus();
+        return true;
+    }
+
+    if ( const LeakyReluConstraint *leakyRelu = dynamic_cast<const LeakyReluConstraint *>( constraint ) )
+    {
+        b = leakyRelu->getB();
+        activation = LEAKY_RELU;
+        slope = leakyRelu->getSlope();
+        if ( leakyRelu->getPhaseStatus() == LeakyReluConstraint::PHASE_ACTIVE )
+            phase = ReluConstraint::PHASE_ACTIVE;
+        else if ( leakyRelu->getPhaseStatus() == LeakyReluConstraint::PHASE_INACTIVE )
+            phase = ReluConstraint::PHASE_INACTIVE;
+        return true;
+    }
+
+    if ( const AbsoluteValueConstraint *abs = dynamic_cast<const AbsoluteValueConstraint *>( constraint ) )
+    {
+        b = abs->getB();
+        activation = ABSOLUTE_VALUE;
+        if ( abs->getPhaseStatus() == AbsoluteValueConstraint::PHASE_POSITIVE )
+            phase = ReluConstraint::PHASE_ACTIVE;
+        else if ( abs->getPhaseStatus() == AbsoluteValueConstraint::PHASE_NEGATIVE )
+            phase = ReluConstraint::PHASE_INACTIVE;
+        return true;
+    }
+
+    if ( const SignConstraint *sign = dynamic_cast<const SignConstraint *>( constraint ) )
+    {
+        b = sign->getB();
+        activation = SIGN;
+        if ( sign->getPhaseStatus() == SignConstraint::PHASE_POSITIVE )
+            phase = ReluConstraint::PHASE_ACTIVE;
+        else if ( sign->getPhaseStatus() == SignConstraint::PHASE_NEGATIVE )
+            phase = ReluConstraint::PHASE_INACTIVE;
+        return true;
+    }
+
+    return false;
+}
+
+void SymbolicBoundTightener::setConstraintStatus( const PiecewiseLinearConstraint *constraint )
+{
+    unsigned b;
+    ActivationFunction activation;
+    double slope;
+    ReluConstraint::PhaseStatus phase;
+    if ( !getConstraintPhase( constraint, b, activation, slope, phase ) )
+        throw MarabouError( MarabouError::SYMBOLIC_BOUND_TIGHTENER_UNSUPPORTED_CONSTRAINT_TYPE );
+
+    // A constraint whose input was eliminated has no neuron to report
+    if ( !constraint->participatingVariable( b ) )
+        return;
+
+    NodeIndex nodeIndex = nodeIndexFromB( b );
+    setActivationFunction( nodeIndex._layer, nodeIndex._neuron, activation, slope );
+    setReluStatus( nodeIndex._layer, nodeIndex._neuron, phase );
+}
+
+void SymbolicBoundTightener::setEliminatedConstraint( const PiecewiseLinearConstraint *constraint )
+{
+    unsigned b;
+    ActivationFunction activation;
+    double slope;
+    ReluConstraint::PhaseStatus phase;
+    if ( !getConstraintPhase( constraint, b, activation, slope, phase ) )
+        throw MarabouError( MarabouError::SYMBOLIC_BOUND_TIGHTENER_UNSUPPORTED_CONSTRAINT_TYPE );
+
+    if ( phase == ReluConstraint::PHASE_NOT_FIXED )
+        return;
+
+    NodeIndex nodeIndex = nodeIndexFromB( b );
+    setActivationFunction( nodeIndex._layer, nodeIndex._neuron, activation, slope );
+    setEliminatedRelu( nodeIndex._layer, nodeIndex._neuron, phase );
+}
+
 void SymbolicBoundTightener::setReluBVariable( unsigned layer, unsigned neuron, unsigned b )
 {
     _nodeIndexToBVariable[NodeIndex( layer, neuron )] = b;
@@ -882,6 +1126,9 @@ void SymbolicBoundTightener::storeIntoOther( SymbolicBoundTightener &other ) con
     other._nodeIndexToReluState = _nodeIndexToReluState;
     other._nodeIndexToEliminatedReluState = _nodeIndexToEliminatedReluState;
 
+    other._nodeIndexToActivation = _nodeIndexToActivation;
+    other._nodeIndexToLeakyReluSlope = _nodeIndexToLeakyReluSlope;
+
     other._inputNeuronToIndex = _inputNeuronToIndex;
 }
 
@@ -26,7 +26,8 @@
   A utility class for performing symbolic bound tightening.
   It currently makes the following assumptions:
 
-    1. The network only has ReLU activations functions
+    1. The network's hidden neurons have ReLU, leaky ReLU, absolute
+       value or sign activation functions
     2. The network is fully connected
     3. An external caller has stored the weights and topology
 */
@@ -34,6 +35,13 @@
 class SymbolicBoundTightener
 {
 public:
+    enum ActivationFunction {
+        RELU = 0,
+        LEAKY_RELU,
+        ABSOLUTE_VALUE,
+        SIGN,
+    };
+
     struct WeightMatrix
     {
         double *_positiveValues;
@@ -94,6 +102,13 @@ public:
     void setReluBVariable( unsigned layer, unsigned neuron, unsigned b );
     void setReluFVariable( unsigned layer, unsigned neuron, unsigned f );
 
+    /*
+      Set the activation function of a hidden neuron (ReLU, unless
+      specified otherwise). For leaky ReLUs, the slope of the negative
+      part is also given.
+    */
+    void setActivationFunction( unsigned layer, unsigned neuron, ActivationFunction activation, double slope = 0 );
+
     NodeIndex nodeIndexFromB( unsigned b ) const;
     const Map<NodeIndex, unsigned> &getNodeIndexToFMapping() const;
 
@@ -113,6 +128,19 @@ public:
     void setReluStatus( unsigned layer, unsigned neuron, ReluConstraint::PhaseStatus status );
     void clearReluStatuses();
 
+    /*
+      Report the phase of a piecewise-linear constraint that supports
+      symbolic bound tightening (a ReLU, leaky ReLU, absolute value or
+      sign constraint over one of the hidden neurons), possibly as
+      permanently fixed. For the activations other than ReLU, the
+      PHASE_ACTIVE and PHASE_INACTIVE statuses denote the phases in
+      which the neuron's input is non-negative and non-positive. The
+      neuron's activation function is set according to the type of
+      the constraint.
+    */
+    void setConstraintStatus( const PiecewiseLinearConstraint *constraint );
+    void setEliminatedConstraint( const PiecewiseLinearConstraint *constraint );
+
     /*
       Running the tool, with or without linear concertization
     */
@@ -159,6 +187,10 @@ private:
     Map<NodeIndex, ReluConstraint::PhaseStatus> _nodeIndexToReluState;
     Map<NodeIndex, ReluConstraint::PhaseStatus> _nodeIndexToEliminatedReluState;
 
+    // Nodes with activation functions other than ReLU
+    Map<NodeIndex, ActivationFunction> _nodeIndexToActivation;
+    Map<NodeIndex, double> _nodeIndexToLeakyReluSlope;
+
     // To account for input variable renaming as part of preprocessing
     Map<unsigned, unsigned> _inputNeuronToIndex;
 
@@ -177,6 +209,35 @@ private:
 
     void freeMemoryIfNeeded();
     static void log( const String &message );
+
+    /*
+      Extract the input variable, the activation function (and slope,
+      for leaky ReLUs) and the phase of a constraint over a hidden
+      neuron. Returns false for unsupported constraint types.
+    */
+    static bool getConstraintPhase( const PiecewiseLinearConstraint *constraint,
+                                    unsigned &b,
+                                    ActivationFunction &activation,
+                                    double &slope,
+                                    ReluConstraint::PhaseStatus &phase );
+
+    /*
+      Apply a non-ReLU activation function to the symbolic and concrete
+      bounds of a neuron in the current layer.
+    */
+    void applyActivation( const NodeIndex &index,
+                          ActivationFunction activation,
+                          ReluConstraint::PhaseStatus phase,
+                          bool useLinearConcretization,
+                          double &lbLb, double &lbUb, double &ubLb, double &ubUb );
+
+    /*
+      Replace the lower (or upper) symbolic bound of a neuron in the
+      current layer with factor * bound + shift; and swap the two
+      bounds, negating them.
+    */
+    void scaleSymbolicBound( bool upper, unsigned neuron, unsigned layerSize, double factor, double shift );
+    void negateSymbolicBounds( unsigned neuron, unsigned layerSize );
 };
 
 #endif // __SymbolicBoundTightener_h__
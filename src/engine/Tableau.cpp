@@ -34,15 +34,19 @@
 Tableau::Tableau()
     : _n ( 0 )
     , _m ( 0 )
+    , _nCapacity( 0 )
+    , _mCapacity( 0 )
     , _A( NULL )
     , _sparseColumnsOfA( NULL )
     , _sparseRowsOfA( NULL )
-    , _denseA( NULL )
+    , _denseAColumn( NULL )
     , _changeColumn( NULL )
     , _pivotRow( NULL )
     , _b( NULL )
     , _workM( NULL )
     , _workN( NULL )
+    , _refinementResidual( NULL )
+    , _refinementCorrection( NULL )
     , _unitVector( NULL )
     , _basisFactorization( NULL )
     , _multipliers( NULL )
@@ -105,10 +109,10 @@ void Tableau::freeMemoryIfNeeded()
         _sparseRowsOfA = NULL;
     }
 
-    if ( _denseA )
+    if ( _denseAColumn )
     {
-        delete[] _denseA;
-        _denseA = NULL;
+        delete[] _denseAColumn;
+        _denseAColumn = NULL;
     }
 
     if ( _changeColumn )
@@ -201,6 +205,18 @@ void Tableau::freeMemoryIfNeeded()
         _workM = NULL;
     }
 
+    if ( _refinementResidual )
+    {
+        delete[] _refinementResidual;
+        _refinementResidual = NULL;
+    }
+
+    if ( _refinementCorrection )
+    {
+        delete[] _refinementCorrection;
+        _refinementCorrection = NULL;
+    }
+
     if ( _workN )
     {
         delete[] _workN;
@@ -212,6 +228,9 @@ void Tableau::setDimensions( unsigned m, unsigned n )
 {
     _m = m;
     _n = n;
+    _mCapacity = m;
+    _nCapacity = n;
+    _matrixSnapshot.reset();
 
     _A = new CSRMatrix();
     if ( !_A )
@@ -239,9 +258,9 @@ void Tableau::setDimensions( unsigned m, unsigned n )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::sparseRowOfA[i]" );
     }
 
-    _denseA = new double[m*n];
-    if ( !_denseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseA" );
+    _denseAColumn = new double[m];
+    if ( !_denseAColumn )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseAColumn" );
 
     _changeColumn = new double[m];
     if ( !_changeColumn )
@@ -310,24 +329,50 @@ void Tableau::setDimensions( unsigned m, unsigned n )
     if ( !_workN )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::work" );
 
+    _refinementResidual = new long double[m];
+    if ( !_refinementResidual )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::refinementResidual" );
+
+    _refinementCorrection = new double[m];
+    if ( !_refinementCorrection )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::refinementCorrection" );
+
     if ( _statistics )
         _statistics->setCurrentTableauDimension( _m, _n );
 }
 
 void Tableau::setConstraintMatrix( const double *A )
 {
+    _matrixSnapshot.reset();
     _A->initialize( A, _m, _n );
 
     for ( unsigned column = 0; column < _n; ++column )
+        _sparseColumnsOfA[column]->clear();
+
+    for ( unsigned row = 0; row < _m; ++row )
     {
-        for ( unsigned row = 0; row < _m; ++row )
-            _denseA[column*_m + row] = A[row*_n + column];
+        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
 
-        _sparseColumnsOfA[column]->initialize( _denseA + ( column * _m ), _m );
+        for ( const auto &entry : *_sparseRowsOfA[row] )
+            _sparseColumnsOfA[entry._index]->append( row, entry._value );
     }
+}
+
+void Tableau::setConstraintMatrix( const SparseUnsortedList * const *rows )
+{
+    _matrixSnapshot.reset();
+    _A->initialize( rows, _m, _n );
+
+    for ( unsigned column = 0; column < _n; ++column )
+        _sparseColumnsOfA[column]->clear();
 
     for ( unsigned row = 0; row < _m; ++row )
-        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
+    {
+        rows[row]->storeIntoOther( _sparseRowsOfA[row] );
+
+        for ( const auto &entry : *rows[row] )
+            _sparseColumnsOfA[entry._index]->append( row, entry._value );
+    }
 }
 
 void Tableau::markAsBasic( unsigned variable )
@@ -382,6 +427,23 @@ void Tableau::initializeTableau( const List<unsigned> &initialBasicVariables )
 }
 
 void Tableau::computeAssignment()
+{
+    computeBasicAssignment();
+    finalizeBasicAssignment();
+}
+
+void Tableau::computeRefinedAssignment( unsigned refinementSteps )
+{
+    _basisFactorization->obtainFreshBasis();
+
+    computeBasicAssignment();
+    for ( unsigned i = 0; i < refinementSteps; ++i )
+        refineBasicAssignment();
+
+    finalizeBasicAssignment();
+}
+
+void Tableau::computeBasicAssignment()
 {
     /*
       The basic assignment is given by the formula:
@@ -412,7 +474,51 @@ void Tableau::computeAssignment()
 
     // Solve B*xB = y by performing a forward transformation
     _basisFactorization->forwardTransformation( _workM, _basicAssignment );
+}
+
+void Tableau::refineBasicAssignment()
+{
+    /*
+      Compute the residual r = b - A * x, where x is the current
+      assignment. The cancellation in this computation is where
+      precision is lost, so it is accumulated in long double. We then
+      solve B * d = r, and correct the basic assignment to xB + d.
+    */
+    long double *residual = _refinementResidual;
+    double *correction = _refinementCorrection;
+
+    for ( unsigned i = 0; i < _m; ++i )
+        residual[i] = _b[i];
+
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        unsigned var = _nonBasicIndexToVariable[i];
+        long double value = _nonBasicAssignment[i];
+
+        for ( const auto &entry : *_sparseColumnsOfA[var] )
+            residual[entry._index] -= entry._value * value;
+    }
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        unsigned var = _basicIndexToVariable[i];
+        long double value = _basicAssignment[i];
+
+        for ( const auto &entry : *_sparseColumnsOfA[var] )
+            residual[entry._index] -= entry._value * value;
+    }
 
+    for ( unsigned i = 0; i < _m; ++i )
+        _workM[i] = (double)residual[i];
+
+    _basisFactorization->forwardTransformation( _workM, correction );
+
+    for ( unsigned i = 0; i < _m; ++i )
+        _basicAssignment[i] += correction[i];
+}
+
+void Tableau::finalizeBasicAssignment()
+{
     computeBasicStatus();
 
     _basicAssignmentStatus = ITableau::BASIC_ASSIGNMENT_JUST_COMPUTED;
@@ -543,6 +649,7 @@ unsigned Tableau::variableToIndex( unsigned index ) const
 
 void Tableau::setRightHandSide( const double *b )
 {
+    _matrixSnapshot.reset();
     memcpy( _b, b, sizeof(double) * _m );
 
     for ( unsigned i = 0; i < _m; ++i )
@@ -554,6 +661,7 @@ void Tableau::setRightHandSide( const double *b )
 
 void Tableau::setRightHandSide( unsigned index, double value )
 {
+    _matrixSnapshot.reset();
     _b[index] = value;
 
     if ( !FloatUtils::isZero( value ) )
@@ -1494,6 +1602,16 @@ unsigned Tableau::getN() const
     return _n;
 }
 
+unsigned Tableau::getMCapacity() const
+{
+    return _mCapacity;
+}
+
+unsigned Tableau::getNCapacity() const
+{
+    return _nCapacity;
+}
+
 void Tableau::getTableauRow( unsigned index, TableauRow *row )
 {
     /*
@@ -1542,7 +1660,8 @@ const SparseMatrix *Tableau::getSparseA() const
 
 const double *Tableau::getAColumn( unsigned variable ) const
 {
-    return _denseA + ( variable * _m );
+    _sparseColumnsOfA[variable]->toDense( _denseAColumn );
+    return _denseAColumn;
 }
 
 void Tableau::getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const
@@ -1584,16 +1703,24 @@ void Tableau::storeState( TableauState &state ) const
     // Set the dimensions
     state.setDimensions( _m, _n, *this );
 
-    // Store matrix A
-    _A->storeIntoOther( state._A );
-    for ( unsigned i = 0; i < _n; ++i )
-        _sparseColumnsOfA[i]->storeIntoOther( state._sparseColumnsOfA[i] );
-    for ( unsigned i = 0; i < _m; ++i )
-        _sparseRowsOfA[i]->storeIntoOther( state._sparseRowsOfA[i] );
-    memcpy( state._denseA, _denseA, sizeof(double) * _m * _n );
+    // Store matrix A and right hand side vector _b, sharing the existing copy if possible
+    if ( !_matrixSnapshot )
+    {
+        TableauState::MatrixData *matrixData = new TableauState::MatrixData( _m, _n );
+        if ( !matrixData )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::matrixData" );
 
-    // Store right hand side vector _b
-    memcpy( state._b, _b, sizeof(double) * _m );
+        _A->storeIntoOther( matrixData->_A );
+        for ( unsigned i = 0; i < _n; ++i )
+            _sparseColumnsOfA[i]->storeIntoOther( matrixData->_sparseColumnsOfA[i] );
+        for ( unsigned i = 0; i < _m; ++i )
+            _sparseRowsOfA[i]->storeIntoOther( matrixData->_sparseRowsOfA[i] );
+        memcpy( matrixData->_b, _b, sizeof(double) * _m );
+
+        _matrixSnapshot.reset( matrixData );
+    }
+
+    state._matrixData = _matrixSnapshot;
 
     // Store the bounds
     memcpy( state._lowerBounds, _lowerBounds, sizeof(double) *_n );
@@ -1624,19 +1751,29 @@ void Tableau::storeState( TableauState &state ) const
 
 void Tableau::restoreState( const TableauState &state )
 {
-    freeMemoryIfNeeded();
-    setDimensions( state._m, state._n );
+    /*
+      If the tableau's matrix has not changed since the state was
+      stored, the existing memory is reused and A and b are kept.
+      Otherwise, everything is reallocated and A and b are copied.
+    */
+    if ( !_matrixSnapshot || _matrixSnapshot != state._matrixData )
+    {
+        freeMemoryIfNeeded();
+        setDimensions( state._m, state._n );
 
-    // Restore matrix A
-    state._A->storeIntoOther( _A );
-    for ( unsigned i = 0; i < _n; ++i )
-        state._sparseColumnsOfA[i]->storeIntoOther( _sparseColumnsOfA[i] );
-    for ( unsigned i = 0; i < _m; ++i )
-        state._sparseRowsOfA[i]->storeIntoOther( _sparseRowsOfA[i] );
-    memcpy( _denseA, state._denseA, sizeof(double) * _m * _n );
+        // Restore matrix A
+        const TableauState::MatrixData &matrixData( *state._matrixData );
+        matrixData._A->storeIntoOther( _A );
+        for ( unsigned i = 0; i < _n; ++i )
+            matrixData._sparseColumnsOfA[i]->storeIntoOther( _sparseColumnsOfA[i] );
+        for ( unsigned i = 0; i < _m; ++i )
+            matrixData._sparseRowsOfA[i]->storeIntoOther( _sparseRowsOfA[i] );
 
-    // Restore right hand side vector _b
-    memcpy( _b, state._b, sizeof(double) * _m );
+        // Restore right hand side vector _b
+        memcpy( _b, matrixData._b, sizeof(double) * _m );
+
+        _matrixSnapshot = state._matrixData;
+    }
 
     // Restore the bounds and valid status
     // TODO: should notify all the constraints.
@@ -1761,74 +1898,97 @@ void Tableau::tightenUpperBound( unsigned variable, double value )
 
 unsigned Tableau::addEquation( const Equation &equation )
 {
-    // The fresh auxiliary variable assigned to the equation is _n.
-    // This variable is implicitly added to the equation, with
-    // coefficient 1.
-    unsigned auxVariable = _n;
+    List<unsigned> auxVariables;
+    addEquations( List<Equation>( { equation } ), auxVariables );
+    return auxVariables.back();
+}
 
-    // Adjust the data structures
-    addRow();
+void Tableau::addEquations( const List<Equation> &equations, List<unsigned> &auxVariables )
+{
+    auxVariables.clear();
+    if ( equations.empty() )
+        return;
 
-    // Adjust the constraint matrix
-    _A->addEmptyColumn();
-    std::fill_n( _workN, _n, 0.0 );
-    for ( const auto &addend : equation._addends )
-    {
-        _workN[addend._variable] = addend._coefficient;
-        _sparseColumnsOfA[addend._variable]->set( _m - 1, addend._coefficient );
-        _sparseRowsOfA[_m - 1]->set( addend._variable, addend._coefficient );
-        _denseA[(addend._variable * _m) + _m - 1] = addend._coefficient;
-    }
+    _matrixSnapshot.reset();
 
-    _workN[auxVariable] = 1;
-    _sparseColumnsOfA[auxVariable]->set( _m - 1, 1 );
-    _sparseRowsOfA[_m - 1]->set( auxVariable, 1 );
-    _denseA[(auxVariable * _m) + _m - 1] = 1;
-    _A->addLastRow( _workN );
+    // The fresh auxiliary variable assigned to the i'th equation is _n + i.
+    // This variable is implicitly added to the equation, with
+    // coefficient 1. The equation itself occupies row _m + i.
+    unsigned firstRow = _m;
+    unsigned firstAuxVariable = _n;
 
-    // Invalidate the cost function, so that it is recomputed in the next iteration.
-    _costFunctionManager->invalidateCostFunction();
+    // Adjust the data structures
+    addRows( equations.size() );
 
-    // All variables except the new one have finite bounds. Use this to compute
-    // finite bounds for the new variable.
-    double lb = equation._scalar;
-    double ub = equation._scalar;
+    // Adjust the constraint matrix
+    for ( unsigned i = 0; i < equations.size(); ++i )
+        _A->addEmptyColumn();
 
-    for ( const auto &addend : equation._addends )
+    unsigned row = firstRow;
+    unsigned auxVariable = firstAuxVariable;
+    for ( const auto &equation : equations )
     {
-        double coefficient = addend._coefficient;
-        unsigned variable = addend._variable;
-
-        if ( FloatUtils::isPositive( coefficient ) )
+        std::fill_n( _workN, _n, 0.0 );
+        for ( const auto &addend : equation._addends )
         {
-            lb -= coefficient * _upperBounds[variable];
-            ub -= coefficient * _lowerBounds[variable];
+            _workN[addend._variable] = addend._coefficient;
+            _sparseColumnsOfA[addend._variable]->set( row, addend._coefficient );
+            _sparseRowsOfA[row]->set( addend._variable, addend._coefficient );
         }
-        else
+
+        _workN[auxVariable] = 1;
+        _sparseColumnsOfA[auxVariable]->set( row, 1 );
+        _sparseRowsOfA[row]->set( auxVariable, 1 );
+        _A->addLastRow( _workN );
+
+        // All variables except the new ones have finite bounds. Use this to compute
+        // finite bounds for the new variable.
+        double lb = equation._scalar;
+        double ub = equation._scalar;
+
+        for ( const auto &addend : equation._addends )
         {
-            lb -= coefficient * _lowerBounds[variable];
-            ub -= coefficient * _upperBounds[variable];
+            double coefficient = addend._coefficient;
+            unsigned variable = addend._variable;
+
+            if ( FloatUtils::isPositive( coefficient ) )
+            {
+                lb -= coefficient * _upperBounds[variable];
+                ub -= coefficient * _lowerBounds[variable];
+            }
+            else
+            {
+                lb -= coefficient * _lowerBounds[variable];
+                ub -= coefficient * _upperBounds[variable];
+            }
         }
-    }
 
-    setLowerBound( auxVariable, lb );
-    setUpperBound( auxVariable, ub );
+        setLowerBound( auxVariable, lb );
+        setUpperBound( auxVariable, ub );
 
-    // Populate the new row of b
-    _b[_m - 1] = equation._scalar;
+        // Populate the new row of b
+        _b[row] = equation._scalar;
 
-    if ( !FloatUtils::isZero( _b[_m - 1] ) )
-        _rhsIsAllZeros = false;
-    
-    /*
-      Attempt to make the auxiliary variable the new basic variable.
-      This usually works.
-      If it doesn't, compute a new set of basic variables and re-initialize
-      the tableau (which is more computationally expensive)
-    */
-    _basicIndexToVariable[_m - 1] = auxVariable;
-    _variableToIndex[auxVariable] = _m - 1;
-    _basicVariables.insert( auxVariable );
+        if ( !FloatUtils::isZero( _b[row] ) )
+            _rhsIsAllZeros = false;
+
+        /*
+          Attempt to make the auxiliary variable the new basic variable.
+          This usually works.
+          If it doesn't, compute a new set of basic variables and re-initialize
+          the tableau (which is more computationally expensive)
+        */
+        _basicIndexToVariable[row] = auxVariable;
+        _variableToIndex[auxVariable] = row;
+        _basicVariables.insert( auxVariable );
+
+        auxVariables.append( auxVariable );
+        ++row;
+        ++auxVariable;
+    }
+
+    // Invalidate the cost function, so that it is recomputed in the next iteration.
+    _costFunctionManager->invalidateCostFunction();
 
     // Attempt to refactorize the basis
     bool factorizationSuccessful = true;
@@ -1843,26 +2003,32 @@ unsigned Tableau::addEquation( const Equation &equation )
 
     if ( factorizationSuccessful )
     {
-        // Compute the assignment for the new basic variable
-        _basicAssignment[_m - 1] = equation._scalar;
-        for ( const auto &addend : equation._addends )
+        row = firstRow;
+        for ( const auto &equation : equations )
         {
-            _basicAssignment[_m - 1] -= addend._coefficient * getValue( addend._variable );
-        }
+            // Compute the assignment for the new basic variable
+            _basicAssignment[row] = equation._scalar;
+            for ( const auto &addend : equation._addends )
+            {
+                _basicAssignment[row] -= addend._coefficient * getValue( addend._variable );
+            }
+
+            ASSERT( FloatUtils::wellFormed( _basicAssignment[row] ) );
 
-        ASSERT( FloatUtils::wellFormed( _basicAssignment[_m - 1] ) );
+            if ( FloatUtils::isZero( _basicAssignment[row] ) )
+                _basicAssignment[row] = 0.0;
 
-        if ( FloatUtils::isZero( _basicAssignment[_m - 1] ) )
-            _basicAssignment[_m - 1] = 0.0;
+            // Notify about the new variable's assignment and compute its status
+            notifyVariableValue( _basicIndexToVariable[row], _basicAssignment[row] );
+            computeBasicStatus( row );
 
-        // Notify about the new variable's assignment and compute its status
-        notifyVariableValue( _basicIndexToVariable[_m - 1], _basicAssignment[_m - 1] );
-        computeBasicStatus( _m - 1 );
+            ++row;
+        }
     }
     else
     {
         ConstraintMatrixAnalyzer analyzer;
-        analyzer.analyze( _A, _m, _n );
+        analyzer.analyze( _sparseRowsOfA, _m, _n );
         List<unsigned> independentColumns = analyzer.getIndependentColumns();
 
         try
@@ -1877,151 +2043,112 @@ unsigned Tableau::addEquation( const Equation &equation )
 
         computeCostFunction();
     }
+}
 
-    return auxVariable;
+/*
+  Reallocate an array to a new capacity, keeping its first
+  numEntriesToKeep entries.
+*/
+template<typename T>
+static void reallocateArray( T *&array, unsigned numEntriesToKeep, unsigned newCapacity, const char *name )
+{
+    T *newArray = new T[newCapacity];
+    if ( !newArray )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, name );
+
+    if ( array )
+    {
+        memcpy( newArray, array, sizeof(T) * numEntriesToKeep );
+        delete[] array;
+    }
+
+    array = newArray;
 }
 
-void Tableau::addRow()
+void Tableau::increaseCapacity( unsigned newMCapacity, unsigned newNCapacity )
 {
-    unsigned newM = _m + 1;
-    unsigned newN = _n + 1;
+    ASSERT( newMCapacity >= _mCapacity && newNCapacity >= _nCapacity );
 
     /*
-      This function increases the sizes of the data structures used by
-      the tableau to match newM and newN. Notice that newM = _m + 1 and
-      newN = _n + 1, and so newN - newM = _n - _m. Consequently, structures
-      that are of size _n - _m are left as is.
+      Structures that are of size _n - _m are left as is, as adding
+      rows does not change _n - _m. Work memory does not need to be
+      preserved.
     */
-
-    // Allocate a larger _sparseColumnsOfA, keep old ones
-    SparseUnsortedList **newSparseColumnsOfA = new SparseUnsortedList *[newN];
-    if ( !newSparseColumnsOfA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA" );
-
-    for ( unsigned i = 0; i < _n; ++i )
+    if ( newMCapacity > _mCapacity )
     {
-        newSparseColumnsOfA[i] = _sparseColumnsOfA[i];
-        newSparseColumnsOfA[i]->incrementSize();
+        reallocateArray( _sparseRowsOfA, _m, newMCapacity, "Tableau::newSparseRowsOfA" );
+        reallocateArray( _denseAColumn, 0, newMCapacity, "Tableau::newDenseAColumn" );
+        reallocateArray( _changeColumn, 0, newMCapacity, "Tableau::newChangeColumn" );
+        reallocateArray( _b, _m, newMCapacity, "Tableau::newB" );
+        reallocateArray( _unitVector, 0, newMCapacity, "Tableau::newUnitVector" );
+        reallocateArray( _multipliers, 0, newMCapacity, "Tableau::newMultipliers" );
+        reallocateArray( _basicIndexToVariable, _m, newMCapacity, "Tableau::newBasicIndexToVariable" );
+        reallocateArray( _basicAssignment, _m, newMCapacity, "Tableau::newAssignment" );
+        reallocateArray( _basicStatus, _m, newMCapacity, "Tableau::newBasicStatus" );
+        reallocateArray( _workM, 0, newMCapacity, "Tableau::newWorkM" );
+        reallocateArray( _refinementResidual, 0, newMCapacity, "Tableau::newRefinementResidual" );
+        reallocateArray( _refinementCorrection, 0, newMCapacity, "Tableau::newRefinementCorrection" );
     }
 
-    newSparseColumnsOfA[newN - 1] = new SparseUnsortedList( newM );
-    if ( !newSparseColumnsOfA[newN - 1] )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA[newN-1]" );
+    if ( newNCapacity > _nCapacity )
+    {
+        reallocateArray( _sparseColumnsOfA, _n, newNCapacity, "Tableau::newSparseColumnsOfA" );
+        reallocateArray( _variableToIndex, _n, newNCapacity, "Tableau::newVariableToIndex" );
+        reallocateArray( _lowerBounds, _n, newNCapacity, "Tableau::newLowerBounds" );
+        reallocateArray( _upperBounds, _n, newNCapacity, "Tableau::newUpperBounds" );
+        reallocateArray( _workN, 0, newNCapacity, "Tableau::newWorkN" );
+    }
 
-    delete[] _sparseColumnsOfA;
-    _sparseColumnsOfA = newSparseColumnsOfA;
+    _mCapacity = newMCapacity;
+    _nCapacity = newNCapacity;
+}
 
-    // Allocate a larger _sparseRowsOfA, keep old ones
-    SparseUnsortedList **newSparseRowsOfA = new SparseUnsortedList *[newM];
-    if ( !newSparseRowsOfA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseRowsOfA" );
+void Tableau::addRows( unsigned numRows )
+{
+    unsigned newM = _m + numRows;
+    unsigned newN = _n + numRows;
 
-    for ( unsigned i = 0; i < _m; ++i )
+    // Make room for the new rows, at least doubling the capacity if exceeded
+    if ( newM > _mCapacity || newN > _nCapacity )
     {
-        newSparseRowsOfA[i] = _sparseRowsOfA[i];
-        newSparseRowsOfA[i]->incrementSize();
+        unsigned newMCapacity = ( newM > _mCapacity ) ? std::max( newM, 2 * _mCapacity ) : _mCapacity;
+        unsigned newNCapacity = ( newN > _nCapacity ) ? std::max( newN, 2 * _nCapacity ) : _nCapacity;
+        increaseCapacity( newMCapacity, newNCapacity );
     }
 
-    newSparseRowsOfA[newM - 1] = new SparseUnsortedList( newN );
-    if ( !newSparseRowsOfA[newM - 1] )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseRowsOfA[newN-1]" );
+    // Extend the existing sparse columns and rows, and create the new ones
+    for ( unsigned i = 0; i < _n; ++i )
+    {
+        for ( unsigned j = 0; j < numRows; ++j )
+            _sparseColumnsOfA[i]->incrementSize();
+    }
 
-    delete[] _sparseRowsOfA;
-    _sparseRowsOfA = newSparseRowsOfA;
+    for ( unsigned i = _n; i < newN; ++i )
+    {
+        _sparseColumnsOfA[i] = new SparseUnsortedList( newM );
+        if ( !_sparseColumnsOfA[i] )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseColumnsOfA[i]" );
+    }
 
-    // Allocate a larger _denseA, keep old entries
-    double *newDenseA = new double[newM * newN];
-    if ( !newDenseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newDenseA" );
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        for ( unsigned j = 0; j < numRows; ++j )
+            _sparseRowsOfA[i]->incrementSize();
+    }
 
-    for ( unsigned column = 0; column < _n; ++column )
+    for ( unsigned i = _m; i < newM; ++i )
     {
-        memcpy( newDenseA + ( column * newM ), _denseA + ( column * _m ), sizeof(double) * _m );
-        newDenseA[column*newM + newM - 1] = 0.0;
-    }
-    std::fill_n( newDenseA + ( newN - 1 ) * newM, newM, 0.0 );
-
-    delete[] _denseA;
-    _denseA = newDenseA;
-
-    // Allocate a new changeColumn. Don't need to initialize
-    double *newChangeColumn = new double[newM];
-    if ( !newChangeColumn )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newChangeColumn" );
-    delete[] _changeColumn;
-    _changeColumn = newChangeColumn;
-
-    // Allocate a new b and copy the old values
-    double *newB = new double[newM];
-    if ( !newB )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newB" );
-    std::fill( newB + _m, newB + newM, 0.0 );
-    memcpy( newB, _b, _m * sizeof(double) );
-    delete[] _b;
-    _b = newB;
-
-    // Allocate a new unit vector. Don't need to initialize
-    double *newUnitVector = new double[newM];
-    if ( !newUnitVector )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newUnitVector" );
-    delete[] _unitVector;
-    _unitVector = newUnitVector;
-
-    // Allocate new multipliers. Don't need to initialize
-    double *newMultipliers = new double[newM];
-    if ( !newMultipliers )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newMultipliers" );
-    delete[] _multipliers;
-    _multipliers = newMultipliers;
-
-    // Allocate new index arrays. Copy old indices, but don't assign indices to new variables yet.
-    unsigned *newBasicIndexToVariable = new unsigned[newM];
-    if ( !newBasicIndexToVariable )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newBasicIndexToVariable" );
-    memcpy( newBasicIndexToVariable, _basicIndexToVariable, _m * sizeof(unsigned) );
-    delete[] _basicIndexToVariable;
-    _basicIndexToVariable = newBasicIndexToVariable;
-
-    unsigned *newVariableToIndex = new unsigned[newN];
-    if ( !newVariableToIndex )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newVariableToIndex" );
-    memcpy( newVariableToIndex, _variableToIndex, _n * sizeof(unsigned) );
-    delete[] _variableToIndex;
-    _variableToIndex = newVariableToIndex;
-
-    // Allocate a new basic assignment vector, copy old values
-    double *newBasicAssignment = new double[newM];
-    if ( !newBasicAssignment )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newAssignment" );
-    memcpy( newBasicAssignment, _basicAssignment, sizeof(double) * _m );
-    delete[] _basicAssignment;
-    _basicAssignment = newBasicAssignment;
-
-    unsigned *newBasicStatus = new unsigned[newM];
-    if ( !newBasicStatus )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newBasicStatus" );
-    memcpy( newBasicStatus, _basicStatus, sizeof(unsigned) * _m );
-    delete[] _basicStatus;
-    _basicStatus = newBasicStatus;
-
-    // Allocate new lower and upper bound arrays, and copy old values
-    double *newLowerBounds = new double[newN];
-    if ( !newLowerBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newLowerBounds" );
-    memcpy( newLowerBounds, _lowerBounds, _n * sizeof(double) );
-    delete[] _lowerBounds;
-    _lowerBounds = newLowerBounds;
-
-    double *newUpperBounds = new double[newN];
-    if ( !newUpperBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newUpperBounds" );
-    memcpy( newUpperBounds, _upperBounds, _n * sizeof(double) );
-    delete[] _upperBounds;
-    _upperBounds = newUpperBounds;
-
-    // Mark the new variable as unbounded
-    _lowerBounds[_n] = FloatUtils::negativeInfinity();
-    _upperBounds[_n] = FloatUtils::infinity();
+        _sparseRowsOfA[i] = new SparseUnsortedList( newN );
+        if ( !_sparseRowsOfA[i] )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newSparseRowsOfA[i]" );
+    }
+
+    // The new entries of _b are zero
+    std::fill( _b + _m, _b + newM, 0.0 );
+
+    // Mark the new variables as unbounded
+    std::fill( _lowerBounds + _n, _lowerBounds + newN, FloatUtils::negativeInfinity() );
+    std::fill( _upperBounds + _n, _upperBounds + newN, FloatUtils::infinity() );
 
     // Allocate a larger basis factorization
     IBasisFactorization *newBasisFactorization =
@@ -2032,19 +2159,6 @@ void Tableau::addRow()
     _basisFactorization = newBasisFactorization;
     _basisFactorization->setStatistics( _statistics );
 
-    // Allocate a larger _workM and _workN. Don't need to initialize.
-    double *newWorkM = new double[newM];
-    if ( !newWorkM )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newWorkM" );
-    delete[] _workM;
-    _workM = newWorkM;
-
-    double *newWorkN = new double[newN];
-    if ( !newWorkN )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newWorkN" );
-    delete[] _workN;
-    _workN = newWorkN;
-
     _m = newM;
     _n = newN;
     _costFunctionManager->initialize();
@@ -2054,7 +2168,8 @@ void Tableau::addRow()
 
     if ( _statistics )
     {
-        _statistics->incNumAddedRows();
+        for ( unsigned i = 0; i < numRows; ++i )
+            _statistics->incNumAddedRows();
         _statistics->setCurrentTableauDimension( _m, _n );
     }
 }
@@ -2499,6 +2614,7 @@ void Tableau::mergeColumns( unsigned x1, unsigned x2 )
       Merge column x2 of the constraint matrix into x1
       and zero-out column x2
     */
+    _matrixSnapshot.reset();
     _A->mergeColumns( x1, x2 );
     _mergedVariables[x2] = x1;
 
@@ -2509,11 +2625,6 @@ void Tableau::mergeColumns( unsigned x1, unsigned x2 )
     for ( unsigned i = 0; i < _m; ++i )
         _sparseRowsOfA[i]->mergeEntries( x2, x1 );
 
-    // And the dense ones, too
-    for ( unsigned i = 0; i < _m; ++i )
-        _denseA[x1*_m + i] += _denseA[x2*_m + i];
-    std::fill_n( _denseA + x2 * _m, _m, 0 );
-
     computeAssignment();
     computeCostFunction();
 
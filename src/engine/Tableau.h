@@ -25,11 +25,11 @@
 #include "SparseMatrix.h"
 #include "SparseUnsortedList.h"
 #include "Statistics.h"
+#include "TableauState.h"
 
 class Equation;
 class ICostFunctionManager;
 class PiecewiseLinearCaseSplit;
-class TableauState;
 
 class Tableau : public ITableau, public IBasisFactorization::BasisColumnOracle
 {
@@ -45,9 +45,11 @@ public:
     void setDimensions( unsigned m, unsigned n );
 
     /*
-      Initialize the constraint matrix
+      Initialize the constraint matrix, given either in dense
+      (row-major) form or as m sparse rows
     */
     void setConstraintMatrix( const double *A );
+    void setConstraintMatrix( const SparseUnsortedList * const *rows );
 
     /*
       Set which variable will enter the basis. The input is the
@@ -102,10 +104,21 @@ public:
     unsigned addEquation( const Equation &equation );
 
     /*
-      Get the Tableau's dimensions.
+      Add several equations at once. This is cheaper than adding them
+      one by one, as the data structures are resized and the basis is
+      refactorized only once. The fresh auxiliary variables are
+      returned in the order of the equations.
+    */
+    void addEquations( const List<Equation> &equations, List<unsigned> &auxVariables );
+
+    /*
+      Get the Tableau's dimensions, and the dimensions up to which it
+      can grow without reallocating memory.
     */
     unsigned getM() const;
     unsigned getN() const;
+    unsigned getMCapacity() const;
+    unsigned getNCapacity() const;
 
     /*
       Get the assignment of a variable, either basic or non-basic
@@ -190,6 +203,15 @@ public:
     */
     void computeAssignment();
 
+    /*
+      Compute the basic assignment from scratch using a fresh
+      factorization of the basis, and then improve it with the given
+      number of iterative refinement steps. In each step the residual
+      b - Ax is accumulated in extended precision, and the correction
+      d that solves Bd = b - Ax is added to the basic assignment.
+    */
+    void computeRefinedAssignment( unsigned refinementSteps );
+
     /*
       Check whether a given value falls within a variable's bounds,
       i.e. lowerBound <= value <= upperBound.
@@ -320,8 +342,9 @@ public:
     void getTableauRow( unsigned index, TableauRow *row );
 
     /*
-      Get the original constraint matrix A or a column thereof,
-      in dense form.
+      Get the original constraint matrix A or a column thereof. The
+      dense column is materialized from the sparse one into a work
+      buffer, and remains valid until the next call.
     */
     const SparseMatrix *getSparseA() const;
     const double *getAColumn( unsigned variable ) const;
@@ -335,7 +358,8 @@ public:
       and backtracking. The stored elements are the current:
 
       - Tableau dimensions
-      - The current matrix A
+      - The current matrix A and right hand side b, which are
+        shared between states as long as they remain unchanged
       - Lower and upper bounds
       - Basic variables
       - Basic and non-basic assignments
@@ -462,15 +486,32 @@ private:
     unsigned _n;
     unsigned _m;
 
+    /*
+      The dimensions for which the data structures are allocated. When
+      rows are added beyond the capacity, it is doubled, so that adding
+      rows one at a time takes amortized constant time per row.
+    */
+    unsigned _nCapacity;
+    unsigned _mCapacity;
+
     /*
       The constraint matrix A, and a collection of its
-      sparse columns. The matrix is also stored in dense
-      form (column-major).
+      sparse columns and rows.
     */
     SparseMatrix *_A;
     SparseUnsortedList **_sparseColumnsOfA;
     SparseUnsortedList **_sparseRowsOfA;
-    double *_denseA;
+
+    /*
+      Work memory for handing out dense columns of A
+    */
+    mutable double *_denseAColumn;
+
+    /*
+      An immutable copy of A and b, shared by the states stored since
+      the matrix last changed. Reset whenever A or b is modified.
+    */
+    mutable std::shared_ptr<const TableauState::MatrixData> _matrixSnapshot;
 
     /*
       Used to compute inv(B)*a
@@ -493,6 +534,13 @@ private:
     double *_workM;
     double *_workN;
 
+    /*
+      Working memory for refining the basic assignment (of size m):
+      the residual, in extended precision, and the correction.
+    */
+    long double *_refinementResidual;
+    double *_refinementCorrection;
+
     /*
       A unit vector of size m
     */
@@ -609,9 +657,27 @@ private:
     void freeMemoryIfNeeded();
 
     /*
-      Resize the relevant data structures to add a new row to the tableau.
+      Helpers for computing the basic assignment: compute it into
+      _basicAssignment, perform a single step of iterative refinement,
+      and update the basic status and inform the watchers once the
+      assignment is final.
+    */
+    void computeBasicAssignment();
+    void refineBasicAssignment();
+    void finalizeBasicAssignment();
+
+    /*
+      Resize the relevant data structures to add new rows to the
+      tableau, each with a fresh auxiliary variable.
+    */
+    void addRows( unsigned numRows );
+
+    /*
+      Reallocate the m- and n-sized data structures, to allow the
+      tableau to grow up to the given dimensions without further
+      reallocations.
     */
-    void addRow();
+    void increaseCapacity( unsigned newMCapacity, unsigned newNCapacity );
 
     /*
       Update the variable assignment to reflect a pivot operation,
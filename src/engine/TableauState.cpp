@@ -19,24 +19,46 @@
 #include "SparseUnsortedList.h"
 #include "TableauState.h"
 
-TableauState::TableauState()
-    : _A( NULL )
+TableauState::MatrixData::MatrixData( unsigned m, unsigned n )
+    : _m( m )
+    , _n( n )
+    , _A( NULL )
     , _sparseColumnsOfA( NULL )
     , _sparseRowsOfA( NULL )
-    , _denseA( NULL )
     , _b( NULL )
-    , _lowerBounds( NULL )
-    , _upperBounds( NULL )
-    , _basicAssignment( NULL )
-    , _nonBasicAssignment( NULL )
-    , _basicIndexToVariable( NULL )
-    , _nonBasicIndexToVariable( NULL )
-    , _variableToIndex( NULL )
-    , _basisFactorization( NULL )
 {
+    _A = new CSRMatrix();
+    if ( !_A )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::A" );
+
+    _sparseColumnsOfA = new SparseUnsortedList *[n];
+    if ( !_sparseColumnsOfA )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseColumnsOfA" );
+
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        _sparseColumnsOfA[i] = new SparseUnsortedList;
+        if ( !_sparseColumnsOfA[i] )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseColumnsOfA[i]" );
+    }
+
+    _sparseRowsOfA = new SparseUnsortedList *[m];
+    if ( !_sparseRowsOfA )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseRowsOfA" );
+
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        _sparseRowsOfA[i] = new SparseUnsortedList;
+        if ( !_sparseRowsOfA[i] )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseRowsOfA[i]" );
+    }
+
+    _b = new double[m];
+    if ( !_b )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::b" );
 }
 
-TableauState::~TableauState()
+TableauState::MatrixData::~MatrixData()
 {
     if ( _A )
     {
@@ -74,59 +96,51 @@ TableauState::~TableauState()
         _sparseRowsOfA = NULL;
     }
 
-    if ( _denseA )
-    {
-        delete[] _denseA;
-        _denseA = NULL;
-    }
-
     if ( _b )
     {
         delete[] _b;
         _b = NULL;
     }
+}
 
-    if ( _lowerBounds )
-    {
-        delete[] _lowerBounds;
-        _lowerBounds = NULL;
-    }
-
-    if ( _upperBounds )
-    {
-        delete[] _upperBounds;
-        _upperBounds = NULL;
-    }
-
-    if ( _basicAssignment )
-    {
-        delete[] _basicAssignment;
-        _basicAssignment = NULL;
-    }
-
-    if ( _nonBasicAssignment )
-    {
-        delete[] _nonBasicAssignment;
-        _nonBasicAssignment = NULL;
-    }
+TableauState::TableauState()
+    : _m( 0 )
+    , _n( 0 )
+    , _lowerBounds( NULL )
+    , _upperBounds( NULL )
+    , _basicAssignment( NULL )
+    , _nonBasicAssignment( NULL )
+    , _basicIndexToVariable( NULL )
+    , _nonBasicIndexToVariable( NULL )
+    , _variableToIndex( NULL )
+    , _basisFactorization( NULL )
+    , _storage( NULL )
+    , _storageSize( 0 )
+    , _oracle( NULL )
+{
+}
 
-    if ( _basicIndexToVariable )
-    {
-        delete[] _basicIndexToVariable;
-        _basicIndexToVariable = NULL;
-    }
+TableauState::~TableauState()
+{
+    freeMemoryIfNeeded();
+}
 
-    if ( _nonBasicIndexToVariable )
+void TableauState::freeMemoryIfNeeded()
+{
+    if ( _storage )
     {
-        delete[] _nonBasicIndexToVariable;
-        _nonBasicIndexToVariable = NULL;
+        delete[] _storage;
+        _storage = NULL;
+        _storageSize = 0;
     }
 
-    if ( _variableToIndex )
-    {
-        delete[] _variableToIndex;
-        _variableToIndex = NULL;
-    }
+    _lowerBounds = NULL;
+    _upperBounds = NULL;
+    _basicAssignment = NULL;
+    _nonBasicAssignment = NULL;
+    _basicIndexToVariable = NULL;
+    _nonBasicIndexToVariable = NULL;
+    _variableToIndex = NULL;
 
     if ( _basisFactorization )
     {
@@ -137,76 +151,48 @@ TableauState::~TableauState()
 
 void TableauState::setDimensions( unsigned m, unsigned n, const IBasisFactorization::BasisColumnOracle &oracle )
 {
-    _m = m;
-    _n = n;
-
-    _A = new CSRMatrix();
-    if ( !_A )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::A" );
-
-    _sparseColumnsOfA = new SparseUnsortedList *[n];
-    if ( !_sparseColumnsOfA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseColumnsOfA" );
-
-    for ( unsigned i = 0; i < n; ++i )
-    {
-        _sparseColumnsOfA[i] = new SparseUnsortedList;
-        if ( !_sparseColumnsOfA[i] )
-            throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseColumnsOfA[i]" );
-    }
+    // A state stored again with the same dimensions keeps its memory
+    if ( _storage && m == _m && n == _n && &oracle == _oracle )
+        return;
 
-    _sparseRowsOfA = new SparseUnsortedList *[m];
-    if ( !_sparseRowsOfA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseRowsOfA" );
+    freeMemoryIfNeeded();
 
-    for ( unsigned i = 0; i < m; ++i )
-    {
-        _sparseRowsOfA[i] = new SparseUnsortedList;
-        if ( !_sparseRowsOfA[i] )
-            throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseRowsOfA[i]" );
-    }
-
-    _denseA = new double[m*n];
-    if ( !_denseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::denseA" );
-
-    _b = new double[m];
-    if ( !_b )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::b" );
-
-    _lowerBounds = new double[n];
-    if ( !_lowerBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::lowerBounds" );
-
-    _upperBounds = new double[n];
-    if ( !_upperBounds )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::upperBounds" );
-
-    _basicAssignment = new double[m];
-    if ( !_basicAssignment )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::assignment" );
-
-    _nonBasicAssignment = new double[n-m];
-    if ( !_nonBasicAssignment )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::nonBasicAssignment" );
-
-    _basicIndexToVariable = new unsigned[m];
-    if ( !_basicIndexToVariable )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::basicIndexToVariable" );
-
-    _nonBasicIndexToVariable = new unsigned[n-m];
-    if ( !_nonBasicIndexToVariable )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::nonBasicIndexToVariable" );
-
-    _variableToIndex = new unsigned[n];
-    if ( !_variableToIndex )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::variableToIndex" );
+    _m = m;
+    _n = n;
+    _oracle = &oracle;
+
+    /*
+      The block holds the arrays of doubles (lower and upper bounds,
+      basic and non-basic assignments, 3n entries in total), followed
+      by the arrays of indices (basic, non-basic and variable-to-index
+      mappings, 2n entries in total).
+    */
+    _storageSize = sizeof(double) * 3 * n + sizeof(unsigned) * 2 * n;
+    _storage = new char[_storageSize];
+    if ( !_storage )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::storage" );
+
+    double *doubles = (double *)_storage;
+    _lowerBounds = doubles;
+    _upperBounds = doubles + n;
+    _basicAssignment = doubles + 2 * n;
+    _nonBasicAssignment = doubles + 2 * n + m;
+
+    unsigned *indices = (unsigned *)( doubles + 3 * n );
+    _basicIndexToVariable = indices;
+    _nonBasicIndexToVariable = indices + m;
+    _variableToIndex = indices + n;
 
     _basisFactorization = BasisFactorizationFactory::createBasisFactorization( m, oracle );
     if ( !_basisFactorization )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::basisFactorization" );
 }
 
+unsigned long long TableauState::getStorageSize() const
+{
+    return _storageSize;
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
@@ -22,14 +22,15 @@
 #include "Set.h"
 #include "SparseMatrix.h"
 
+#include <memory>
+
 class TableauState
 {
     /*
       A Tableu state includes the following elements:
 
       - Tableau dimensions
-      - The matrix A
-      - The right hand side vector b
+      - The matrix A and the right hand side vector b (shared)
       - Lower and upper bounds
       - Basic variables
       - Basic and non-basic assignments
@@ -41,26 +42,49 @@ public:
     TableauState();
     ~TableauState();
 
+    /*
+      Allocate the state's arrays for the given dimensions. The arrays
+      are carved out of a single block, which is kept if the state is
+      stored again with the same dimensions.
+    */
     void setDimensions( unsigned m, unsigned n, const IBasisFactorization::BasisColumnOracle &oracle );
 
     /*
-      The dimensions of matrix A
+      The number of bytes in the block that holds the state's arrays
     */
-    unsigned _m;
-    unsigned _n;
+    unsigned long long getStorageSize() const;
 
     /*
-      The matrix
+      The matrix A, in its various forms, and the right hand side b.
+      These only change when equations are added or columns are
+      merged, so a block is never modified once created: it is shared
+      by all the states stored while the tableau's matrix remained
+      the same, and a new block is created only after it changes.
     */
-    SparseMatrix *_A;
-    SparseUnsortedList **_sparseColumnsOfA;
-    SparseUnsortedList **_sparseRowsOfA;
-    double *_denseA;
+    struct MatrixData
+    {
+        MatrixData( unsigned m, unsigned n );
+        ~MatrixData();
+
+        unsigned _m;
+        unsigned _n;
+
+        SparseMatrix *_A;
+        SparseUnsortedList **_sparseColumnsOfA;
+        SparseUnsortedList **_sparseRowsOfA;
+        double *_b;
+    };
 
     /*
-      The right hand side
+      The dimensions of matrix A
     */
-    double *_b;
+    unsigned _m;
+    unsigned _n;
+
+    /*
+      The matrix and the right hand side
+    */
+    std::shared_ptr<const MatrixData> _matrixData;
 
     /*
       Upper and lower bounds for all variables
@@ -119,6 +143,20 @@ public:
       extracting a solution for x, we should read the value of y.
      */
     Map<unsigned, unsigned> _mergedVariables;
+
+private:
+    /*
+      The block holding the bounds, assignment and index arrays
+    */
+    char *_storage;
+    unsigned long long _storageSize;
+
+    /*
+      The oracle that the stored basis factorization was created with
+    */
+    const IBasisFactorization::BasisColumnOracle *_oracle;
+
+    void freeMemoryIfNeeded();
 };
 
 #endif // __TableauState_h__
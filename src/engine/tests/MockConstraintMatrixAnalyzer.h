@@ -55,6 +55,10 @@ public:
     {
     }
 
+    void analyze( const SparseUnsortedList * const */* rows */, unsigned /* m */, unsigned /* n */ )
+    {
+    }
+
     unsigned getRank() const
     {
         return 0;
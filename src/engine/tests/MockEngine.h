@@ -29,6 +29,9 @@ public:
         wasDiscarded = false;
 
         lastStoredState = NULL;
+        lastSplitDonationReceiver = NULL;
+        numWarmStartsExtracted = 0;
+        numWarmStartsApplied = 0;
     }
 
     ~MockEngine()
@@ -68,7 +71,7 @@ public:
     List<Equation> lastEquations;
     void applySplit( const PiecewiseLinearCaseSplit &split )
     {
-        List<Tightening> bounds = split.getBoundTightenings();
+        const Vector<Tightening> &bounds = split.getBoundTightenings();
         auto equations = split.getEquations();
         for ( auto &it : equations )
         {
@@ -88,6 +91,29 @@ public:
         }
     }
 
+    void applySubQuerySplit( const PiecewiseLinearCaseSplit &split )
+    {
+        applySplit( split );
+    }
+
+    mutable unsigned numWarmStartsExtracted;
+    void extractWarmStart( SubQueryWarmStart &/* warmStart */ ) const
+    {
+        ++numWarmStartsExtracted;
+    }
+
+    unsigned numWarmStartsApplied;
+    void applyWarmStart( const SubQueryWarmStart &/* warmStart */ )
+    {
+        ++numWarmStartsApplied;
+    }
+
+    SplitDonationReceiver *lastSplitDonationReceiver;
+    void setSplitDonationReceiver( SplitDonationReceiver *receiver )
+    {
+        lastSplitDonationReceiver = receiver;
+    }
+
     mutable EngineState *lastStoredState;
     void storeState( EngineState &state, bool /* storeAlsoTableauState */ ) const
     {
@@ -104,10 +130,21 @@ public:
     {
     }
 
+    void restorePlConstraintActivity( const EngineState &/* state */ )
+    {
+    }
+
     unsigned _timeToSolve;
     IEngine::ExitCode _exitCode;
+    List<PiecewiseLinearCaseSplit> splitsToDonate;
     bool solve( unsigned timeoutInSeconds )
     {
+        for ( const auto &split : splitsToDonate )
+        {
+            if ( lastSplitDonationReceiver && lastSplitDonationReceiver->wantsSplit() )
+                lastSplitDonationReceiver->receiveSplit( split );
+        }
+
         if ( timeoutInSeconds >= _timeToSolve )
             _exitCode = IEngine::TIMEOUT;
         return _exitCode == IEngine::SAT;
@@ -135,6 +135,13 @@ public:
         memcpy( lastEntries, A, sizeof(double) * lastM * lastN );
     }
 
+    void setConstraintMatrix( const SparseUnsortedList * const *rows )
+    {
+        TS_ASSERT( setDimensionsCalled );
+        for ( unsigned i = 0; i < lastM; ++i )
+            rows[i]->toDense( lastEntries + ( i * lastN ) );
+    }
+
     double *lastRightHandSide;
     void setRightHandSide( const double * b )
     {
@@ -351,6 +358,7 @@ public:
     }
 
     void computeAssignment() {}
+    void computeRefinedAssignment( unsigned /* refinementSteps */ ) {}
     bool checkValueWithinBounds( unsigned variable, double value ){
         return FloatUtils::gte( value, getLowerBound( variable ) ) && FloatUtils::lte( value, getUpperBound( variable ) );
     }
@@ -385,6 +393,13 @@ public:
         return nextAuxVar;
     }
 
+    void addEquations( const List<Equation> &equations, List<unsigned> &auxVariables )
+    {
+        auxVariables.clear();
+        for ( unsigned i = 0; i < equations.size(); ++i )
+            auxVariables.append( nextAuxVar + i );
+    }
+
     unsigned getM() const
     {
         return lastM;
@@ -395,6 +410,16 @@ public:
         return lastN;
     }
 
+    unsigned getMCapacity() const
+    {
+        return lastM;
+    }
+
+    unsigned getNCapacity() const
+    {
+        return lastN;
+    }
+
     unsigned lastGetRowIndex;
     TableauRow *nextRow;
     void getTableauRow( unsigned index, TableauRow *row )
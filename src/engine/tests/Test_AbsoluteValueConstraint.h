@@ -0,0 +1,271 @@
+/*********************                                                        */
+/*! \file Test_AbsoluteValueConstraint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "AbsoluteValueConstraint.h"
+#include "InputQuery.h"
+#include "MarabouError.h"
+#include "MockErrno.h"
+#include "MockTableau.h"
+#include "PiecewiseLinearCaseSplit.h"
+
+class MockForAbsoluteValueConstraint
+    : public MockErrno
+{
+public:
+};
+
+class AbsoluteValueConstraintTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForAbsoluteValueConstraint *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForAbsoluteValueConstraint );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_satisfied()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        AbsoluteValueConstraint abs( b, f );
+
+        TS_ASSERT( abs.participatingVariable( b ) );
+        TS_ASSERT( abs.participatingVariable( f ) );
+        TS_ASSERT( !abs.participatingVariable( 2 ) );
+
+        TS_ASSERT_THROWS_EQUALS( abs.satisfied(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::PARTICIPATING_VARIABLES_ABSENT );
+
+        abs.notifyVariableValue( b, 3 );
+        abs.notifyVariableValue( f, 3 );
+        TS_ASSERT( abs.satisfied() );
+
+        abs.notifyVariableValue( b, -3 );
+        TS_ASSERT( abs.satisfied() );
+
+        abs.notifyVariableValue( f, 2 );
+        TS_ASSERT( !abs.satisfied() );
+
+        abs.notifyVariableValue( b, 0 );
+        abs.notifyVariableValue( f, 0 );
+        TS_ASSERT( abs.satisfied() );
+    }
+
+    void test_case_splits()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        AbsoluteValueConstraint abs( b, f );
+
+        // A negative assignment to b puts the negative phase first
+        abs.notifyVariableValue( b, -2 );
+        abs.notifyVariableValue( f, 1 );
+
+        List<PiecewiseLinearCaseSplit> splits = abs.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+
+        PiecewiseLinearCaseSplit negative = splits.front();
+        PiecewiseLinearCaseSplit positive = splits.back();
+
+        TS_ASSERT_EQUALS( negative.getBoundTightenings().size(), 1U );
+        TS_ASSERT_EQUALS( negative.getBoundTightenings().first(), Tightening( b, 0, Tightening::UB ) );
+        TS_ASSERT_EQUALS( negative.getEquations().size(), 1U );
+
+        Equation negativeEquation = negative.getEquations().front();
+        auto addend = negativeEquation._addends.begin();
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( 1, b ) );
+        ++addend;
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( 1, f ) );
+        TS_ASSERT_EQUALS( negativeEquation._scalar, 0 );
+
+        TS_ASSERT_EQUALS( positive.getBoundTightenings().size(), 1U );
+        TS_ASSERT_EQUALS( positive.getBoundTightenings().first(), Tightening( b, 0, Tightening::LB ) );
+        TS_ASSERT_EQUALS( positive.getEquations().size(), 1U );
+
+        Equation positiveEquation = positive.getEquations().front();
+        addend = positiveEquation._addends.begin();
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( 1, b ) );
+        ++addend;
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( -1, f ) );
+    }
+
+    void test_phase_fixing()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        AbsoluteValueConstraint abs( b, f );
+
+        abs.notifyLowerBound( b, -5 );
+        abs.notifyUpperBound( b, 5 );
+        abs.notifyLowerBound( f, 0 );
+        abs.notifyUpperBound( f, 5 );
+        TS_ASSERT( !abs.phaseFixed() );
+
+        // f >= 2 and b >= -1 rule out the negative phase
+        abs.notifyLowerBound( f, 2 );
+        TS_ASSERT( !abs.phaseFixed() );
+        abs.notifyLowerBound( b, -1 );
+        TS_ASSERT( abs.phaseFixed() );
+        TS_ASSERT_EQUALS( abs.getPhaseStatus(), AbsoluteValueConstraint::PHASE_POSITIVE );
+
+        TS_ASSERT_THROWS_EQUALS( abs.getCaseSplits(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
+
+        AbsoluteValueConstraint abs2( b, f );
+        abs2.notifyLowerBound( b, -5 );
+        abs2.notifyUpperBound( b, -1 );
+        TS_ASSERT( abs2.phaseFixed() );
+        TS_ASSERT_EQUALS( abs2.getPhaseStatus(), AbsoluteValueConstraint::PHASE_NEGATIVE );
+    }
+
+    void test_entailed_tightenings()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        AbsoluteValueConstraint abs( b, f );
+
+        abs.notifyLowerBound( b, -3 );
+        abs.notifyUpperBound( b, 7 );
+        abs.notifyLowerBound( f, 0 );
+        abs.notifyUpperBound( f, 5 );
+
+        List<Tightening> tightenings;
+        abs.getEntailedTightenings( tightenings );
+
+        TS_ASSERT_EQUALS( tightenings.size(), 4U );
+        TS_ASSERT( tightenings.exists( Tightening( f, 0, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, -5, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, 5, Tightening::UB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( f, 7, Tightening::UB ) ) );
+
+        // Negative phase: bounds are negated between b and f
+        abs.notifyUpperBound( b, -1 );
+        TS_ASSERT_EQUALS( abs.getPhaseStatus(), AbsoluteValueConstraint::PHASE_NEGATIVE );
+
+        tightenings.clear();
+        abs.getEntailedTightenings( tightenings );
+
+        TS_ASSERT( tightenings.exists( Tightening( b, 0, Tightening::UB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, -5, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, 0, Tightening::UB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( f, 1, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( f, 3, Tightening::UB ) ) );
+    }
+
+    void test_eliminate_f()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        AbsoluteValueConstraint abs( b, f );
+        abs.notifyLowerBound( b, -5 );
+        abs.notifyUpperBound( b, 5 );
+
+        abs.eliminateVariable( f, 3 );
+        TS_ASSERT( !abs.constraintObsolete() );
+        TS_ASSERT_EQUALS( abs.getParticipatingVariables(), List<unsigned>( { b } ) );
+
+        // Each split fixes b to 3 or -3
+        List<PiecewiseLinearCaseSplit> splits = abs.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+        for ( const auto &split : splits )
+        {
+            TS_ASSERT( split.getEquations().empty() );
+            TS_ASSERT_EQUALS( split.getBoundTightenings().size(), 2U );
+        }
+
+        TS_ASSERT( splits.front().getBoundTightenings().exists( Tightening( b, 3, Tightening::LB ) ) );
+        TS_ASSERT( splits.back().getBoundTightenings().exists( Tightening( b, -3, Tightening::UB ) ) );
+
+        abs.notifyVariableValue( b, -3 );
+        TS_ASSERT( abs.satisfied() );
+
+        // Eliminating b makes the constraint obsolete
+        AbsoluteValueConstraint abs2( b, f );
+        abs2.eliminateVariable( b, -2 );
+        TS_ASSERT( abs2.constraintObsolete() );
+    }
+
+    void test_add_auxiliary_equations()
+    {
+        AbsoluteValueConstraint abs( 4, 6 );
+        InputQuery query;
+        query.setNumberOfVariables( 9 );
+
+        TS_ASSERT_THROWS_NOTHING( abs.addAuxiliaryEquations( query ) );
+
+        TS_ASSERT_EQUALS( query.getNumberOfVariables(), 11U );
+        TS_ASSERT_EQUALS( query.getEquations().size(), 2U );
+        TS_ASSERT_EQUALS( query.getLowerBound( 9 ), 0 );
+        TS_ASSERT_EQUALS( query.getLowerBound( 10 ), 0 );
+    }
+
+    void test_serialize_and_unserialize()
+    {
+        AbsoluteValueConstraint original( 3, 8 );
+        String serialized = original.serializeToString();
+        TS_ASSERT_EQUALS( serialized, "abs,8,3" );
+
+        AbsoluteValueConstraint recovered( serialized );
+        TS_ASSERT_EQUALS( recovered.getB(), 3U );
+        TS_ASSERT_EQUALS( recovered.getF(), 8U );
+        TS_ASSERT_EQUALS( recovered.serializeToString(), serialized );
+    }
+
+    void test_duplicate_and_restore()
+    {
+        AbsoluteValueConstraint *abs = new AbsoluteValueConstraint( 1, 4 );
+        abs->setActiveConstraint( false );
+        abs->notifyVariableValue( 1, -2 );
+        abs->notifyVariableValue( 4, 2 );
+
+        PiecewiseLinearConstraint *clone = abs->duplicateConstraint();
+        TS_ASSERT( clone->satisfied() );
+        TS_ASSERT( !clone->isActive() );
+
+        abs->notifyVariableValue( 4, 5 );
+        TS_ASSERT( !abs->satisfied() );
+
+        abs->restoreState( clone );
+        TS_ASSERT( abs->satisfied() );
+
+        delete clone;
+        delete abs;
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -16,7 +16,9 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "CSRMatrix.h"
 #include "ConstraintMatrixAnalyzer.h"
+#include "SparseUnsortedList.h"
 
 #include <string.h>
 #include <cstdio>
@@ -294,6 +296,114 @@ public:
             TS_ASSERT_THROWS_NOTHING( delete analyzer );
         }
     }
+
+    void test_sparse_analysis()
+    {
+        double A[] = {
+            1, 2, 0, 0, 1,
+            0, 1, 1, 0, 0,
+            1, 3, 1, 0, 1,
+            0, 0, 0, 4, 0,
+        };
+
+        SparseUnsortedList *rows[4];
+        for ( unsigned i = 0; i < 4; ++i )
+            rows[i] = new SparseUnsortedList( A + ( i * 5 ), 5 );
+
+        ConstraintMatrixAnalyzer analyzer;
+        TS_ASSERT_THROWS_NOTHING( analyzer.analyze( rows, 4, 5 ) );
+
+        TS_ASSERT_EQUALS( analyzer.getRank(), 3U );
+
+        Set<unsigned> redundantRows = analyzer.getRedundantRows();
+        TS_ASSERT_EQUALS( redundantRows.size(), 1U );
+        TS_ASSERT( redundantRows.exists( 2 ) );
+
+        List<unsigned> columns = analyzer.getIndependentColumns();
+        TS_ASSERT_EQUALS( columns.size(), 3U );
+        TS_ASSERT( columns.exists( 3 ) );
+
+        // The same result is obtained through the SparseMatrix interface
+        CSRMatrix matrix( A, 4, 5 );
+        ConstraintMatrixAnalyzer other;
+        TS_ASSERT_THROWS_NOTHING( other.analyze( &matrix, 4, 5 ) );
+        TS_ASSERT_EQUALS( other.getRank(), 3U );
+        TS_ASSERT_EQUALS( other.getRedundantRows(), redundantRows );
+        TS_ASSERT_EQUALS( other.getIndependentColumns(), columns );
+
+        for ( unsigned i = 0; i < 4; ++i )
+            delete rows[i];
+    }
+
+    void test_sparse_analysis_matches_dense()
+    {
+        srand( 1 );
+
+        const unsigned m = 30;
+        const unsigned n = 50;
+        double A[m * n];
+        double B[m * m];
+
+        for ( unsigned round = 0; round < 10; ++round )
+        {
+            // Sparse random rows, some of which are combinations of others
+            std::fill_n( A, m * n, 0.0 );
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                if ( i > 2 && rand() % 4 == 0 )
+                {
+                    unsigned first = rand() % i;
+                    unsigned second = rand() % i;
+                    for ( unsigned j = 0; j < n; ++j )
+                        A[i * n + j] = A[first * n + j] - 2 * A[second * n + j];
+                    continue;
+                }
+
+                for ( unsigned k = 0; k < 4; ++k )
+                    A[i * n + ( rand() % n )] = ( rand() % 9 ) - 4;
+            }
+
+            SparseUnsortedList *rows[m];
+            for ( unsigned i = 0; i < m; ++i )
+                rows[i] = new SparseUnsortedList( A + ( i * n ), n );
+
+            ConstraintMatrixAnalyzer sparse;
+            ConstraintMatrixAnalyzer dense;
+            TS_ASSERT_THROWS_NOTHING( sparse.analyze( rows, m, n ) );
+            TS_ASSERT_THROWS_NOTHING( dense.analyze( A, m, n ) );
+
+            unsigned rank = dense.getRank();
+            TS_ASSERT_EQUALS( sparse.getRank(), rank );
+            TS_ASSERT_EQUALS( sparse.getRedundantRows().size(), m - rank );
+
+            // The independent columns, restricted to the non-redundant rows, are non-singular
+            Set<unsigned> redundantRows = sparse.getRedundantRows();
+            List<unsigned> columns = sparse.getIndependentColumns();
+            TS_ASSERT_EQUALS( columns.size(), rank );
+
+            unsigned row = 0;
+            for ( unsigned i = 0; i < m; ++i )
+            {
+                if ( redundantRows.exists( i ) )
+                    continue;
+
+                unsigned column = 0;
+                for ( const auto &j : columns )
+                {
+                    B[row * rank + column] = A[i * n + j];
+                    ++column;
+                }
+                ++row;
+            }
+
+            ConstraintMatrixAnalyzer basis;
+            TS_ASSERT_THROWS_NOTHING( basis.analyze( B, rank, rank ) );
+            TS_ASSERT_EQUALS( basis.getRank(), rank );
+
+            for ( unsigned i = 0; i < m; ++i )
+                delete rows[i];
+        }
+    }
 };
 
 //
@@ -0,0 +1,150 @@
+/*********************                                                        */
+/*! \file Test_ConstraintMatrixScaler.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include <cxxtest/TestSuite.h>
+
+#include "ConstraintMatrixScaler.h"
+#include "FloatUtils.h"
+#include "InputQuery.h"
+
+#include <cmath>
+
+class MockForConstraintMatrixScaler
+{
+public:
+};
+
+class ConstraintMatrixScalerTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForConstraintMatrixScaler *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForConstraintMatrixScaler );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    bool isPowerOfTwo( double value )
+    {
+        int exponent;
+        return std::frexp( value, &exponent ) == 0.5;
+    }
+
+    void test_scaling()
+    {
+        InputQuery query;
+        query.setNumberOfVariables( 4 );
+
+        // 1000 x0 + 0.001 x1 + x2 = 5
+        Equation equation1;
+        equation1.addAddend( 1000, 0 );
+        equation1.addAddend( 0.001, 1 );
+        equation1.addAddend( 1, 2 );
+        equation1.setScalar( 5 );
+        query.addEquation( equation1 );
+
+        // 2000 x0 - 0.003 x1 + 4 x3 = 1
+        Equation equation2;
+        equation2.addAddend( 2000, 0 );
+        equation2.addAddend( -0.003, 1 );
+        equation2.addAddend( 4, 3 );
+        equation2.setScalar( 1 );
+        query.addEquation( equation2 );
+
+        query.setLowerBound( 0, -1 );
+        query.setUpperBound( 0, 3 );
+        query.setLowerBound( 1, 0 );
+        query.setUpperBound( 1, 500 );
+
+        // x3 may not be scaled
+        Set<unsigned> unscalable = { 3 };
+
+        ConstraintMatrixScaler scaler;
+        TS_ASSERT_THROWS_NOTHING( scaler.scale( query, unscalable ) );
+
+        TS_ASSERT_EQUALS( scaler.getColumnScalingFactor( 3 ), 1.0 );
+        TS_ASSERT( scaler.getNumScaledColumns() > 0 );
+
+        for ( unsigned i = 0; i < 4; ++i )
+            TS_ASSERT( isPowerOfTwo( scaler.getColumnScalingFactor( i ) ) );
+
+        // The large and small columns have been brought closer together
+        TS_ASSERT( scaler.getColumnScalingFactor( 0 ) < 1 );
+        TS_ASSERT( scaler.getColumnScalingFactor( 1 ) > 1 );
+
+        // Bounds are scaled
+        TS_ASSERT( FloatUtils::areEqual( query.getLowerBound( 0 ) * scaler.getColumnScalingFactor( 0 ), -1 ) );
+        TS_ASSERT( FloatUtils::areEqual( query.getUpperBound( 0 ) * scaler.getColumnScalingFactor( 0 ), 3 ) );
+        TS_ASSERT( FloatUtils::areEqual( query.getUpperBound( 1 ) * scaler.getColumnScalingFactor( 1 ), 500 ) );
+
+        /*
+          A solution of the original equations, mapped to the scaled
+          variables, satisfies the scaled equations:
+
+          x0 = 0.001, x1 = 1000, x2 = 3, x3 = ( 1 - 2 + 3 ) / 4 = 0.5
+        */
+        double original[4] = { 0.001, 1000, 3, 0.5 };
+        double scaled[4];
+        for ( unsigned i = 0; i < 4; ++i )
+            scaled[i] = original[i] / scaler.getColumnScalingFactor( i );
+
+        for ( const auto &equation : query.getEquations() )
+        {
+            double sum = 0;
+            for ( const auto &addend : equation._addends )
+                sum += addend._coefficient * scaled[addend._variable];
+
+            TS_ASSERT( FloatUtils::areEqual( sum, equation._scalar ) );
+        }
+
+        // And unscaling gets the original values back
+        for ( unsigned i = 0; i < 4; ++i )
+            TS_ASSERT( FloatUtils::areEqual( scaler.unscaleValue( i, scaled[i] ), original[i] ) );
+    }
+
+    void test_well_scaled_query_unchanged()
+    {
+        InputQuery query;
+        query.setNumberOfVariables( 2 );
+
+        // x0 - x1 = 3
+        Equation equation;
+        equation.addAddend( 1, 0 );
+        equation.addAddend( -1, 1 );
+        equation.setScalar( 3 );
+        query.addEquation( equation );
+
+        ConstraintMatrixScaler scaler;
+        TS_ASSERT_THROWS_NOTHING( scaler.scale( query, Set<unsigned>() ) );
+
+        TS_ASSERT_EQUALS( scaler.getNumScaledColumns(), 0U );
+        TS_ASSERT_EQUALS( query.getEquations().begin()->_scalar, 3.0 );
+        TS_ASSERT_EQUALS( scaler.unscaleValue( 0, 7 ), 7.0 );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -114,6 +114,56 @@ public:
 
         TS_ASSERT( FloatUtils::areEqual( checker.computeDegradation( *tableau ), 14.0 ) );
     }
+
+    void test_sampled_degradation()
+    {
+        InputQuery inputQuery;
+
+        // x0 + x1 = 1
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( 1, 1 );
+        equation1.setScalar( 1 );
+        inputQuery.addEquation( equation1 );
+
+        // x1 - x2 = 2
+        Equation equation2;
+        equation2.addAddend( 1, 1 );
+        equation2.addAddend( -1, 2 );
+        equation2.setScalar( 2 );
+        inputQuery.addEquation( equation2 );
+
+        // 2x0 + x2 = 3
+        Equation equation3;
+        equation3.addAddend( 2, 0 );
+        equation3.addAddend( 1, 2 );
+        equation3.setScalar( 3 );
+        inputQuery.addEquation( equation3 );
+
+        DegradationChecker checker;
+        TS_ASSERT_THROWS_NOTHING( checker.storeEquations( inputQuery ) );
+
+        tableau->nextValues[0] = 1;
+        tableau->nextValues[1] = 1;
+        tableau->nextValues[2] = 1;
+
+        // Degradations per equation: 1, 2, 0
+        TS_ASSERT( FloatUtils::areEqual( checker.computeDegradation( *tableau ), 3.0 ) );
+
+        // Samples of one equation, in a round-robin fashion, extrapolated to three equations
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 1, 100 ), 3.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 1, 100 ), 6.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 1, 100 ), 0.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 1, 100 ), 3.0 ) );
+
+        // Above the escalation threshold, a full check is performed
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 1, 5 ), 3.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 1, 5 ), 0.0 ) );
+
+        // A sample that covers all equations is a full check
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 3, 100 ), 3.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( checker.computeSampledDegradation( *tableau, 0, 100 ), 3.0 ) );
+    }
 };
 
 //
@@ -16,6 +16,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "DisjunctionConstraint.h"
+#include "InfeasibleQueryException.h"
 #include "MarabouError.h"
 #include "MockErrno.h"
 
@@ -226,6 +227,199 @@ public:
             TS_ASSERT_EQUALS( validSplit, *cs1 );
         }
     }
+
+    void test_infeasible_disjuncts_are_pruned()
+    {
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, *cs2, *cs3 };
+        DisjunctionConstraint dc( caseSplits );
+
+        dc.notifyLowerBound( 0, 2 );
+
+        List<PiecewiseLinearCaseSplit> splits = dc.getCaseSplits();
+        TS_ASSERT_EQUALS( splits, List<PiecewiseLinearCaseSplit>( { *cs2, *cs3 } ) );
+
+        // Renaming a variable also renames it in the remaining disjuncts
+        dc.updateVariableIndex( 2, 7 );
+        cs3->updateVariableIndex( 2, 7 );
+
+        splits = dc.getCaseSplits();
+        TS_ASSERT_EQUALS( splits, List<PiecewiseLinearCaseSplit>( { *cs2, *cs3 } ) );
+    }
+
+    void test_entailed_tightenings()
+    {
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, *cs2, *cs3 };
+        DisjunctionConstraint dc( caseSplits );
+
+        // Every disjunct is feasible, and cs1 and cs3 leave x0 unbounded
+        List<Tightening> tightenings;
+        dc.getEntailedTightenings( tightenings );
+        TS_ASSERT( tightenings.empty() );
+
+        dc.notifyLowerBound( 0, -10 );
+        dc.notifyUpperBound( 0, 3 );
+
+        // cs3 is infeasible: x0 <= 1 or 1 <= x0 <= 5, within [-10, 3]
+        tightenings.clear();
+        dc.getEntailedTightenings( tightenings );
+        TS_ASSERT( tightenings.empty() );
+
+        // Two disjuncts with lower bounds on x0
+        PiecewiseLinearCaseSplit cs4;
+        cs4.storeBoundTightening( Tightening( 0, 7, Tightening::LB ) );
+        cs4.storeBoundTightening( Tightening( 1, 2, Tightening::UB ) );
+        caseSplits = { *cs2, *cs3, cs4 };
+
+        DisjunctionConstraint dc2( caseSplits );
+        dc2.notifyUpperBound( 0, 20 );
+
+        tightenings.clear();
+        dc2.getEntailedTightenings( tightenings );
+        TS_ASSERT_EQUALS( tightenings.size(), 1U );
+        TS_ASSERT( tightenings.exists( Tightening( 0, 1, Tightening::LB ) ) );
+
+        // Ruling out cs2 and cs4 leaves cs3, whose bound is already implied
+        dc2.notifyLowerBound( 0, 6 );
+        TS_ASSERT( !dc2.phaseFixed() );
+        dc2.notifyUpperBound( 0, 6.5 );
+        TS_ASSERT( dc2.phaseFixed() );
+        TS_ASSERT_EQUALS( dc2.getValidCaseSplit(), *cs3 );
+
+        tightenings.clear();
+        dc2.getEntailedTightenings( tightenings );
+        TS_ASSERT( tightenings.empty() );
+    }
+
+    void test_entailed_tightenings_single_disjunct()
+    {
+        PiecewiseLinearCaseSplit cs4;
+        cs4.storeBoundTightening( Tightening( 0, 7, Tightening::LB ) );
+        cs4.storeBoundTightening( Tightening( 1, 2, Tightening::UB ) );
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, cs4 };
+
+        DisjunctionConstraint dc( caseSplits );
+        dc.notifyLowerBound( 0, 3 );
+        TS_ASSERT( dc.phaseFixed() );
+        TS_ASSERT_EQUALS( dc.getValidCaseSplit(), cs4 );
+
+        List<Tightening> tightenings;
+        dc.getEntailedTightenings( tightenings );
+        TS_ASSERT_EQUALS( tightenings.size(), 2U );
+        TS_ASSERT( tightenings.exists( Tightening( 0, 7, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( 1, 2, Tightening::UB ) ) );
+    }
+
+    void test_entailed_tightenings_no_feasible_disjunct()
+    {
+        // x1 <= 2, 7 <= x0
+        PiecewiseLinearCaseSplit cs4;
+        cs4.storeBoundTightening( Tightening( 1, 2, Tightening::UB ) );
+        cs4.storeBoundTightening( Tightening( 0, 7, Tightening::LB ) );
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, cs4 };
+
+        DisjunctionConstraint dc( caseSplits );
+        dc.notifyLowerBound( 0, 3 );
+        dc.notifyUpperBound( 0, 4 );
+        TS_ASSERT( !dc.phaseFixed() );
+
+        // Each disjunct contributes the bound that rules it out
+        List<Tightening> tightenings;
+        dc.getEntailedTightenings( tightenings );
+        TS_ASSERT_EQUALS( tightenings.size(), 2U );
+        TS_ASSERT( tightenings.exists( Tightening( 0, 1, Tightening::UB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( 0, 7, Tightening::LB ) ) );
+    }
+
+    void test_eliminate_variable()
+    {
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, *cs2, *cs3 };
+
+        /*
+          x0 <= 1       -->   x1 = 2
+          1 <= x0 <= 5  -->   x1 = x0
+          5 <= x0       -->   x1 = 2x2 + 5
+
+          Fixing x0 = 3 leaves only the second disjunct, x1 = 3
+        */
+        DisjunctionConstraint dc( caseSplits );
+        dc.eliminateVariable( 0, 3 );
+
+        TS_ASSERT( !dc.constraintObsolete() );
+        TS_ASSERT( !dc.participatingVariable( 0 ) );
+        TS_ASSERT( !dc.participatingVariable( 2 ) );
+        TS_ASSERT( dc.phaseFixed() );
+
+        PiecewiseLinearCaseSplit validSplit = dc.getValidCaseSplit();
+        TS_ASSERT( validSplit.getBoundTightenings().empty() );
+        TS_ASSERT_EQUALS( validSplit.getEquations().size(), 1U );
+        Equation equation = validSplit.getEquations().front();
+        TS_ASSERT_EQUALS( equation._addends.size(), 1U );
+        TS_ASSERT_EQUALS( equation._addends.front(), Equation::Addend( -1, 1 ) );
+        TS_ASSERT_EQUALS( equation._scalar, -3 );
+
+        // Fixing x1 = 2 satisfies the first disjunct whenever x0 <= 1
+        DisjunctionConstraint dc2( caseSplits );
+        dc2.eliminateVariable( 1, 2 );
+        TS_ASSERT( !dc2.constraintObsolete() );
+        dc2.eliminateVariable( 0, 0 );
+        TS_ASSERT( dc2.constraintObsolete() );
+    }
+
+    void test_eliminate_variable_violating_all_disjuncts()
+    {
+        // x1 = 4, which only involves an equation
+        PiecewiseLinearCaseSplit cs4;
+        Equation equation;
+        equation.addAddend( 1, 1 );
+        equation.setScalar( 4 );
+        cs4.addEquation( equation );
+
+        /*
+          x0 <= 1       -->   x1 = 2
+          1 <= x0 <= 5  -->   x1 = x0
+          x1 = 4
+
+          Fixing x0 = 6 violates the first two disjuncts, and fixing
+          x1 = 3 then violates the third
+        */
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, *cs2, cs4 };
+        DisjunctionConstraint dc( caseSplits );
+        TS_ASSERT_THROWS_NOTHING( dc.eliminateVariable( 0, 6 ) );
+        TS_ASSERT( dc.phaseFixed() );
+        TS_ASSERT_THROWS( dc.eliminateVariable( 1, 3 ), const InfeasibleQueryException & );
+
+        // An equation-only disjunct is violated at once
+        caseSplits = { cs4 };
+        DisjunctionConstraint dc2( caseSplits );
+        TS_ASSERT_THROWS( dc2.eliminateVariable( 1, 5 ), const InfeasibleQueryException & );
+
+        // All disjuncts are violated by a single variable
+        caseSplits = { *cs1, *cs3 };
+        DisjunctionConstraint dc3( caseSplits );
+        TS_ASSERT_THROWS( dc3.eliminateVariable( 0, 3 ), const InfeasibleQueryException & );
+    }
+
+    void test_serialize_and_unserialize()
+    {
+        PiecewiseLinearCaseSplit cs4 = *cs3;
+        Equation inequality( Equation::GE );
+        inequality.addAddend( 0.5, 3 );
+        inequality.addAddend( -1.25, 0 );
+        inequality.setScalar( -4 );
+        cs4.addEquation( inequality );
+
+        List<PiecewiseLinearCaseSplit> caseSplits = { *cs1, *cs2, cs4 };
+        DisjunctionConstraint original( caseSplits );
+
+        String serialized = original.serializeToString();
+        DisjunctionConstraint recovered( serialized );
+
+        TS_ASSERT_EQUALS( recovered.getCaseSplits(), caseSplits );
+        TS_ASSERT_EQUALS( recovered.serializeToString(), serialized );
+
+        List<unsigned> variables = recovered.getParticipatingVariables();
+        TS_ASSERT_EQUALS( variables.size(), 4U );
+    }
 };
 
 //
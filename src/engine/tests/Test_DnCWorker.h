@@ -246,6 +246,96 @@ public:
         TS_ASSERT( numUnsolvedSubQueries.load() == 1 );
         TS_ASSERT( shouldQuitSolving.load() );
     }
+
+    void test_warm_start()
+    {
+        TS_ASSERT( clearSubQueries() == 0 );
+
+        // A subQuery that times out passes a warm start to its children
+        createPlaceHolderSubQuery();
+        _engine->setTimeToSolve( 10 );
+        _engine->setExitCode( IEngine::TIMEOUT );
+        std::atomic_uint numUnsolvedSubQueries( 1 );
+        std::atomic_bool shouldQuitSolving( false );
+        DnCWorker dncWorker( _workload, _engine, numUnsolvedSubQueries,
+                             shouldQuitSolving, 0, 2, 1,
+                             DivideStrategy::LargestInterval );
+
+        dncWorker.popOneSubQueryAndSolve();
+        TS_ASSERT_EQUALS( _engine->numWarmStartsApplied, 0U );
+        TS_ASSERT_EQUALS( _engine->numWarmStartsExtracted, 1U );
+        TS_ASSERT( numUnsolvedSubQueries.load() == 4 );
+
+        // All children share the same warm start
+        List<SubQuery *> children;
+        SubQuery *subQuery = NULL;
+        while ( _workload->pop( subQuery ) )
+            children.append( subQuery );
+
+        TS_ASSERT_EQUALS( children.size(), 4U );
+        for ( const auto &child : children )
+        {
+            TS_ASSERT( child->_warmStart );
+            TS_ASSERT_EQUALS( child->_warmStart, ( *children.begin() )->_warmStart );
+        }
+
+        // A child applies the warm start before solving
+        for ( const auto &child : children )
+            TS_ASSERT( _workload->push( child ) );
+
+        _engine->setTimeToSolve( 1000 );
+        _engine->setExitCode( IEngine::UNSAT );
+        dncWorker.popOneSubQueryAndSolve();
+        TS_ASSERT_EQUALS( _engine->numWarmStartsApplied, 1U );
+        TS_ASSERT_EQUALS( _engine->numWarmStartsExtracted, 1U );
+        TS_ASSERT( numUnsolvedSubQueries.load() == 3 );
+    }
+
+    void test_split_donation()
+    {
+        TS_ASSERT( clearSubQueries() == 0 );
+
+        createPlaceHolderSubQuery();
+        _engine->setTimeToSolve( 1000 );
+        _engine->setExitCode( IEngine::UNSAT );
+        std::atomic_uint numUnsolvedSubQueries( 1 );
+        std::atomic_bool shouldQuitSolving( false );
+        std::atomic_uint numIdleWorkers( 0 );
+        DnCWorker dncWorker( _workload, _engine, numUnsolvedSubQueries,
+                             shouldQuitSolving, 0, 2, 1,
+                             DivideStrategy::LargestInterval );
+        dncWorker.enableSplitDonation( numIdleWorkers );
+
+        // Splits are wanted only when some worker is idle and the
+        // workload is empty
+        TS_ASSERT( !dncWorker.wantsSplit() );
+        numIdleWorkers = 1;
+
+        // The engine tries to donate two splits, but once the first
+        // one is in the workload no more are wanted
+        PiecewiseLinearCaseSplit split1;
+        split1.storeBoundTightening( Tightening( 4, 0.0, Tightening::LB ) );
+        PiecewiseLinearCaseSplit split2;
+        split2.storeBoundTightening( Tightening( 4, 0.0, Tightening::UB ) );
+        _engine->splitsToDonate.append( split1 );
+        _engine->splitsToDonate.append( split2 );
+
+        dncWorker.popOneSubQueryAndSolve();
+
+        // The receiver is installed only while a subquery is being solved
+        TS_ASSERT( !_engine->lastSplitDonationReceiver );
+        TS_ASSERT( numUnsolvedSubQueries.load() == 1 );
+        TS_ASSERT( !dncWorker.wantsSplit() );
+
+        // The donated subquery is restricted to the original region
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( _workload->pop( subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_split->getBoundTightenings().size(), 7U );
+        TS_ASSERT_EQUALS( subQuery->_split->getBoundTightenings().last(),
+                          Tightening( 4, 0.0, Tightening::LB ) );
+        delete subQuery;
+        TS_ASSERT( _workload->empty() );
+    }
 };
 
 //
@@ -0,0 +1,166 @@
+/*********************                                                        */
+/*! \file Test_Falsifier.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "Falsifier.h"
+#include "FloatUtils.h"
+#include "InputQuery.h"
+#include "MockErrno.h"
+#include "ReluConstraint.h"
+
+class MockForFalsifier
+    : public MockErrno
+{
+public:
+};
+
+class FalsifierTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForFalsifier *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForFalsifier );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void populateQuery( InputQuery &inputQuery, double outputLowerBound )
+    {
+        /*
+          x0, x1 in [-1, 1]
+          b = x0 - x1
+          f = ReLU( b )
+          y = f - 0.5, y >= outputLowerBound
+
+          Variables: x0 = 0, x1 = 1, b = 2, f = 3, y = 4
+        */
+        inputQuery.setNumberOfVariables( 5 );
+
+        inputQuery.setLowerBound( 0, -1 );
+        inputQuery.setUpperBound( 0, 1 );
+        inputQuery.setLowerBound( 1, -1 );
+        inputQuery.setUpperBound( 1, 1 );
+        inputQuery.setLowerBound( 4, outputLowerBound );
+
+        Equation equation1;
+        equation1.addAddend( 1, 0 );
+        equation1.addAddend( -1, 1 );
+        equation1.addAddend( -1, 2 );
+        equation1.setScalar( 0 );
+        inputQuery.addEquation( equation1 );
+
+        Equation equation2;
+        equation2.addAddend( 1, 3 );
+        equation2.addAddend( -1, 4 );
+        equation2.setScalar( 0.5 );
+        inputQuery.addEquation( equation2 );
+
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( 2, 3 ) );
+
+        inputQuery.markInputVariable( 0, 0 );
+        inputQuery.markInputVariable( 1, 1 );
+        inputQuery.markOutputVariable( 4, 0 );
+
+        NetworkLevelReasoner *nlr = new NetworkLevelReasoner;
+        nlr->setNumberOfLayers( 3 );
+        nlr->setLayerSize( 0, 2 );
+        nlr->setLayerSize( 1, 1 );
+        nlr->setLayerSize( 2, 1 );
+        nlr->allocateWeightMatrices();
+
+        nlr->setWeight( 0, 0, 0, 1 );
+        nlr->setWeight( 0, 1, 0, -1 );
+        nlr->setWeight( 1, 0, 0, 1 );
+        nlr->setBias( 2, 0, -0.5 );
+        nlr->setNeuronActivationFunction( 1, 0, NetworkLevelReasoner::ReLU );
+
+        nlr->setWeightedSumVariable( 1, 0, 2 );
+        nlr->setActivationResultVariable( 1, 0, 3 );
+
+        inputQuery.setNetworkLevelReasoner( nlr );
+    }
+
+    void test_falsify_by_sampling()
+    {
+        InputQuery inputQuery;
+        populateQuery( inputQuery, 0.5 );
+
+        Falsifier falsifier;
+        TS_ASSERT( falsifier.falsify( inputQuery ) );
+
+        double x0 = inputQuery.getSolutionValue( 0 );
+        double x1 = inputQuery.getSolutionValue( 1 );
+        TS_ASSERT( FloatUtils::gte( x0, -1 ) && FloatUtils::lte( x0, 1 ) );
+        TS_ASSERT( FloatUtils::gte( x1, -1 ) && FloatUtils::lte( x1, 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( inputQuery.getSolutionValue( 2 ), x0 - x1 ) );
+        TS_ASSERT( FloatUtils::areEqual( inputQuery.getSolutionValue( 3 ), FloatUtils::max( x0 - x1, 0 ) ) );
+        TS_ASSERT( FloatUtils::gte( inputQuery.getSolutionValue( 4 ), 0.5 ) );
+    }
+
+    void test_falsify_by_gradient_search()
+    {
+        // y >= 1.45 only holds near the corner x0 = 1, x1 = -1
+        InputQuery inputQuery;
+        populateQuery( inputQuery, 1.45 );
+
+        Falsifier falsifier;
+        falsifier.setNumSamples( 20 );
+        falsifier.setNumGradientStarts( 4 );
+        TS_ASSERT( falsifier.falsify( inputQuery ) );
+        TS_ASSERT( falsifier.getNumEvaluations() > 20U );
+
+        TS_ASSERT( FloatUtils::gte( inputQuery.getSolutionValue( 4 ), 1.45 ) );
+        TS_ASSERT( FloatUtils::gte( inputQuery.getSolutionValue( 0 ) - inputQuery.getSolutionValue( 1 ), 1.95 ) );
+    }
+
+    void test_unsatisfiable()
+    {
+        // The output is at most 1.5
+        InputQuery inputQuery;
+        populateQuery( inputQuery, 2 );
+
+        Falsifier falsifier;
+        TS_ASSERT( !falsifier.falsify( inputQuery ) );
+    }
+
+    void test_requires_network_and_bounded_inputs()
+    {
+        InputQuery inputQuery;
+        populateQuery( inputQuery, 0.5 );
+        inputQuery.setUpperBound( 0, FloatUtils::infinity() );
+
+        Falsifier falsifier;
+        TS_ASSERT( !falsifier.falsify( inputQuery ) );
+        TS_ASSERT_EQUALS( falsifier.getNumEvaluations(), 0U );
+
+        InputQuery noNetwork;
+        noNetwork.setNumberOfVariables( 1 );
+        TS_ASSERT( !falsifier.falsify( noNetwork ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,191 @@
+/*********************                                                        */
+/*! \file Test_LeakyReluConstraint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "InputQuery.h"
+#include "LeakyReluConstraint.h"
+#include "MarabouError.h"
+#include "MockErrno.h"
+#include "PiecewiseLinearCaseSplit.h"
+
+class MockForLeakyReluConstraint
+    : public MockErrno
+{
+public:
+};
+
+class LeakyReluConstraintTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForLeakyReluConstraint *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForLeakyReluConstraint );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_invalid_slope()
+    {
+        TS_ASSERT_THROWS_EQUALS( LeakyReluConstraint( 1, 4, 0 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_LEAKY_RELU_SLOPE );
+
+        TS_ASSERT_THROWS_EQUALS( LeakyReluConstraint( 1, 4, 1 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_LEAKY_RELU_SLOPE );
+
+        TS_ASSERT_THROWS_NOTHING( LeakyReluConstraint( 1, 4, 0.1 ) );
+    }
+
+    void test_satisfied()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        LeakyReluConstraint leakyRelu( b, f, 0.1 );
+
+        leakyRelu.notifyVariableValue( b, 2 );
+        leakyRelu.notifyVariableValue( f, 2 );
+        TS_ASSERT( leakyRelu.satisfied() );
+
+        leakyRelu.notifyVariableValue( b, -2 );
+        TS_ASSERT( !leakyRelu.satisfied() );
+
+        leakyRelu.notifyVariableValue( f, -0.2 );
+        TS_ASSERT( leakyRelu.satisfied() );
+
+        // Both fixes restore the constraint
+        leakyRelu.notifyVariableValue( f, 1 );
+        List<PiecewiseLinearConstraint::Fix> fixes = leakyRelu.getPossibleFixes();
+        TS_ASSERT_EQUALS( fixes.size(), 2U );
+        TS_ASSERT( fixes.exists( PiecewiseLinearConstraint::Fix( f, -0.2 ) ) );
+        TS_ASSERT( fixes.exists( PiecewiseLinearConstraint::Fix( b, 1 ) ) );
+    }
+
+    void test_case_splits()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        LeakyReluConstraint leakyRelu( b, f, 0.25 );
+
+        List<PiecewiseLinearCaseSplit> splits = leakyRelu.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+
+        PiecewiseLinearCaseSplit active = splits.front();
+        PiecewiseLinearCaseSplit inactive = splits.back();
+
+        TS_ASSERT( active.getBoundTightenings().exists( Tightening( b, 0, Tightening::LB ) ) );
+        TS_ASSERT( active.getBoundTightenings().exists( Tightening( f, 0, Tightening::LB ) ) );
+        TS_ASSERT_EQUALS( active.getEquations().size(), 1U );
+
+        TS_ASSERT( inactive.getBoundTightenings().exists( Tightening( b, 0, Tightening::UB ) ) );
+        TS_ASSERT( inactive.getBoundTightenings().exists( Tightening( f, 0, Tightening::UB ) ) );
+        TS_ASSERT_EQUALS( inactive.getEquations().size(), 1U );
+
+        Equation inactiveEquation = inactive.getEquations().front();
+        auto addend = inactiveEquation._addends.begin();
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( 0.25, b ) );
+        ++addend;
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( -1, f ) );
+        TS_ASSERT_EQUALS( inactiveEquation._scalar, 0 );
+    }
+
+    void test_phase_fixing_and_tightenings()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        LeakyReluConstraint leakyRelu( b, f, 0.5 );
+
+        leakyRelu.notifyLowerBound( b, -4 );
+        leakyRelu.notifyUpperBound( b, 6 );
+        leakyRelu.notifyLowerBound( f, -10 );
+        leakyRelu.notifyUpperBound( f, 3 );
+        TS_ASSERT( !leakyRelu.phaseFixed() );
+
+        // Bounds are propagated exactly in both directions
+        List<Tightening> tightenings;
+        leakyRelu.getEntailedTightenings( tightenings );
+        TS_ASSERT_EQUALS( tightenings.size(), 4U );
+        TS_ASSERT( tightenings.exists( Tightening( f, -2, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( f, 6, Tightening::UB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, -20, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, 3, Tightening::UB ) ) );
+
+        // A non-positive f fixes the inactive phase
+        leakyRelu.notifyUpperBound( f, 0 );
+        TS_ASSERT( leakyRelu.phaseFixed() );
+        TS_ASSERT_EQUALS( leakyRelu.getPhaseStatus(), LeakyReluConstraint::PHASE_INACTIVE );
+
+        tightenings.clear();
+        leakyRelu.getEntailedTightenings( tightenings );
+        TS_ASSERT( tightenings.exists( Tightening( b, 0, Tightening::UB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( f, 0, Tightening::UB ) ) );
+
+        LeakyReluConstraint leakyRelu2( b, f, 0.5 );
+        leakyRelu2.notifyLowerBound( b, 0 );
+        TS_ASSERT_EQUALS( leakyRelu2.getPhaseStatus(), LeakyReluConstraint::PHASE_ACTIVE );
+    }
+
+    void test_add_auxiliary_equations()
+    {
+        LeakyReluConstraint leakyRelu( 4, 6, 0.1 );
+        InputQuery query;
+        query.setNumberOfVariables( 9 );
+
+        TS_ASSERT_THROWS_NOTHING( leakyRelu.addAuxiliaryEquations( query ) );
+
+        TS_ASSERT_EQUALS( query.getNumberOfVariables(), 11U );
+        TS_ASSERT_EQUALS( query.getEquations().size(), 2U );
+
+        Equation second = query.getEquations().back();
+        auto addend = second._addends.begin();
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( 1, 6 ) );
+        ++addend;
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( -0.1, 4 ) );
+        ++addend;
+        TS_ASSERT_EQUALS( *addend, Equation::Addend( -1, 10 ) );
+        TS_ASSERT_EQUALS( query.getLowerBound( 10 ), 0 );
+    }
+
+    void test_serialize_and_unserialize()
+    {
+        LeakyReluConstraint original( 3, 8, 0.01 );
+        String serialized = original.serializeToString();
+
+        LeakyReluConstraint recovered( serialized );
+        TS_ASSERT_EQUALS( recovered.getB(), 3U );
+        TS_ASSERT_EQUALS( recovered.getF(), 8U );
+        TS_ASSERT_EQUALS( recovered.getSlope(), 0.01 );
+        TS_ASSERT_EQUALS( recovered.serializeToString(), serialized );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
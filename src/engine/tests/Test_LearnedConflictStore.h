@@ -0,0 +1,142 @@
+/*********************                                                        */
+/*! \file Test_LearnedConflictStore.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "LearnedConflictStore.h"
+#include "MockErrno.h"
+
+#include <thread>
+
+class MockForLearnedConflictStore
+    : public MockErrno
+{
+public:
+};
+
+class LearnedConflictStoreTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForLearnedConflictStore *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForLearnedConflictStore );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_add_split()
+    {
+        LearnedConflict conflict;
+
+        PiecewiseLinearCaseSplit boundsOnly;
+        boundsOnly.storeBoundTightening( Tightening( 0, 1.0, Tightening::LB ) );
+        boundsOnly.storeBoundTightening( Tightening( 1, 2.0, Tightening::UB ) );
+
+        PiecewiseLinearCaseSplit withEquation;
+        withEquation.storeBoundTightening( Tightening( 2, 0.0, Tightening::LB ) );
+        Equation equation;
+        equation.addAddend( 1, 2 );
+        equation.addAddend( -1, 3 );
+        equation.setScalar( 0 );
+        withEquation.addEquation( equation );
+
+        conflict.addSplit( boundsOnly );
+        conflict.addSplit( withEquation );
+
+        TS_ASSERT_EQUALS( conflict._bounds.size(), 3U );
+        TS_ASSERT_EQUALS( conflict._splitsWithEquations.size(), 1U );
+        TS_ASSERT_EQUALS( *conflict._splitsWithEquations.begin(), withEquation );
+    }
+
+    void test_publish_and_import()
+    {
+        LearnedConflictStore store( 3 );
+
+        unsigned cursor = 0;
+        List<const LearnedConflict *> conflicts;
+
+        store.importConflicts( cursor, conflicts );
+        TS_ASSERT( conflicts.empty() );
+
+        LearnedConflict *conflict1 = new LearnedConflict;
+        LearnedConflict *conflict2 = new LearnedConflict;
+        TS_ASSERT( store.publish( conflict1 ) );
+        TS_ASSERT( store.publish( conflict2 ) );
+        TS_ASSERT_EQUALS( store.size(), 2U );
+
+        store.importConflicts( cursor, conflicts );
+        TS_ASSERT_EQUALS( cursor, 2U );
+        TS_ASSERT_EQUALS( conflicts, List<const LearnedConflict *>( { conflict1, conflict2 } ) );
+
+        // Only new conflicts are imported
+        LearnedConflict *conflict3 = new LearnedConflict;
+        TS_ASSERT( store.publish( conflict3 ) );
+        store.importConflicts( cursor, conflicts );
+        TS_ASSERT_EQUALS( conflicts.size(), 3U );
+        TS_ASSERT_EQUALS( conflicts.back(), conflict3 );
+
+        // The store is full
+        TS_ASSERT( !store.publish( new LearnedConflict ) );
+        TS_ASSERT_EQUALS( store.size(), 3U );
+        store.importConflicts( cursor, conflicts );
+        TS_ASSERT_EQUALS( conflicts.size(), 3U );
+    }
+
+    void test_concurrent_publish()
+    {
+        enum {
+            NUM_THREADS = 4,
+            CONFLICTS_PER_THREAD = 250,
+        };
+
+        LearnedConflictStore store( NUM_THREADS * CONFLICTS_PER_THREAD );
+
+        List<std::thread *> threads;
+        for ( unsigned i = 0; i < NUM_THREADS; ++i )
+        {
+            threads.append( new std::thread( [&store]()
+                                             {
+                                                 for ( unsigned j = 0; j < CONFLICTS_PER_THREAD; ++j )
+                                                     store.publish( new LearnedConflict );
+                                             } ) );
+        }
+
+        for ( auto &thread : threads )
+        {
+            thread->join();
+            delete thread;
+        }
+
+        unsigned cursor = 0;
+        List<const LearnedConflict *> conflicts;
+        store.importConflicts( cursor, conflicts );
+
+        TS_ASSERT_EQUALS( cursor, (unsigned)( NUM_THREADS * CONFLICTS_PER_THREAD ) );
+        TS_ASSERT_EQUALS( conflicts.size(), (unsigned)( NUM_THREADS * CONFLICTS_PER_THREAD ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
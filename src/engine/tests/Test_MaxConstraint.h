@@ -177,7 +177,7 @@ public:
 		auto split = splits.begin();
 		for ( unsigned i = 2; i < 10; ++i, ++split )
 		{
-            List<Tightening> bounds = split->getBoundTightenings();
+            Vector<Tightening> bounds = split->getBoundTightenings();
 
             // Since no upper bounds known for any of the variables, no bounds
             TS_ASSERT_EQUALS( bounds.size(), 0U );
@@ -307,6 +307,91 @@ public:
 		TS_ASSERT( !max.getParticipatingVariables().exists( 3 ) );
 	}
 
+    void test_elements_dominated_by_f()
+    {
+        unsigned f = 1;
+        Set<unsigned> elements;
+
+        for ( unsigned i = 2; i < 6; ++i )
+            elements.insert( i );
+
+        MaxConstraint max( f, elements );
+
+        for ( unsigned i = 2; i < 6; ++i )
+        {
+            max.notifyLowerBound( i, 0 );
+            max.notifyUpperBound( i, i );
+        }
+
+        // f >= 3.5: only x4 and x5 can be the maximum
+        max.notifyLowerBound( f, 3.5 );
+        TS_ASSERT( !max.getParticipatingVariables().exists( 2 ) );
+        TS_ASSERT( !max.getParticipatingVariables().exists( 3 ) );
+        TS_ASSERT( max.getParticipatingVariables().exists( 4 ) );
+        TS_ASSERT( max.getParticipatingVariables().exists( 5 ) );
+        TS_ASSERT( !max.phaseFixed() );
+
+        // A tighter upper bound for x4 fixes the phase
+        max.notifyUpperBound( 4, 3 );
+        TS_ASSERT( max.phaseFixed() );
+        TS_ASSERT_EQUALS( max.getParticipatingVariables().size(), 2U );
+
+        // If f's lower bound dominates every element, one element is kept
+        MaxConstraint max2( f, elements );
+        for ( unsigned i = 2; i < 6; ++i )
+            max2.notifyUpperBound( i, i );
+        max2.notifyLowerBound( f, 10 );
+
+        TS_ASSERT( max2.phaseFixed() );
+        TS_ASSERT( max2.getParticipatingVariables().exists( 5 ) );
+
+        List<Tightening> tightenings;
+        max2.getEntailedTightenings( tightenings );
+        TS_ASSERT( tightenings.exists( Tightening( f, 5, Tightening::UB ) ) );
+    }
+
+    void test_case_splits_omit_implied_equations()
+    {
+        unsigned f = 1;
+        Set<unsigned> elements;
+
+        for ( unsigned i = 2; i < 5; ++i )
+            elements.insert( i );
+
+        MaxConstraint max( f, elements );
+
+        // x2 in [0, 1], x3 in [1, 4], x4 in [2, 3]
+        max.notifyLowerBound( 2, 0 );
+        max.notifyUpperBound( 2, 1 );
+        max.notifyLowerBound( 3, 1 );
+        max.notifyUpperBound( 3, 4 );
+        max.notifyLowerBound( 4, 2 );
+        max.notifyUpperBound( 4, 3 );
+
+        for ( unsigned i = 1; i < 5; ++i )
+            max.notifyVariableValue( i, i );
+
+        // x2 is dominated by x4
+        List<PiecewiseLinearCaseSplit> splits = max.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+
+        // x3 is the maximum: x3 >= x4 still needs an equation
+        PiecewiseLinearCaseSplit x3Split = splits.front();
+        TS_ASSERT_EQUALS( x3Split.getEquations().size(), 2U );
+        TS_ASSERT( x3Split.getBoundTightenings().empty() );
+
+        // x4 is the maximum: x4 >= x3 still needs an equation
+        PiecewiseLinearCaseSplit x4Split = splits.back();
+        TS_ASSERT_EQUALS( x4Split.getEquations().size(), 2U );
+        TS_ASSERT( x4Split.getBoundTightenings().exists( Tightening( 3, 3, Tightening::UB ) ) );
+
+        // Once x3 >= 3, x3 >= x4 is implied by the bounds
+        max.notifyLowerBound( 3, 3 );
+        splits = max.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+        TS_ASSERT_EQUALS( splits.front().getEquations().size(), 1U );
+    }
+
     void test_get_entailed_tightenings()
     {
 		unsigned f = 1;
@@ -16,9 +16,12 @@
 #include <cxxtest/TestSuite.h>
 
 #include "FloatUtils.h"
+#include "MarabouError.h"
+#include "MockErrno.h"
 #include "NetworkLevelReasoner.h"
 
 class MockForNetworkLevelReasoner
+    : public MockErrno
 {
 public:
 };
@@ -38,7 +41,7 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete mock );
     }
 
-    void populateNetwork( NetworkLevelReasoner &nlr )
+    void populateNetwork( NetworkLevelReasoner &nlr, bool sparse = false )
     {
         /*
                 a
@@ -55,6 +58,12 @@ public:
         nlr.setLayerSize( 2, 2 );
         nlr.setLayerSize( 3, 2 );
 
+        if ( sparse )
+        {
+            nlr.setWeightStorage( 0, NetworkLevelReasoner::SPARSE );
+            nlr.setWeightStorage( 2, NetworkLevelReasoner::SPARSE );
+        }
+
         nlr.allocateWeightMatrices();
 
         // Weights
@@ -206,6 +215,160 @@ public:
         TS_ASSERT( FloatUtils::areEqual( output1[0], output2[0] ) );
         TS_ASSERT( FloatUtils::areEqual( output1[1], output2[1] ) );
     }
+
+    void test_sparse_weights()
+    {
+        NetworkLevelReasoner dense;
+        NetworkLevelReasoner sparse;
+
+        populateNetwork( dense );
+        populateNetwork( sparse, true );
+
+        for ( unsigned layer = 1; layer < 3; ++layer )
+        {
+            for ( unsigned neuron = 0; neuron < dense.getLayerSize( layer ); ++neuron )
+            {
+                dense.setNeuronActivationFunction( layer, neuron, NetworkLevelReasoner::ReLU );
+                sparse.setNeuronActivationFunction( layer, neuron, NetworkLevelReasoner::ReLU );
+            }
+        }
+
+        // Overwriting a sparse weight does not duplicate it
+        sparse.setWeight( 2, 1, 1, 5 );
+        sparse.setWeight( 2, 1, 1, 3 );
+
+        NetworkLevelReasoner sparseCopy;
+        TS_ASSERT_THROWS_NOTHING( sparse.storeIntoOther( sparseCopy ) );
+
+        double inputs[][2] = { { 0, 0 }, { 1, 1 }, { 1, 2 }, { -2, 3 } };
+        double output1[2];
+        double output2[2];
+        double output3[2];
+
+        for ( const auto &input : inputs )
+        {
+            TS_ASSERT_THROWS_NOTHING( dense.evaluate( (double *)input, output1 ) );
+            TS_ASSERT_THROWS_NOTHING( sparse.evaluate( (double *)input, output2 ) );
+            TS_ASSERT_THROWS_NOTHING( sparseCopy.evaluate( (double *)input, output3 ) );
+
+            for ( unsigned i = 0; i < 2; ++i )
+            {
+                TS_ASSERT( FloatUtils::areEqual( output1[i], output2[i] ) );
+                TS_ASSERT( FloatUtils::areEqual( output1[i], output3[i] ) );
+            }
+        }
+    }
+
+    void test_evaluate_batch()
+    {
+        for ( bool sparse : { false, true } )
+        {
+            NetworkLevelReasoner nlr;
+
+            populateNetwork( nlr, sparse );
+
+            nlr.setNeuronActivationFunction( 1, 0, NetworkLevelReasoner::ReLU );
+            nlr.setNeuronActivationFunction( 1, 1, NetworkLevelReasoner::ReLU );
+            nlr.setNeuronActivationFunction( 2, 1, NetworkLevelReasoner::ReLU );
+
+            TS_ASSERT_EQUALS( nlr.getNumberOfNeurons(), 9U );
+
+            // Enough inputs to span several blocks of rows
+            const unsigned batchSize = 150;
+            double inputs[batchSize * 2];
+            for ( unsigned i = 0; i < batchSize; ++i )
+            {
+                inputs[2 * i] = ( (int)i % 7 ) - 3;
+                inputs[2 * i + 1] = ( (int)i % 5 ) * 0.5 - 1;
+            }
+
+            double outputs[batchSize * 2];
+            double weightedSums[batchSize * 9];
+            double activationResults[batchSize * 9];
+            TS_ASSERT_THROWS_NOTHING( nlr.evaluateBatch( inputs, batchSize, outputs,
+                                                         weightedSums, activationResults ) );
+
+            for ( unsigned i = 0; i < batchSize; ++i )
+            {
+                double output[2];
+                TS_ASSERT_THROWS_NOTHING( nlr.evaluate( inputs + 2 * i, output ) );
+
+                TS_ASSERT( FloatUtils::areEqual( outputs[2 * i], output[0] ) );
+                TS_ASSERT( FloatUtils::areEqual( outputs[2 * i + 1], output[1] ) );
+
+                // Neurons are ordered by layer, and then by index
+                unsigned index = 0;
+                for ( unsigned layer = 0; layer < 4; ++layer )
+                {
+                    for ( unsigned neuron = 0; neuron < nlr.getLayerSize( layer ); ++neuron, ++index )
+                    {
+                        TS_ASSERT( FloatUtils::areEqual( weightedSums[9 * i + index],
+                                                         nlr.getWeightedSumAssignment( layer, neuron ) ) );
+                        TS_ASSERT( FloatUtils::areEqual( activationResults[9 * i + index],
+                                                         nlr.getActivationResultAssignment( layer, neuron ) ) );
+                    }
+                }
+            }
+
+            // The values of the neurons are optional
+            TS_ASSERT_THROWS_NOTHING( nlr.evaluateBatch( inputs, batchSize, outputs ) );
+        }
+    }
+
+    void test_assignments_and_variables()
+    {
+        NetworkLevelReasoner nlr;
+
+        populateNetwork( nlr );
+
+        nlr.setNeuronActivationFunction( 1, 0, NetworkLevelReasoner::ReLU );
+        nlr.setNeuronActivationFunction( 1, 1, NetworkLevelReasoner::ReLU );
+        nlr.setNeuronActivationFunction( 1, 2, NetworkLevelReasoner::ReLU );
+
+        nlr.setWeightedSumVariable( 1, 0, 2 );
+        nlr.setActivationResultVariable( 1, 0, 3 );
+        nlr.setWeightedSumVariable( 1, 1, 4 );
+        nlr.setActivationResultVariable( 1, 1, 5 );
+
+        TS_ASSERT( nlr.hasWeightedSumVariable( 1, 0 ) );
+        TS_ASSERT( !nlr.hasWeightedSumVariable( 1, 2 ) );
+        TS_ASSERT_THROWS_EQUALS( nlr.getWeightedSumVariable( 1, 2 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_WEIGHTED_SUM_INDEX );
+        TS_ASSERT_THROWS_EQUALS( nlr.getActivationResultVariable( 7, 0 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_WEIGHTED_SUM_INDEX );
+
+        double input[2] = { 1, 1 };
+        double output[2];
+        TS_ASSERT_THROWS_NOTHING( nlr.evaluate( input, output ) );
+
+        // Layer 1: a = x + 1, b = 2x - 3y, c = y
+        TS_ASSERT( FloatUtils::areEqual( nlr.getWeightedSumAssignment( 1, 0 ), 2 ) );
+        TS_ASSERT( FloatUtils::areEqual( nlr.getActivationResultAssignment( 1, 0 ), 2 ) );
+        TS_ASSERT( FloatUtils::areEqual( nlr.getWeightedSumAssignment( 1, 1 ), -1 ) );
+        TS_ASSERT( FloatUtils::areEqual( nlr.getActivationResultAssignment( 1, 1 ), 0 ) );
+        TS_ASSERT( FloatUtils::areEqual( nlr.getActivationResultAssignment( 0, 1 ), 1 ) );
+
+        // Variable 3 is merged into 6, variable 4 is eliminated, and
+        // the remaining variables are shifted
+        Map<unsigned, unsigned> merged;
+        merged[3] = 6;
+
+        Map<unsigned, unsigned> oldToNew;
+        oldToNew[2] = 0;
+        oldToNew[5] = 1;
+        oldToNew[6] = 2;
+
+        TS_ASSERT_THROWS_NOTHING( nlr.updateVariableIndices( oldToNew, merged ) );
+
+        TS_ASSERT_EQUALS( nlr.getWeightedSumVariable( 1, 0 ), 0U );
+        TS_ASSERT_EQUALS( nlr.getActivationResultVariable( 1, 0 ), 2U );
+        TS_ASSERT( !nlr.hasWeightedSumVariable( 1, 1 ) );
+        TS_ASSERT_EQUALS( nlr.getActivationResultVariable( 1, 1 ), 1U );
+    }
 };
 
 //
@@ -0,0 +1,146 @@
+/*********************                                                        */
+/*! \file Test_PlConstraintTracker.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "MockErrno.h"
+#include "PlConstraintTracker.h"
+#include "ReluConstraint.h"
+
+class MockForPlConstraintTracker
+    : public MockErrno
+{
+public:
+};
+
+class PlConstraintTrackerTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForPlConstraintTracker *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForPlConstraintTracker );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    List<PiecewiseLinearConstraint *> toList( const Map<unsigned, PiecewiseLinearConstraint *> &violated )
+    {
+        List<PiecewiseLinearConstraint *> result;
+        for ( const auto &entry : violated )
+            result.append( entry.second );
+        return result;
+    }
+
+    void test_violated_constraints()
+    {
+        ReluConstraint relu1( 0, 1 );
+        ReluConstraint relu2( 2, 3 );
+        ReluConstraint relu3( 4, 5 );
+
+        PlConstraintTracker tracker;
+        List<PiecewiseLinearConstraint *> constraints = { &relu1, &relu2, &relu3 };
+        TS_ASSERT_THROWS_NOTHING( tracker.initialize( constraints ) );
+
+        // relu1 and relu3 are violated
+        relu1.notifyVariableValue( 0, 1 );
+        relu1.notifyVariableValue( 1, 2 );
+        relu2.notifyVariableValue( 2, 1 );
+        relu2.notifyVariableValue( 3, 1 );
+        relu3.notifyVariableValue( 4, -1 );
+        relu3.notifyVariableValue( 5, 1 );
+
+        const Map<unsigned, PiecewiseLinearConstraint *> &violated = tracker.getViolatedConstraints();
+        TS_ASSERT( violated.empty() );
+
+        TS_ASSERT_THROWS_NOTHING( tracker.updateViolatedConstraints() );
+        TS_ASSERT_EQUALS( toList( violated ), List<PiecewiseLinearConstraint *>( { &relu1, &relu3 } ) );
+
+        // Fix relu1, break relu2
+        relu1.notifyVariableValue( 1, 1 );
+        relu2.notifyVariableValue( 3, 0 );
+
+        // Nothing changes until the next update
+        TS_ASSERT_EQUALS( toList( violated ), List<PiecewiseLinearConstraint *>( { &relu1, &relu3 } ) );
+
+        TS_ASSERT_THROWS_NOTHING( tracker.updateViolatedConstraints() );
+        TS_ASSERT_EQUALS( toList( violated ), List<PiecewiseLinearConstraint *>( { &relu2, &relu3 } ) );
+
+        // Deactivating a constraint removes it from the violated set
+        relu3.setActiveConstraint( false );
+
+        TS_ASSERT_THROWS_NOTHING( tracker.updateViolatedConstraints() );
+        TS_ASSERT_EQUALS( toList( violated ), List<PiecewiseLinearConstraint *>( { &relu2 } ) );
+
+        // No changes, no new results
+        TS_ASSERT_THROWS_NOTHING( tracker.updateViolatedConstraints() );
+        TS_ASSERT_EQUALS( toList( violated ), List<PiecewiseLinearConstraint *>( { &relu2 } ) );
+
+        // A constraint that is violated again is not duplicated
+        relu2.notifyVariableValue( 3, -1 );
+        tracker.markAllChanged();
+        TS_ASSERT_THROWS_NOTHING( tracker.updateViolatedConstraints() );
+        TS_ASSERT_EQUALS( toList( violated ), List<PiecewiseLinearConstraint *>( { &relu2 } ) );
+    }
+
+    void test_split_candidates()
+    {
+        ReluConstraint relu1( 0, 1 );
+        ReluConstraint relu2( 2, 3 );
+        ReluConstraint relu3( 4, 5 );
+
+        relu1.setScore( 1 );
+        relu2.setScore( 3 );
+        relu3.setScore( 3 );
+
+        PlConstraintTracker tracker;
+        List<PiecewiseLinearConstraint *> constraints = { &relu1, &relu2, &relu3 };
+        TS_ASSERT_THROWS_NOTHING( tracker.initialize( constraints ) );
+
+        // Highest score first, ties broken by index
+        TS_ASSERT_EQUALS( tracker.getNumSplitCandidates(), 3U );
+        TS_ASSERT_EQUALS( tracker.topSplitCandidate(), &relu2 );
+
+        relu2.setActiveConstraint( false );
+        TS_ASSERT_EQUALS( tracker.getNumSplitCandidates(), 2U );
+        TS_ASSERT_EQUALS( tracker.topSplitCandidate(), &relu3 );
+
+        // Fixing the phase of a constraint removes it from the candidates
+        relu3.notifyLowerBound( 4, 1 );
+        TS_ASSERT( relu3.phaseFixed() );
+        TS_ASSERT_EQUALS( tracker.getNumSplitCandidates(), 1U );
+        TS_ASSERT_EQUALS( tracker.topSplitCandidate(), &relu1 );
+
+        relu1.setActiveConstraint( false );
+        TS_ASSERT_EQUALS( tracker.getNumSplitCandidates(), 0U );
+        TS_ASSERT( !tracker.topSplitCandidate() );
+
+        // Reactivated constraints become candidates again
+        relu2.setActiveConstraint( true );
+        TS_ASSERT_EQUALS( tracker.topSplitCandidate(), &relu2 );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
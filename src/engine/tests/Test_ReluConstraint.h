@@ -203,7 +203,7 @@ public:
 
     bool isActiveSplit( unsigned b, unsigned f, List<PiecewiseLinearCaseSplit>::iterator &split )
     {
-        List<Tightening> bounds = split->getBoundTightenings();
+        Vector<Tightening> bounds = split->getBoundTightenings();
 
         auto bound = bounds.begin();
         Tightening bound1 = *bound;
@@ -238,7 +238,7 @@ public:
 
     bool isInactiveSplit( unsigned b, unsigned f, List<PiecewiseLinearCaseSplit>::iterator &split )
     {
-        List<Tightening> bounds = split->getBoundTightenings();
+        Vector<Tightening> bounds = split->getBoundTightenings();
 
         auto bound = bounds.begin();
         Tightening bound1 = *bound;
@@ -488,7 +488,7 @@ public:
 
         Equation activeEquation;
 
-        List<Tightening> bounds = split.getBoundTightenings();
+        Vector<Tightening> bounds = split.getBoundTightenings();
 
         TS_ASSERT_EQUALS( bounds.size(), 1U );
         auto bound = bounds.begin();
@@ -534,7 +534,7 @@ public:
 
         Equation activeEquation;
 
-        List<Tightening> bounds = split.getBoundTightenings();
+        Vector<Tightening> bounds = split.getBoundTightenings();
 
         TS_ASSERT_EQUALS( bounds.size(), 2U );
         auto bound = bounds.begin();
@@ -936,6 +936,35 @@ public:
         TS_ASSERT_EQUALS( query2.getUpperBound( aux ), 0 );
     }
 
+    void test_notify_non_participating_variable()
+    {
+        ReluConstraint relu( 4, 6 );
+
+        // Before the aux variable exists, only b and f are accepted
+        TS_ASSERT_THROWS_EQUALS( relu.notifyVariableValue( 9, 1 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::VARIABLE_INDEX_OUT_OF_RANGE );
+        TS_ASSERT_THROWS_EQUALS( relu.notifyLowerBound( 9, 0 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::VARIABLE_INDEX_OUT_OF_RANGE );
+
+        relu.notifyLowerBound( 4, -10 );
+        relu.notifyUpperBound( 4, 15 );
+
+        InputQuery query;
+        query.setNumberOfVariables( 9 );
+        TS_ASSERT_THROWS_NOTHING( relu.addAuxiliaryEquations( query ) );
+
+        // The aux variable is 9
+        TS_ASSERT_THROWS_NOTHING( relu.notifyUpperBound( 9, 10 ) );
+        TS_ASSERT_THROWS_EQUALS( relu.notifyUpperBound( 5, 10 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::VARIABLE_INDEX_OUT_OF_RANGE );
+    }
+
     ReluConstraint prepareRelu( unsigned b, unsigned f, unsigned aux, IConstraintBoundTightener *tightener )
     {
         ReluConstraint relu( b, f );
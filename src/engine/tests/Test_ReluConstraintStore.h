@@ -0,0 +1,130 @@
+/*********************                                                        */
+/*! \file Test_ReluConstraintStore.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "MarabouError.h"
+#include "MaxConstraint.h"
+#include "MockErrno.h"
+#include "ReluConstraintStore.h"
+
+class MockForReluConstraintStore
+    : public MockErrno
+{
+public:
+};
+
+class ReluConstraintStoreTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForReluConstraintStore *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForReluConstraintStore );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_can_store()
+    {
+        ReluConstraint relu1( 0, 1 );
+        ReluConstraint relu2( 2, 3 );
+        MaxConstraint max( 4, Set<unsigned>( { 5, 6 } ) );
+
+        List<PiecewiseLinearConstraint *> relus = { &relu1, &relu2 };
+        List<PiecewiseLinearConstraint *> mixed = { &relu1, &max };
+
+        TS_ASSERT( ReluConstraintStore::canStore( relus ) );
+        TS_ASSERT( !ReluConstraintStore::canStore( mixed ) );
+
+        ReluConstraintStore store;
+        TS_ASSERT_THROWS_NOTHING( store.initialize( relus ) );
+        TS_ASSERT_EQUALS( store.size(), 2U );
+        TS_ASSERT_EQUALS( store.getConstraint( 1 ), &relu2 );
+        TS_ASSERT_EQUALS( store.getB( 1 ), 2U );
+
+        TS_ASSERT_THROWS_EQUALS( store.initialize( mixed ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::UNSUPPORTED_PIECEWISE_CONSTRAINT );
+    }
+
+    void test_store_and_restore()
+    {
+        ReluConstraint relu1( 0, 1 );
+        ReluConstraint relu2( 2, 3 );
+
+        ReluConstraintStore store;
+        List<PiecewiseLinearConstraint *> constraints = { &relu1, &relu2 };
+        TS_ASSERT_THROWS_NOTHING( store.initialize( constraints ) );
+
+        relu1.notifyLowerBound( 0, -1 );
+        relu1.notifyUpperBound( 0, 5 );
+        relu1.notifyVariableValue( 0, 2 );
+        relu1.notifyVariableValue( 1, 2 );
+
+        TS_ASSERT_EQUALS( store.countActive(), 2U );
+        TS_ASSERT( !store.hasValidSplit( 0 ) );
+
+        ReluConstraintStore::State state;
+        TS_ASSERT_THROWS_NOTHING( store.storeState( state ) );
+        TS_ASSERT_EQUALS( state.size(), 2U );
+
+        // Change the constraints
+        relu1.notifyLowerBound( 0, 1 );
+        relu1.notifyVariableValue( 1, 3 );
+        relu2.setActiveConstraint( false );
+
+        TS_ASSERT( relu1.phaseFixed() );
+        TS_ASSERT( !relu1.satisfied() );
+        TS_ASSERT( store.hasValidSplit( 0 ) );
+        TS_ASSERT_EQUALS( store.countActive(), 1U );
+
+        // Restore
+        TS_ASSERT_THROWS_NOTHING( store.restoreState( state ) );
+
+        TS_ASSERT( !relu1.phaseFixed() );
+        TS_ASSERT( relu1.satisfied() );
+        TS_ASSERT( relu2.isActive() );
+        TS_ASSERT( !store.hasValidSplit( 0 ) );
+        TS_ASSERT_EQUALS( store.countActive(), 2U );
+
+        // Restore only the activity
+        relu1.setActiveConstraint( false );
+        relu1.notifyLowerBound( 0, 1 );
+        TS_ASSERT_THROWS_NOTHING( store.restoreActivity( state ) );
+        TS_ASSERT( relu1.isActive() );
+        TS_ASSERT( relu1.phaseFixed() );
+
+        // A state of the wrong size is rejected
+        ReluConstraintStore::State emptyState;
+        TS_ASSERT_THROWS_EQUALS( store.restoreState( emptyState ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::MISSING_PL_CONSTRAINT_STATE );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
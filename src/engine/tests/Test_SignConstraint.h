@@ -0,0 +1,172 @@
+/*********************                                                        */
+/*! \file Test_SignConstraint.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2019 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include <cxxtest/TestSuite.h>
+
+#include "MarabouError.h"
+#include "MockErrno.h"
+#include "PiecewiseLinearCaseSplit.h"
+#include "SignConstraint.h"
+
+class MockForSignConstraint
+    : public MockErrno
+{
+public:
+};
+
+class SignConstraintTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForSignConstraint *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForSignConstraint );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_satisfied()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        SignConstraint sign( b, f );
+
+        sign.notifyVariableValue( b, 3 );
+        sign.notifyVariableValue( f, 1 );
+        TS_ASSERT( sign.satisfied() );
+
+        sign.notifyVariableValue( f, -1 );
+        TS_ASSERT( !sign.satisfied() );
+
+        sign.notifyVariableValue( b, -0.5 );
+        TS_ASSERT( sign.satisfied() );
+
+        sign.notifyVariableValue( f, 0 );
+        TS_ASSERT( !sign.satisfied() );
+
+        // At zero, either value is allowed
+        sign.notifyVariableValue( b, 0 );
+        sign.notifyVariableValue( f, 1 );
+        TS_ASSERT( sign.satisfied() );
+        sign.notifyVariableValue( f, -1 );
+        TS_ASSERT( sign.satisfied() );
+    }
+
+    void test_case_splits()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        SignConstraint sign( b, f );
+
+        List<PiecewiseLinearCaseSplit> splits = sign.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+
+        PiecewiseLinearCaseSplit positive = splits.front();
+        PiecewiseLinearCaseSplit negative = splits.back();
+
+        TS_ASSERT( positive.getEquations().empty() );
+        TS_ASSERT_EQUALS( positive.getBoundTightenings().size(), 3U );
+        TS_ASSERT( positive.getBoundTightenings().exists( Tightening( b, 0, Tightening::LB ) ) );
+        TS_ASSERT( positive.getBoundTightenings().exists( Tightening( f, 1, Tightening::LB ) ) );
+        TS_ASSERT( positive.getBoundTightenings().exists( Tightening( f, 1, Tightening::UB ) ) );
+
+        TS_ASSERT( negative.getEquations().empty() );
+        TS_ASSERT_EQUALS( negative.getBoundTightenings().size(), 3U );
+        TS_ASSERT( negative.getBoundTightenings().exists( Tightening( b, 0, Tightening::UB ) ) );
+        TS_ASSERT( negative.getBoundTightenings().exists( Tightening( f, -1, Tightening::LB ) ) );
+        TS_ASSERT( negative.getBoundTightenings().exists( Tightening( f, -1, Tightening::UB ) ) );
+    }
+
+    void test_phase_fixing_and_tightenings()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        SignConstraint sign( b, f );
+
+        sign.notifyLowerBound( b, -3 );
+        sign.notifyUpperBound( b, 3 );
+        TS_ASSERT( !sign.phaseFixed() );
+
+        List<Tightening> tightenings;
+        sign.getEntailedTightenings( tightenings );
+        TS_ASSERT_EQUALS( tightenings.size(), 2U );
+        TS_ASSERT( tightenings.exists( Tightening( f, -1, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( f, 1, Tightening::UB ) ) );
+
+        // f > -1 means f = 1
+        sign.notifyLowerBound( f, 0 );
+        TS_ASSERT_EQUALS( sign.getPhaseStatus(), SignConstraint::PHASE_POSITIVE );
+
+        tightenings.clear();
+        sign.getEntailedTightenings( tightenings );
+        TS_ASSERT( tightenings.exists( Tightening( f, 1, Tightening::LB ) ) );
+        TS_ASSERT( tightenings.exists( Tightening( b, 0, Tightening::LB ) ) );
+
+        SignConstraint sign2( b, f );
+        sign2.notifyUpperBound( b, -0.5 );
+        TS_ASSERT_EQUALS( sign2.getPhaseStatus(), SignConstraint::PHASE_NEGATIVE );
+
+        TS_ASSERT_THROWS_EQUALS( sign2.getCaseSplits(),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
+    }
+
+    void test_eliminate_variable()
+    {
+        unsigned b = 1;
+        unsigned f = 4;
+
+        // Eliminating b at zero leaves the choice of f open
+        SignConstraint sign( b, f );
+        sign.eliminateVariable( b, 0 );
+        TS_ASSERT( !sign.constraintObsolete() );
+        TS_ASSERT_EQUALS( sign.getParticipatingVariables(), List<unsigned>( { f } ) );
+
+        List<PiecewiseLinearCaseSplit> splits = sign.getCaseSplits();
+        TS_ASSERT_EQUALS( splits.size(), 2U );
+        TS_ASSERT_EQUALS( splits.front().getBoundTightenings().size(), 2U );
+
+        SignConstraint sign2( b, f );
+        sign2.eliminateVariable( f, 1 );
+        TS_ASSERT( sign2.constraintObsolete() );
+    }
+
+    void test_serialize_and_unserialize()
+    {
+        SignConstraint original( 3, 8 );
+        String serialized = original.serializeToString();
+        TS_ASSERT_EQUALS( serialized, "sign,8,3" );
+
+        SignConstraint recovered( serialized );
+        TS_ASSERT_EQUALS( recovered.getB(), 3U );
+        TS_ASSERT_EQUALS( recovered.getF(), 8U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
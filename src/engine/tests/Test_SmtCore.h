@@ -16,6 +16,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "GlobalConfiguration.h"
+#include "LearnedConflictStore.h"
 #include "MockEngine.h"
 #include "MockErrno.h"
 #include "PiecewiseLinearConstraint.h"
@@ -326,6 +327,177 @@ public:
         TS_ASSERT_EQUALS( smtCore.getStackDepth(), 0U );
     }
 
+    void test_learned_conflicts()
+    {
+        SmtCore smtCore( engine );
+        LearnedConflictStore store( 10 );
+
+        PiecewiseLinearCaseSplit region;
+        region.storeBoundTightening( Tightening( 0, -1.0, Tightening::LB ) );
+        region.storeBoundTightening( Tightening( 0, 1.0, Tightening::UB ) );
+
+        smtCore.setLearnedConflictStore( &store );
+        smtCore.setSearchRegion( region );
+
+        MockConstraint constraint;
+
+        // Split 1 has an equation, split 2 does not
+        PiecewiseLinearCaseSplit split1;
+        split1.storeBoundTightening( Tightening( 1, 0.0, Tightening::LB ) );
+        Equation equation( Equation::EQ );
+        equation.addAddend( 1, 1 );
+        equation.addAddend( -1, 2 );
+        equation.setScalar( 0 );
+        split1.addEquation( equation );
+
+        PiecewiseLinearCaseSplit split2;
+        split2.storeBoundTightening( Tightening( 1, 0.0, Tightening::UB ) );
+
+        constraint.nextSplits.append( split1 );
+        constraint.nextSplits.append( split2 );
+
+        for ( unsigned i = 0; i < GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD; ++i )
+            smtCore.reportViolatedConstraint( &constraint );
+
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+        TS_ASSERT( smtCore.splitIsApplied( split1 ) );
+        TS_ASSERT( !smtCore.splitIsApplied( split2 ) );
+        TS_ASSERT_EQUALS( store.size(), 0U );
+
+        // Split 1 failed: the region and split 1 form a conflict
+        TS_ASSERT( smtCore.popSplit() );
+        TS_ASSERT( smtCore.splitIsApplied( split2 ) );
+        TS_ASSERT_EQUALS( store.size(), 1U );
+
+        // Split 2 failed too: the entire region is infeasible
+        TS_ASSERT( !smtCore.popSplit() );
+        TS_ASSERT_EQUALS( store.size(), 2U );
+
+        unsigned cursor = 0;
+        List<const LearnedConflict *> conflicts;
+        store.importConflicts( cursor, conflicts );
+        TS_ASSERT_EQUALS( cursor, 2U );
+        TS_ASSERT_EQUALS( conflicts.size(), 2U );
+
+        const LearnedConflict *first = *conflicts.begin();
+        TS_ASSERT_EQUALS( first->_bounds.size(), 3U );
+        TS_ASSERT_EQUALS( first->_splitsWithEquations.size(), 1U );
+        TS_ASSERT_EQUALS( *first->_splitsWithEquations.begin(), split1 );
+
+        const LearnedConflict *second = conflicts.back();
+        TS_ASSERT_EQUALS( second->_bounds, region.getBoundTightenings() );
+        TS_ASSERT( second->_splitsWithEquations.empty() );
+    }
+
+    void test_donate_alternative_split()
+    {
+        SmtCore smtCore( engine );
+        LearnedConflictStore store( 10 );
+        smtCore.setLearnedConflictStore( &store );
+
+        MockConstraint constraint1;
+        MockConstraint constraint2;
+
+        PiecewiseLinearCaseSplit split1a;
+        split1a.storeBoundTightening( Tightening( 1, 0.0, Tightening::LB ) );
+        PiecewiseLinearCaseSplit split1b;
+        split1b.storeBoundTightening( Tightening( 1, 0.0, Tightening::UB ) );
+        constraint1.nextSplits.append( split1a );
+        constraint1.nextSplits.append( split1b );
+
+        PiecewiseLinearCaseSplit split2a;
+        split2a.storeBoundTightening( Tightening( 2, 0.0, Tightening::LB ) );
+        PiecewiseLinearCaseSplit split2b;
+        split2b.storeBoundTightening( Tightening( 2, 0.0, Tightening::UB ) );
+        constraint2.nextSplits.append( split2a );
+        constraint2.nextSplits.append( split2b );
+
+        // Nothing to donate before splitting
+        PiecewiseLinearCaseSplit donated;
+        TS_ASSERT( !smtCore.donateAlternativeSplit( donated ) );
+
+        for ( unsigned i = 0; i < GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD; ++i )
+            smtCore.reportViolatedConstraint( &constraint1 );
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+
+        for ( unsigned i = 0; i < GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD; ++i )
+            smtCore.reportViolatedConstraint( &constraint2 );
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+
+        // The shallowest alternative is donated first, on its own
+        TS_ASSERT( smtCore.donateAlternativeSplit( donated ) );
+        TS_ASSERT_EQUALS( donated, split1b );
+
+        // The next one comes with the path leading to it
+        TS_ASSERT( smtCore.donateAlternativeSplit( donated ) );
+        PiecewiseLinearCaseSplit expected;
+        expected.addSplit( split1a );
+        expected.addSplit( split2b );
+        TS_ASSERT_EQUALS( donated, expected );
+
+        TS_ASSERT( !smtCore.donateAlternativeSplit( donated ) );
+
+        // All alternatives were donated, so the search is over, and
+        // no conflicts are learned for the donated subtrees
+        TS_ASSERT( !smtCore.popSplit() );
+        TS_ASSERT_EQUALS( store.size(), 0U );
+    }
+
+    void test_stack_entries_are_reused()
+    {
+        SmtCore smtCore( engine );
+        Statistics statistics;
+        smtCore.setStatistics( &statistics );
+
+        MockConstraint constraint1;
+        MockConstraint constraint2;
+
+        PiecewiseLinearCaseSplit split1a;
+        split1a.storeBoundTightening( Tightening( 1, 0.0, Tightening::LB ) );
+        PiecewiseLinearCaseSplit split1b;
+        split1b.storeBoundTightening( Tightening( 1, 0.0, Tightening::UB ) );
+        constraint1.nextSplits.append( split1a );
+        constraint1.nextSplits.append( split1b );
+
+        PiecewiseLinearCaseSplit split2a;
+        split2a.storeBoundTightening( Tightening( 2, 0.0, Tightening::LB ) );
+        PiecewiseLinearCaseSplit split2b;
+        split2b.storeBoundTightening( Tightening( 2, 0.0, Tightening::UB ) );
+        constraint2.nextSplits.append( split2a );
+        constraint2.nextSplits.append( split2b );
+
+        for ( unsigned i = 0; i < GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD; ++i )
+            smtCore.reportViolatedConstraint( &constraint1 );
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+        EngineState *stateAtDepth1 = engine->lastStoredState;
+
+        for ( unsigned i = 0; i < GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD; ++i )
+            smtCore.reportViolatedConstraint( &constraint2 );
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+        EngineState *stateAtDepth2 = engine->lastStoredState;
+
+        TS_ASSERT_DIFFERS( stateAtDepth1, stateAtDepth2 );
+        TS_ASSERT_EQUALS( statistics.getNumSearchNodesAllocated(), 2U );
+        TS_ASSERT_EQUALS( statistics.getNumSearchNodesReused(), 0U );
+
+        // Exhaust the second level, and move to the alternative of the first
+        TS_ASSERT( smtCore.popSplit() );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 2U );
+        TS_ASSERT( smtCore.popSplit() );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 1U );
+        TS_ASSERT_EQUALS( engine->lastRestoredState, stateAtDepth1 );
+
+        // Splitting again reuses the entry of the popped level
+        for ( unsigned i = 0; i < GlobalConfiguration::CONSTRAINT_VIOLATION_THRESHOLD; ++i )
+            smtCore.reportViolatedConstraint( &constraint2 );
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 2U );
+        TS_ASSERT_EQUALS( engine->lastStoredState, stateAtDepth2 );
+
+        TS_ASSERT_EQUALS( statistics.getNumSearchNodesAllocated(), 2U );
+        TS_ASSERT_EQUALS( statistics.getNumSearchNodesReused(), 1U );
+    }
+
     void test_perform_split__inactive_constraint()
     {
         SmtCore smtCore( engine );
@@ -15,6 +15,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "AbsoluteValueConstraint.h"
 #include "FloatUtils.h"
 #include "SymbolicBoundTightener.h"
 
@@ -286,6 +287,125 @@ public:
         TS_ASSERT( sbt2.getUpperBound( 2, 0 ) < -5 + 0.001 );
     }
 
+    void prepareNetwork( SymbolicBoundTightener &sbt )
+    {
+        sbt.setNumberOfLayers( 3 );
+        sbt.setLayerSize( 0, 2 );
+        sbt.setLayerSize( 1, 2 );
+        sbt.setLayerSize( 2, 1 );
+
+        sbt.allocateWeightAndBiasSpace();
+
+        sbt.setBias( 0, 0, 0 );
+        sbt.setBias( 0, 1, 0 );
+        sbt.setBias( 1, 0, -20 ); // Node (1,0) ranges over [-9, 7]
+        sbt.setBias( 1, 1, 0 );
+        sbt.setBias( 2, 0, 0 );
+
+        sbt.setWeight( 0, 0, 0, 2 );
+        sbt.setWeight( 0, 0, 1, 1 );
+        sbt.setWeight( 0, 1, 0, 3 );
+        sbt.setWeight( 0, 1, 1, 1 );
+        sbt.setWeight( 1, 0, 0, 1 );
+        sbt.setWeight( 1, 1, 0, -1 );
+
+        sbt.setInputLowerBound( 0, 4 );
+        sbt.setInputUpperBound( 0, 6 );
+        sbt.setInputLowerBound( 1, 1 );
+        sbt.setInputUpperBound( 1, 5 );
+    }
+
+    void test_absolute_value_activations()
+    {
+        SymbolicBoundTightener sbt;
+        prepareNetwork( sbt );
+
+        sbt.setActivationFunction( 1, 0, SymbolicBoundTightener::ABSOLUTE_VALUE );
+        sbt.setActivationFunction( 1, 1, SymbolicBoundTightener::ABSOLUTE_VALUE );
+
+        TS_ASSERT_THROWS_NOTHING( sbt.run( false ) );
+
+        // Node (1,0) is in [0, 9] and node (1,1) is in [5, 11]:
+        // expected range: [-11, 4], +- epsilon
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) < -11 );
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) > -11 - 0.001 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) > 4 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) < 4 + 0.001 );
+    }
+
+    void test_activation_functions_from_constraints()
+    {
+        SymbolicBoundTightener sbt;
+        prepareNetwork( sbt );
+
+        sbt.setReluBVariable( 1, 0, 2 );
+        sbt.setReluBVariable( 1, 1, 3 );
+        sbt.setReluFVariable( 1, 0, 4 );
+        sbt.setReluFVariable( 1, 1, 5 );
+
+        // The activation functions are taken from the constraints
+        AbsoluteValueConstraint abs1( 2, 4 );
+        AbsoluteValueConstraint abs2( 3, 5 );
+        TS_ASSERT_THROWS_NOTHING( sbt.setConstraintStatus( &abs1 ) );
+        TS_ASSERT_THROWS_NOTHING( sbt.setConstraintStatus( &abs2 ) );
+
+        TS_ASSERT_THROWS_NOTHING( sbt.run( false ) );
+
+        // Same as with explicitly set absolute value activations
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) < -11 );
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) > -11 - 0.001 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) > 4 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) < 4 + 0.001 );
+    }
+
+    void test_leaky_relu_activations()
+    {
+        SymbolicBoundTightener sbt;
+        prepareNetwork( sbt );
+
+        sbt.setActivationFunction( 1, 0, SymbolicBoundTightener::LEAKY_RELU, 0.5 );
+        sbt.setActivationFunction( 1, 1, SymbolicBoundTightener::LEAKY_RELU, 0.5 );
+
+        SymbolicBoundTightener sbt2;
+        TS_ASSERT_THROWS_NOTHING( sbt.storeIntoOther( sbt2 ) );
+
+        TS_ASSERT_THROWS_NOTHING( sbt2.run( false ) );
+
+        // The lower bound of node (1,0) is 0.5 * ( 2x0 + 3x1 - 20 ), and
+        // its upper bound is 7. Expected range: [-9.5, 2], +- epsilon
+        TS_ASSERT( sbt2.getLowerBound( 2, 0 ) < -9.5 );
+        TS_ASSERT( sbt2.getLowerBound( 2, 0 ) > -9.5 - 0.001 );
+        TS_ASSERT( sbt2.getUpperBound( 2, 0 ) > 2 );
+        TS_ASSERT( sbt2.getUpperBound( 2, 0 ) < 2 + 0.001 );
+    }
+
+    void test_sign_activations()
+    {
+        SymbolicBoundTightener sbt;
+        prepareNetwork( sbt );
+
+        sbt.setActivationFunction( 1, 0, SymbolicBoundTightener::SIGN );
+        sbt.setActivationFunction( 1, 1, SymbolicBoundTightener::SIGN );
+
+        TS_ASSERT_THROWS_NOTHING( sbt.run() );
+
+        // Node (1,0) is in [-1, 1] and node (1,1) is 1:
+        // expected range: [-2, 0], +- epsilon
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) < -2 );
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) > -2 - 0.001 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) > 0 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) < 0 + 0.001 );
+
+        // Fixing the phase of node (1,0) to negative
+        sbt.setReluStatus( 1, 0, ReluConstraint::PHASE_INACTIVE );
+        TS_ASSERT_THROWS_NOTHING( sbt.run() );
+
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) < -2 );
+        TS_ASSERT( sbt.getLowerBound( 2, 0 ) > -2 - 0.001 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) > -2 );
+        TS_ASSERT( sbt.getUpperBound( 2, 0 ) < -2 + 0.001 );
+    }
+
     void test_todo()
     {
         TS_TRACE( "TODO: add a test for linear concretizations" );
@@ -108,6 +108,45 @@ public:
         tableau.setRightHandSide( b );
     }
 
+    void test_set_sparse_constraint_matrix()
+    {
+        Tableau dense;
+        Tableau sparse;
+
+        TS_ASSERT_THROWS_NOTHING( dense.setDimensions( 3, 7 ) );
+        TS_ASSERT_THROWS_NOTHING( sparse.setDimensions( 3, 7 ) );
+
+        double A[] = {
+            3, 2, 1, 2, 1, 0, 0,
+            1, 1, 1, 1, 0, 1, 0,
+            4, 3, 3, 4, 0, 0, 1,
+        };
+
+        SparseUnsortedList *rows[3];
+        for ( unsigned i = 0; i < 3; ++i )
+            rows[i] = new SparseUnsortedList( A + ( i * 7 ), 7 );
+
+        TS_ASSERT_THROWS_NOTHING( dense.setConstraintMatrix( A ) );
+        TS_ASSERT_THROWS_NOTHING( sparse.setConstraintMatrix( rows ) );
+
+        for ( unsigned i = 0; i < 7; ++i )
+        {
+            TS_ASSERT_SAME_DATA( dense.getAColumn( i ), sparse.getAColumn( i ), sizeof(double) * 3 );
+
+            const double *column = sparse.getAColumn( i );
+            for ( unsigned j = 0; j < 3; ++j )
+            {
+                TS_ASSERT_EQUALS( column[j], A[j * 7 + i] );
+                TS_ASSERT_EQUALS( sparse.getSparseA()->get( j, i ), A[j * 7 + i] );
+                TS_ASSERT_EQUALS( sparse.getSparseARow( j )->get( i ), A[j * 7 + i] );
+                TS_ASSERT_EQUALS( sparse.getSparseAColumn( i )->get( j ), A[j * 7 + i] );
+            }
+        }
+
+        for ( unsigned i = 0; i < 3; ++i )
+            delete rows[i];
+    }
+
     void test_initialize_bounds()
     {
         Tableau *tableau = NULL;
@@ -171,6 +210,58 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_compute_refined_assignment()
+    {
+        Tableau *tableau = NULL;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 2 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 218 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        // A basis that is not the identity: x1, x6, x7
+        List<unsigned> basics = { 0, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        // Move a non-basic without updating the basics
+        TS_ASSERT_THROWS_NOTHING( tableau->setNonBasicAssignment( 1, 2, false ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->computeRefinedAssignment( 2 ) );
+        TS_ASSERT_EQUALS( tableau->getBasicAssignmentStatus(),
+                          ITableau::BASIC_ASSIGNMENT_JUST_COMPUTED );
+
+        // Expect:
+        // x1 = ( 225 - 2x2 - x3 - 2x4 - x5 ) / 3 = ( 225 - 4 - 1 - 2 - 218 ) / 3 = 0
+        // x6 = 117 - x1 - x2 - x3 - x4 = 113
+        // x7 = 420 - 4x1 - 3x2 - 3x3 - 4x4 = 407
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 0 ), 0.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 5 ), 113.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 6 ), 407.0 ) );
+
+        // Refinement agrees with the plain computation
+        TS_ASSERT_THROWS_NOTHING( tableau->computeAssignment() );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 0 ), 0.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 5 ), 113.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 6 ), 407.0 ) );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_watcher__value_changes()
     {
         Tableau *tableau = NULL;
@@ -1122,6 +1213,83 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_store_state_shares_matrix()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        // States stored while the matrix is unchanged share its copy
+        TableauState state1;
+        TableauState state2;
+        TS_ASSERT_THROWS_NOTHING( tableau->storeState( state1 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 0, 9 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->storeState( state2 ) );
+
+        TS_ASSERT( state1._matrixData );
+        TS_ASSERT_EQUALS( state1._matrixData, state2._matrixData );
+        TS_ASSERT_EQUALS( state1._matrixData.use_count(), 3 );
+
+        // Adding an equation changes the matrix, and so requires a new copy
+        Equation equation;
+        equation.addAddend( 2, 1 );
+        equation.addAddend( -4, 2 );
+        equation.setScalar( 5 );
+        TS_ASSERT_THROWS_NOTHING( tableau->addEquation( equation ) );
+
+        TableauState state3;
+        TS_ASSERT_THROWS_NOTHING( tableau->storeState( state3 ) );
+        TS_ASSERT_DIFFERS( state1._matrixData, state3._matrixData );
+        TS_ASSERT_EQUALS( state3._matrixData->_m, 4U );
+        TS_ASSERT_EQUALS( state3._matrixData->_b[3], 5.0 );
+
+        // Restoring the older state brings back the old matrix, which is shared again
+        TS_ASSERT_THROWS_NOTHING( tableau->restoreState( state1 ) );
+        TS_ASSERT_EQUALS( tableau->getM(), 3U );
+        TS_ASSERT_EQUALS( tableau->getN(), 7U );
+        TS_ASSERT_EQUALS( tableau->getSparseA()->get( 2, 3 ), 4.0 );
+
+        TableauState state4;
+        TS_ASSERT_THROWS_NOTHING( tableau->storeState( state4 ) );
+        TS_ASSERT_EQUALS( state1._matrixData, state4._matrixData );
+
+        // Storing again into a state of the same dimensions reuses its arrays
+        double *lowerBounds = state2._lowerBounds;
+        TS_ASSERT_EQUALS( state2._upperBounds[0], 9.0 );
+        TS_ASSERT_THROWS_NOTHING( tableau->storeState( state2 ) );
+        TS_ASSERT_EQUALS( state2._lowerBounds, lowerBounds );
+        TS_ASSERT_EQUALS( state2._upperBounds[0], 10.0 );
+
+        // A state of different dimensions is resized
+        TS_ASSERT_DIFFERS( state3.getStorageSize(), state1.getStorageSize() );
+        TS_ASSERT_THROWS_NOTHING( tableau->storeState( state3 ) );
+        TS_ASSERT_EQUALS( state3.getStorageSize(), state1.getStorageSize() );
+        TS_ASSERT_EQUALS( state3._m, 3U );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_add_equation()
     {
         Tableau *tableau = NULL;
@@ -1276,6 +1444,108 @@ public:
         TS_ASSERT_EQUALS( tableau->getValue( 6 ), 403.0 );
         TS_ASSERT_EQUALS( tableau->getValue( 7 ), 11.0 ); // 473 - 4 - 6 - 4 - 4*112
 
+        // Refinement uses working memory that grew with the new row
+        TS_ASSERT_THROWS_NOTHING( tableau->computeRefinedAssignment( 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 4 ), 216.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 2 ), 2.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 6 ), 403.0 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 7 ), 11.0 ) );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_add_equations()
+    {
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+
+        TS_ASSERT( tableau = new Tableau );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 3, 7 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+        initializeTableauValues( *tableau );
+
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, 1 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, 10 ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, 219 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 228 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 5, 112 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 5, 114 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 6, 400 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 6, 402 ) );
+
+        List<unsigned> basics = { 4, 5, 6 };
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+
+        TS_ASSERT_EQUALS( tableau->getMCapacity(), 3U );
+        TS_ASSERT_EQUALS( tableau->getNCapacity(), 7U );
+
+        /*
+          Add a batch of equations of the form
+
+              x1 + (i+1) x2 + aux_i = i
+
+          Each aux variable is a new basic variable.
+        */
+        List<Equation> equations;
+        for ( unsigned i = 0; i < 5; ++i )
+        {
+            Equation equation;
+            equation.addAddend( 1, 0 );
+            equation.addAddend( i + 1, 1 );
+            equation.setScalar( i );
+            equations.append( equation );
+        }
+
+        List<unsigned> auxVariables;
+        TS_ASSERT_THROWS_NOTHING( tableau->addEquations( equations, auxVariables ) );
+        TS_ASSERT_EQUALS( auxVariables, List<unsigned>( { 7, 8, 9, 10, 11 } ) );
+
+        TS_ASSERT_EQUALS( tableau->getM(), 8U );
+        TS_ASSERT_EQUALS( tableau->getN(), 12U );
+        TS_ASSERT( tableau->getMCapacity() >= 8U );
+        TS_ASSERT( tableau->getNCapacity() >= 12U );
+
+        // Adding a single equation doubles the capacity
+        unsigned mCapacity = tableau->getMCapacity();
+        unsigned nCapacity = tableau->getNCapacity();
+
+        Equation equation;
+        equation.addAddend( 1, 2 );
+        equation.addAddend( -1, 3 );
+        equation.setScalar( 3 );
+        unsigned aux = 0;
+        TS_ASSERT_THROWS_NOTHING( aux = tableau->addEquation( equation ) );
+        TS_ASSERT_EQUALS( aux, 12U );
+
+        TS_ASSERT_EQUALS( tableau->getM(), 9U );
+        TS_ASSERT_EQUALS( tableau->getN(), 13U );
+        TS_ASSERT_EQUALS( tableau->getMCapacity(), 2 * mCapacity );
+        TS_ASSERT( tableau->getNCapacity() >= 13U );
+        TS_ASSERT( tableau->getNCapacity() >= nCapacity );
+
+        for ( unsigned i = 7; i <= 12; ++i )
+            TS_ASSERT( tableau->isBasic( i ) );
+
+        // The non-basics are at their lower bounds
+        tableau->computeAssignment();
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 4 ), 217.0 ) );
+        for ( unsigned i = 0; i < 5; ++i )
+            TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 7 + i ), (double)i - 1 - ( i + 1 ) ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 12 ), 3.0 ) );
+
+        // The original column layout survives the reallocation
+        const double *column = tableau->getAColumn( 0 );
+        TS_ASSERT_EQUALS( column[0], 3.0 );
+        TS_ASSERT_EQUALS( column[3], 1.0 );
+        TS_ASSERT_EQUALS( column[8], 0.0 );
+
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
@@ -1533,8 +1803,6 @@ public:
 
     void test_todo()
     {
-        TS_TRACE( "When resizing the talbeau, allocate a larger size and only use part of it, "
-                  "instead of increasing it one row at a time?" );
         TS_TRACE( "Make sure all watchers are properply informed when restoring a tabealu" );
         TS_TRACE( "Recomputing the cost function: more clever handling for row addition and "
                   "the setNonBasic() case?" );
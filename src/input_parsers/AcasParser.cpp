@@ -156,9 +156,11 @@ void AcasParser::generateQuery( InputQuery &inputQuery )
             unsigned b = _nodeToB[NodeIndex(i, j)];
             unsigned f = _nodeToF[NodeIndex(i, j)];
             PiecewiseLinearConstraint *relu = new ReluConstraint( b, f );
+            // Constraints with higher scores are split on first, so
+            // earlier layers get higher scores
             if ( GlobalConfiguration::SPLITTING_HEURISTICS ==
                  DivideStrategy::EarliestReLU )
-                relu->setScore( i );
+                relu->setScore( numberOfLayers - i );
             inputQuery.addPiecewiseLinearConstraint( relu );
         }
     }
@@ -14,16 +14,20 @@
  ** [[ Add lengthier description here ]]
  **/
 
+#include "AbsoluteValueConstraint.h"
 #include "AutoFile.h"
 #include "Debug.h"
+#include "DisjunctionConstraint.h"
 #include "Equation.h"
 #include "GlobalConfiguration.h"
 #include "InputQuery.h"
+#include "LeakyReluConstraint.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "MaxConstraint.h"
 #include "QueryLoader.h"
 #include "ReluConstraint.h"
+#include "SignConstraint.h"
 
 InputQuery QueryLoader::loadQuery( const String &fileName )
 {
@@ -209,6 +213,22 @@ InputQuery QueryLoader::loadQuery( const String &fileName )
         {
             constraint = new MaxConstraint( serializeConstraint );
         }
+        else if ( coType == "leaky_relu" )
+        {
+            constraint = new LeakyReluConstraint( serializeConstraint );
+        }
+        else if ( coType == "abs" )
+        {
+            constraint = new AbsoluteValueConstraint( serializeConstraint );
+        }
+        else if ( coType == "sign" )
+        {
+            constraint = new SignConstraint( serializeConstraint );
+        }
+        else if ( coType == "disj" )
+        {
+            constraint = new DisjunctionConstraint( serializeConstraint );
+        }
         else
         {
             throw MarabouError( MarabouError::UNSUPPORTED_PIECEWISE_CONSTRAINT, Stringf( "Unsupported piecewise constraint: %s\n", coType.ascii() ).ascii() );
@@ -97,6 +97,13 @@ public:
 
         TS_ASSERT_THROWS_NOTHING( engine.solve() );
 
+        // Once solving is done, the snapshot holds the final statistics
+        Statistics snapshot = engine.getStatisticsSnapshot();
+        TS_ASSERT_EQUALS( snapshot.getNumVisitedTreeStates(),
+                          engine.getStatistics()->getNumVisitedTreeStates() );
+        TS_ASSERT_EQUALS( snapshot.getNumTableauPivots(),
+                          engine.getStatistics()->getNumTableauPivots() );
+
         engine.extractSolution( inputQuery );
 
         bool correctSolution = true;